@@ -0,0 +1,107 @@
+/**
+ * @file fifo_benchmark.cxx
+ * @brief Throughput of the SharedFIFO variants.
+ *
+ * Two scenarios:
+ *  - one producer pushes @c total bytes in @c chunk sized writes while one
+ *    consumer extracts @c chunk bytes at a time. Large transfers make the
+ *    consumer's copy dominate, which is where separate head and tail locks pay off;
+ *  - @c producers threads push small records into one buffer (fan-in), which is
+ *    where a lock-free write path or per-writer shards pay off.
+ *
+ * Usage: FIFOBenchmark [total_mib] [chunk_kib] [rounds] [producers]
+ */
+#include <StormByte/buffer/producer.hxx>
+#include <StormByte/buffer/consumer.hxx>
+#include <StormByte/buffer/mpmc_fifo.hxx>
+#include <StormByte/buffer/segmented_fifo.hxx>
+#include <StormByte/buffer/sharded_fifo.hxx>
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using StormByte::Buffer::Consumer;
+using StormByte::Buffer::DataType;
+using StormByte::Buffer::MPMCFIFO;
+using StormByte::Buffer::Producer;
+using StormByte::Buffer::SegmentedFIFO;
+using StormByte::Buffer::ShardedFIFO;
+using StormByte::Buffer::SharedFIFO;
+
+using Factory = std::function<std::shared_ptr<SharedFIFO>()>;
+
+static double run(const Factory& factory, const std::size_t& total, const std::size_t& chunk, const std::size_t& producers) {
+	Producer producer(factory());
+	Consumer consumer = producer.Consumer();
+	const DataType block(chunk, std::byte{0x5A});
+	const std::size_t share = total / producers / chunk * chunk;
+
+	const auto start = std::chrono::steady_clock::now();
+	std::vector<std::thread> writers;
+	for (std::size_t p = 0; p < producers; ++p) {
+		writers.emplace_back([&, writer = producer]() mutable {
+			for (std::size_t sent = 0; sent < share; sent += chunk)
+				(void)writer.Write(block);
+		});
+	}
+	std::thread closer([&]() {
+		for (auto& writer: writers)
+			writer.join();
+		producer.Close();
+	});
+
+	std::size_t received = 0;
+	DataType out;
+	while (!consumer.EoF()) {
+		out.clear();
+		// Wait for one chunk, then take whatever else is already there
+		if (consumer.Extract(chunk, out) || consumer.Extract(0, out)) {
+			(void)consumer.Extract(0, out);
+			received += out.size();
+		}
+	}
+	closer.join();
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	if (received != share * producers) {
+		std::cerr << "Transfer mismatch: " << received << " of " << share * producers << " bytes" << std::endl;
+		std::exit(1);
+	}
+	return static_cast<double>(received) / (1024.0 * 1024.0) / elapsed.count();
+}
+
+static void report(const char* title, const std::size_t& total, const std::size_t& chunk, const std::size_t& producers, const std::size_t& rounds) {
+	const std::pair<const char*, Factory> candidates[] = {
+		{ "SharedFIFO", [] { return std::make_shared<SharedFIFO>(); } },
+		{ "SegmentedFIFO", [] { return std::make_shared<SegmentedFIFO>(); } },
+		{ "MPMCFIFO", [] { return std::make_shared<MPMCFIFO>(); } },
+		{ "ShardedFIFO", [producers] { return std::make_shared<ShardedFIFO>(producers); } },
+	};
+
+	std::cout << title << ": " << producers << " producer(s) / 1 consumer, " << total / (1024 * 1024) << " MiB in "
+			  << chunk << " byte writes, best of " << rounds << std::endl;
+	for (const auto& [name, factory]: candidates) {
+		double best = 0;
+		for (std::size_t i = 0; i < rounds; ++i)
+			best = std::max(best, run(factory, total, chunk, producers));
+		std::cout << "  " << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(1) << std::setw(10) << best << " MiB/s" << std::endl;
+	}
+}
+
+int main(int argc, char** argv) {
+	const std::size_t total_mib = argc > 1 ? std::stoul(argv[1]) : 256;
+	const std::size_t chunk_kib = argc > 2 ? std::stoul(argv[2]) : 1024;
+	const std::size_t rounds = argc > 3 ? std::stoul(argv[3]) : 3;
+	const std::size_t producers = argc > 4 ? std::stoul(argv[4]) : 8;
+	const std::size_t total = total_mib * 1024 * 1024;
+
+	report("Large transfers", total, chunk_kib * 1024, 1, rounds);
+	report("Fan-in", total / 4, 256, producers, rounds);
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include <StormByte/buffer/async.hxx>
+
+#include <algorithm>
+
+using namespace StormByte::Buffer;
+
+AsyncOperation::AsyncOperation(std::shared_ptr<SharedFIFO> fifo, std::shared_ptr<Executor> executor) noexcept:
+m_fifo(std::move(fifo)), m_executor(std::move(executor)) {}
+
+AsyncOperation::~AsyncOperation() noexcept {
+	m_fifo->RemoveWaiter(this);
+}
+
+bool AsyncOperation::await_ready() noexcept {
+	return Attempt();
+}
+
+bool AsyncOperation::await_suspend(std::coroutine_handle<> handle) noexcept {
+	m_handle = handle;
+	// Once registered another thread may resume the coroutine: do not touch this
+	while (!m_fifo->AddWaiter(this)) {
+		if (Attempt())
+			return false;
+	}
+	return true;
+}
+
+void AsyncOperation::Wake() noexcept {
+	if (m_executor) {
+		try {
+			m_executor->Post([this]() { Continue(); });
+			return;
+		}
+		catch (...) {
+			// Could not schedule: continue in the signalling thread instead
+		}
+	}
+	Continue();
+}
+
+void AsyncOperation::Continue() noexcept {
+	while (!Attempt()) {
+		if (m_fifo->AddWaiter(this))
+			return;
+	}
+	m_handle.resume();
+}
+
+ReadAwaitable::ReadAwaitable(std::shared_ptr<SharedFIFO> fifo, const std::size_t& count, const bool& some, const bool& extract,
+	DataType& outBuffer, std::shared_ptr<Executor> executor) noexcept:
+AsyncOperation(std::move(fifo), std::move(executor)), m_count(count), m_some(some), m_extract(extract), m_out(outBuffer) {}
+
+ReadAwaitable::~ReadAwaitable() noexcept {
+	if (m_demanding)
+		m_fifo->RemoveDemand();
+}
+
+bool ReadAwaitable::Ready() const noexcept {
+	return !m_fifo->IsWritable() || m_fifo->AvailableBytes() >= Needed();
+}
+
+bool ReadAwaitable::Attempt() noexcept {
+	const std::size_t avail = m_fifo->AvailableBytes();
+	if (m_fifo->IsWritable() && avail < Needed()) {
+		if (!m_demanding) {
+			// A bounded buffer admits writes past its limit until the bytes are there
+			m_demanding = true;
+			m_fifo->AddDemand(Needed());
+		}
+		return false;
+	}
+	if (m_demanding) {
+		m_demanding = false;
+		m_fifo->RemoveDemand();
+	}
+
+	// Closed or errored buffers fail (or drain) without blocking
+	std::size_t count = m_count;
+	if (m_some || m_count == 0)
+		count = m_count == 0 ? avail : std::min(m_count, avail);
+	m_result = m_extract ? m_fifo->Extract(count, m_out) : m_fifo->Read(count, m_out);
+	return true;
+}
+
+WriteAwaitable::WriteAwaitable(std::shared_ptr<SharedFIFO> fifo, DataType&& data, std::shared_ptr<Executor> executor) noexcept:
+AsyncOperation(std::move(fifo), std::move(executor)), m_data(std::move(data)) {}
+
+bool WriteAwaitable::Ready() const noexcept {
+	return !m_fifo->IsWritable() || m_fifo->Admits(m_data.size());
+}
+
+bool WriteAwaitable::Attempt() noexcept {
+	switch (m_fifo->TryWrite(m_data)) {
+		case SharedFIFO::WriteStatus::Written:
+			m_result = true;
+			return true;
+		case SharedFIFO::WriteStatus::Rejected:
+			m_result = false;
+			return true;
+		default:
+			return false;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <StormByte/buffer/executor.hxx>
+#include <StormByte/buffer/shared_fifo.hxx>
+
+#include <coroutine>
+#include <memory>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class AsyncOperation
+	 * @brief Base of the awaitables returned by Consumer and Producer asynchronous calls.
+	 *
+	 * @par Overview
+	 *  Awaiting an operation completes at once when it can proceed without
+	 *  blocking. Otherwise the coroutine is suspended and the operation is
+	 *  registered as a SharedFIFO::Waiter; the thread whose state change makes it
+	 *  ready resumes it, inline or through the @ref Executor given at creation.
+	 *  The result of @c co_await is the bool the synchronous call would return.
+	 *
+	 * @par Lifetime
+	 *  Awaitables are meant to be awaited directly (<tt>co_await consumer.ReadAsync(...)</tt>).
+	 *  They keep the shared buffer alive while pending and unregister on destruction.
+	 *  Output buffers passed by reference must outlive the awaitable.
+	 *
+	 * @par Concurrency
+	 *  Readiness is checked without locking. With several consumers on one buffer
+	 *  bytes may be taken between the check and the read, in which case the
+	 *  operation simply waits again.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC AsyncOperation: public SharedFIFO::Waiter {
+		public:
+			/**
+			 * @brief Copy constructor deleted.
+			 */
+			AsyncOperation(const AsyncOperation&)						= delete;
+
+			/**
+			 * @brief Move constructor deleted.
+			 */
+			AsyncOperation(AsyncOperation&&)							= delete;
+
+			/**
+			 * @brief Destructor; unregisters the operation if still pending.
+			 */
+			~AsyncOperation() noexcept override;
+
+			/**
+			 * @brief Copy assignment deleted.
+			 */
+			AsyncOperation& operator=(const AsyncOperation&)			= delete;
+
+			/**
+			 * @brief Move assignment deleted.
+			 */
+			AsyncOperation& operator=(AsyncOperation&&)					= delete;
+
+			/**
+			 * @brief Complete immediately when the operation does not need to wait.
+			 * @return true if the operation already completed.
+			 */
+			bool 														await_ready() noexcept;
+
+			/**
+			 * @brief Result of the operation.
+			 * @return bool indicating success or failure, as the synchronous call.
+			 */
+			inline bool 												await_resume() const noexcept {
+				return m_result;
+			}
+
+			/**
+			 * @brief Register the operation and suspend the awaiting coroutine.
+			 * @param handle Coroutine to resume on completion.
+			 * @return false if the operation completed meanwhile (no suspension).
+			 */
+			bool 														await_suspend(std::coroutine_handle<> handle) noexcept;
+
+			/**
+			 * @brief Continue the operation once ready, through the executor if any.
+			 */
+			void 														Wake() noexcept override;
+
+		protected:
+			std::shared_ptr<SharedFIFO> m_fifo;							///< Buffer operated on.
+			bool m_result {false};										///< Outcome once completed.
+
+			/**
+			 * @brief Construct an operation on @p fifo.
+			 * @param fifo Buffer operated on.
+			 * @param executor Executor resuming the coroutine (null: inline).
+			 */
+			AsyncOperation(std::shared_ptr<SharedFIFO> fifo, std::shared_ptr<Executor> executor) noexcept;
+
+			/**
+			 * @brief Perform the operation if it can proceed without blocking.
+			 * @return true if completed (with @c m_result set), false to keep waiting.
+			 */
+			virtual bool 												Attempt() noexcept = 0;
+
+		private:
+			std::shared_ptr<Executor> m_executor;						///< Executor resuming the coroutine.
+			std::coroutine_handle<> m_handle;							///< Suspended coroutine.
+
+			/**
+			 * @brief Attempt the operation, registering again if it cannot proceed yet,
+			 *        and resume the coroutine once completed.
+			 */
+			void 														Continue() noexcept;
+	};
+
+	/**
+	 * @class ReadAwaitable
+	 * @brief Awaitable read or extract returned by Consumer::ReadAsync() and related calls.
+	 * @details Waits for the requested bytes (or, in "some" mode, for at least one
+	 *          byte) and completes with false once the buffer is closed without
+	 *          enough bytes, or errored.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC ReadAwaitable final: public AsyncOperation {
+		public:
+			/**
+			 * @brief Construct a pending read.
+			 * @param fifo Buffer to read from.
+			 * @param count Bytes to read; in "some" mode the maximum (0: no maximum).
+			 * @param some Whether any available bytes, up to @p count, complete the read.
+			 * @param extract Whether the bytes are extracted instead of read.
+			 * @param outBuffer Receives the bytes.
+			 * @param executor Executor resuming the coroutine (null: inline).
+			 */
+			ReadAwaitable(std::shared_ptr<SharedFIFO> fifo, const std::size_t& count, const bool& some, const bool& extract,
+				DataType& outBuffer, std::shared_ptr<Executor> executor) noexcept;
+
+			/**
+			 * @brief Destructor; stops counting as a reader waiting for bytes.
+			 */
+			~ReadAwaitable() noexcept override;
+
+			/**
+			 * @brief Check whether the read can complete without blocking.
+			 * @return true if enough bytes are available or the buffer is closed or errored.
+			 */
+			bool 														Ready() const noexcept override;
+
+		private:
+			std::size_t m_count;										///< Requested bytes, or maximum in "some" mode.
+			bool m_some;												///< Complete with any available bytes.
+			bool m_extract;												///< Extract instead of read.
+			DataType& m_out;											///< Output buffer.
+			bool m_demanding {false};									///< Counted by SharedFIFO::AddDemand().
+
+			/**
+			 * @brief Bytes that must be available before reading.
+			 * @return The requested count, or 1 in "some" mode and for count 0.
+			 */
+			inline std::size_t 											Needed() const noexcept {
+				return m_some || m_count == 0 ? 1 : m_count;
+			}
+
+			/**
+			 * @brief Read if enough bytes are available, or fail if closed or errored.
+			 * @return true if completed.
+			 */
+			bool 														Attempt() noexcept override;
+	};
+
+	/**
+	 * @class WriteAwaitable
+	 * @brief Awaitable write returned by Producer::WriteAsync().
+	 * @details Only a SharedFIFO in bounded mode makes a write wait: it completes
+	 *          once the bytes fit the limit, or with false once closed or errored.
+	 *          Other buffers complete the write on the first attempt.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC WriteAwaitable final: public AsyncOperation {
+		public:
+			/**
+			 * @brief Construct a pending write.
+			 * @param fifo Buffer to write to.
+			 * @param data Bytes to write.
+			 * @param executor Executor resuming the coroutine (null: inline).
+			 */
+			WriteAwaitable(std::shared_ptr<SharedFIFO> fifo, DataType&& data, std::shared_ptr<Executor> executor) noexcept;
+
+			/**
+			 * @brief Check whether the write can complete without blocking.
+			 * @return true if the bytes fit or the buffer is closed or errored.
+			 */
+			bool 														Ready() const noexcept override;
+
+		private:
+			DataType m_data;											///< Bytes to write.
+
+			/**
+			 * @brief Write if the bytes fit, or fail if closed or errored.
+			 * @return true if completed.
+			 */
+			bool 														Attempt() noexcept override;
+	};
+}
@@ -0,0 +1,395 @@
+#include <StormByte/buffer/broadcast_fifo.hxx>
+
+#include <algorithm>
+#include <sstream>
+
+using namespace StormByte::Buffer;
+
+/**
+ * @brief Per-consumer view over a BroadcastFIFO.
+ *
+ * Holds only an absolute read position; data, mutex and condition variable
+ * belong to the hub. Close and error flags are mirrored from the hub so the
+ * non-virtual SharedFIFO::HasError() stays correct on the consumer side.
+ */
+class BroadcastFIFO::Cursor final: public SharedFIFO {
+	friend class BroadcastFIFO;
+
+	public:
+		Cursor(std::shared_ptr<BroadcastFIFO> hub) noexcept: m_hub(std::move(hub)), m_cursor(0) {}
+
+		~Cursor() noexcept override {
+			{
+				std::scoped_lock<std::mutex> lock(m_hub->m_mutex);
+				m_hub->Detach(this);
+			}
+			m_hub->m_cv.notify_all();
+			m_hub->Signal();
+		}
+
+		std::size_t AvailableBytes() const noexcept override {
+			if (!m_attached.load(std::memory_order_acquire))
+				return 0;
+			return m_hub->m_end.load(std::memory_order_acquire) - m_cursor.load(std::memory_order_acquire);
+		}
+
+		void Clean() noexcept override {}
+
+		void Clear() noexcept override {
+			{
+				std::scoped_lock<std::mutex> lock(m_hub->m_mutex);
+				if (!m_attached.load(std::memory_order_relaxed))
+					return;
+				m_cursor.store(m_hub->m_chunks.End(), std::memory_order_release);
+				m_hub->Reclaim();
+			}
+			m_hub->m_cv.notify_all();
+			m_hub->Signal();
+			Signal();
+		}
+
+		void Close() noexcept override {
+			m_hub->Close();
+		}
+
+		bool Drop(const std::size_t& count) noexcept override {
+			bool result = false;
+			{
+				std::unique_lock<std::mutex> lock(m_hub->m_mutex);
+				if (count != 0)
+					Wait(count, lock);
+				const std::size_t avail = Available();
+				if (m_error.load(std::memory_order_relaxed) || avail == 0 || count > avail)
+					return false;
+				m_cursor.store(m_cursor.load(std::memory_order_relaxed) + count, std::memory_order_release);
+				m_hub->Reclaim();
+				result = true;
+			}
+			m_hub->m_cv.notify_all();
+			m_hub->Signal();
+			return result;
+		}
+
+		bool Empty() const noexcept override {
+			return AvailableBytes() == 0;
+		}
+
+		bool EoF() const noexcept override {
+			if (m_error.load(std::memory_order_acquire))
+				return true;
+			return m_closed.load(std::memory_order_acquire) && AvailableBytes() == 0;
+		}
+
+		std::string HexDump(const std::size_t& collumns, const std::size_t& byte_limit) const noexcept override {
+			std::scoped_lock<std::mutex> lock(m_hub->m_mutex);
+			const std::size_t position = m_cursor.load(std::memory_order_relaxed);
+			const std::size_t avail = Available();
+			const std::size_t count = byte_limit > 0 ? std::min(avail, byte_limit) : avail;
+
+			std::ostringstream oss;
+			oss << "Size: " << m_hub->m_chunks.Size() << " bytes\n";
+			oss << "Read Position: " << position << '\n';
+			oss << "Status: " << (m_closed ? "closed" : "opened") << " and " << (m_error ? "error" : "ready");
+			oss << '\n';
+
+			DataType data;
+			if (count > 0 && m_hub->m_chunks.Copy(position, count, data)) {
+				std::span<const std::byte> view(data.data(), data.size());
+				oss << FormatHexLines(view, position, collumns == 0 ? 16 : collumns);
+			}
+			return oss.str();
+		}
+
+		void Seek(const std::ptrdiff_t& offset, const Position& mode) const noexcept override {
+			{
+				std::scoped_lock<std::mutex> lock(m_hub->m_mutex);
+				if (!m_attached.load(std::memory_order_relaxed))
+					return;
+				const std::ptrdiff_t base = mode == Position::Absolute ? 0 : static_cast<std::ptrdiff_t>(m_cursor.load(std::memory_order_relaxed));
+				const std::ptrdiff_t target = std::clamp(base + offset,
+					static_cast<std::ptrdiff_t>(m_hub->m_chunks.Begin()),
+					static_cast<std::ptrdiff_t>(m_hub->m_chunks.End()));
+				m_cursor.store(static_cast<std::size_t>(target), std::memory_order_release);
+				m_hub->Reclaim();
+			}
+			m_hub->m_cv.notify_all();
+			m_hub->Signal();
+			Signal();
+		}
+
+		void SetError() noexcept override {
+			m_hub->SetError();
+		}
+
+		std::size_t Size() const noexcept override {
+			return m_hub->Size();
+		}
+
+	protected:
+		std::shared_ptr<SharedFIFO> ConsumerView(std::shared_ptr<SharedFIFO>) override {
+			return m_hub->ConsumerView(m_hub);
+		}
+
+	private:
+		std::shared_ptr<BroadcastFIFO> m_hub;						///< Owning broadcast FIFO.
+		mutable std::atomic<std::size_t> m_cursor;					///< Absolute read position.
+		std::atomic<bool> m_attached {true};						///< False once detached by the hub.
+
+		// Requires hub mutex
+		std::size_t Available() const noexcept {
+			return m_attached.load(std::memory_order_relaxed) ? m_hub->m_chunks.End() - m_cursor.load(std::memory_order_relaxed) : 0;
+		}
+
+		bool ReadInternal(const std::size_t& count, DataType& outBuffer, const Operation& flag) noexcept override {
+			bool consumed = false;
+			{
+				std::unique_lock<std::mutex> lock(m_hub->m_mutex);
+				std::size_t avail = Available();
+				if (m_error || (m_closed && avail == 0))
+					return false;
+
+				const std::size_t real_count = count == 0 ? avail : count;
+				if (real_count > avail && !m_closed) {
+					Wait(real_count, lock);
+					avail = Available();
+				}
+				if (m_error || (avail == 0 && count == 0) || real_count > avail)
+					return false;
+
+				const std::size_t position = m_cursor.load(std::memory_order_relaxed);
+				m_hub->m_chunks.Copy(position, real_count, outBuffer);
+				if (flag != Operation::Peek) {
+					m_cursor.store(position + real_count, std::memory_order_release);
+					m_hub->Reclaim();
+					consumed = true;
+				}
+			}
+			// Only writers held back by the lag limit wait for readers
+			if (consumed && m_hub->m_max_lag > 0) {
+				m_hub->m_cv.notify_all();
+				m_hub->Signal();
+			}
+			return true;
+		}
+
+		bool ReadInternal(const std::size_t& count, WriteOnly& outBuffer, const Operation& flag) noexcept override {
+			DataType data;
+			if (!ReadInternal(count, data, flag))
+				return false;
+			return outBuffer.Write(0, std::move(data));
+		}
+
+		// Requires hub mutex
+		void Wait(const std::size_t& n, std::unique_lock<std::mutex>& lock) const {
+			m_hub->m_cv.wait(lock, [&] {
+				return m_closed || m_error || Available() >= n;
+			});
+		}
+
+		bool WriteInternal(const std::size_t& count, const DataType& src) noexcept override {
+			return m_hub->Write(count, src);
+		}
+
+		bool WriteInternal(const std::size_t& count, DataType&& src) noexcept override {
+			return m_hub->Write(count, std::move(src));
+		}
+};
+
+BroadcastFIFO::BroadcastFIFO(const std::size_t& max_lag, const LagPolicy& policy) noexcept:
+SharedFIFO(), m_max_lag(max_lag), m_policy(policy) {}
+
+void BroadcastFIFO::Clean() noexcept {}
+
+void BroadcastFIFO::Clear() noexcept {
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		m_chunks.Clear();
+		for (Cursor* cursor: m_cursors)
+			cursor->m_cursor.store(m_chunks.End(), std::memory_order_release);
+		m_retained.store(0, std::memory_order_release);
+		m_slowest.store(m_chunks.End(), std::memory_order_release);
+	}
+	m_cv.notify_all();
+	SignalCursors();
+}
+
+void BroadcastFIFO::Close() noexcept {
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		m_closed.store(true, std::memory_order_release);
+		for (Cursor* cursor: m_cursors)
+			cursor->m_closed.store(true, std::memory_order_release);
+	}
+	m_cv.notify_all();
+	SignalCursors();
+}
+
+bool BroadcastFIFO::Drop(const std::size_t&) noexcept {
+	return false;
+}
+
+bool BroadcastFIFO::Empty() const noexcept {
+	return m_retained.load(std::memory_order_acquire) == 0;
+}
+
+std::size_t BroadcastFIFO::Lag() const noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	return m_chunks.End() - Slowest();
+}
+
+void BroadcastFIFO::SetError() noexcept {
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		m_error.store(true, std::memory_order_release);
+		for (Cursor* cursor: m_cursors)
+			cursor->m_error.store(true, std::memory_order_release);
+	}
+	m_cv.notify_all();
+	SignalCursors();
+}
+
+std::size_t BroadcastFIFO::Size() const noexcept {
+	return m_retained.load(std::memory_order_acquire);
+}
+
+std::size_t BroadcastFIFO::Subscribers() const noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	return m_cursors.size();
+}
+
+std::shared_ptr<SharedFIFO> BroadcastFIFO::ConsumerView(std::shared_ptr<SharedFIFO> self) {
+	auto cursor = std::make_shared<Cursor>(std::static_pointer_cast<BroadcastFIFO>(std::move(self)));
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	cursor->m_cursor.store(m_chunks.Begin(), std::memory_order_release);
+	cursor->m_closed.store(m_closed.load(std::memory_order_relaxed), std::memory_order_release);
+	cursor->m_error.store(m_error.load(std::memory_order_relaxed), std::memory_order_release);
+	m_cursors.push_back(cursor.get());
+	m_slowest.store(Slowest(), std::memory_order_release);
+	return cursor;
+}
+
+SharedFIFO::WriteStatus BroadcastFIFO::Append(DataType& data, const bool& wait) noexcept {
+	if (data.empty())
+		return WriteStatus::Written;
+	const std::size_t size = data.size();
+	std::vector<Waiter*> dropped;
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		if (m_closed || m_error)
+			return WriteStatus::Rejected;
+
+		if (m_max_lag > 0) {
+			if (m_policy == LagPolicy::Block) {
+				if (!wait && !m_cursors.empty() && Exceeds(Slowest(), size))
+					return WriteStatus::Full;
+				m_cv.wait(lock, [&] {
+					return m_closed || m_error || m_cursors.empty() || !Exceeds(Slowest(), size);
+				});
+				if (m_closed || m_error)
+					return WriteStatus::Rejected;
+			}
+			else {
+				std::vector<Cursor*> slow;
+				for (Cursor* cursor: m_cursors)
+					if (Exceeds(cursor->m_cursor.load(std::memory_order_relaxed), size))
+						slow.push_back(cursor);
+				for (Cursor* cursor: slow) {
+					cursor->m_error.store(true, std::memory_order_release);
+					Detach(cursor);
+					// Detached cursors are no longer reached by SignalCursors()
+					cursor->CollectReady(dropped);
+				}
+			}
+		}
+
+		m_chunks.Push(std::move(data));
+		m_end.store(m_chunks.End(), std::memory_order_release);
+		m_retained.store(m_chunks.Size(), std::memory_order_release);
+		if (m_cursors.empty())
+			m_slowest.store(m_chunks.End(), std::memory_order_release);
+	}
+	m_cv.notify_all();
+	for (Waiter* waiter: dropped)
+		waiter->Wake();
+	SignalCursors();
+	return WriteStatus::Written;
+}
+
+bool BroadcastFIFO::Admits(const std::size_t& n) const noexcept {
+	if (m_max_lag == 0 || m_policy != LagPolicy::Block)
+		return true;
+	const std::size_t lag = m_end.load(std::memory_order_acquire) - m_slowest.load(std::memory_order_acquire);
+	return lag == 0 || lag + n <= m_max_lag;
+}
+
+bool BroadcastFIFO::Exceeds(const std::size_t& position, const std::size_t& size) const noexcept {
+	// A cursor with nothing left to read never holds a write back
+	const std::size_t lag = m_chunks.End() - position;
+	return lag > 0 && lag + size > m_max_lag;
+}
+
+void BroadcastFIFO::Detach(Cursor* cursor) noexcept {
+	auto it = std::find(m_cursors.begin(), m_cursors.end(), cursor);
+	if (it == m_cursors.end())
+		return;
+	m_cursors.erase(it);
+	cursor->m_attached.store(false, std::memory_order_release);
+	Reclaim();
+}
+
+bool BroadcastFIFO::ReadInternal(const std::size_t&, DataType&, const Operation&) noexcept {
+	return false;
+}
+
+bool BroadcastFIFO::ReadInternal(const std::size_t&, WriteOnly&, const Operation&) noexcept {
+	return false;
+}
+
+void BroadcastFIFO::Reclaim() noexcept {
+	const std::size_t slowest = Slowest();
+	m_slowest.store(slowest, std::memory_order_release);
+	if (m_cursors.empty())
+		return;
+	m_chunks.Release(slowest);
+	m_retained.store(m_chunks.Size(), std::memory_order_release);
+}
+
+void BroadcastFIFO::SignalCursors() const noexcept {
+	std::vector<Waiter*> ready;
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		for (const Cursor* cursor: m_cursors)
+			cursor->CollectReady(ready);
+	}
+	for (Waiter* waiter: ready)
+		waiter->Wake();
+}
+
+std::size_t BroadcastFIFO::Slowest() const noexcept {
+	std::size_t slowest = m_chunks.End();
+	for (const Cursor* cursor: m_cursors)
+		slowest = std::min(slowest, cursor->m_cursor.load(std::memory_order_relaxed));
+	return slowest;
+}
+
+SharedFIFO::WriteStatus BroadcastFIFO::TryWrite(DataType& data) noexcept {
+	return Append(data, false);
+}
+
+bool BroadcastFIFO::WriteInternal(const std::size_t& count, const DataType& src) noexcept {
+	if (count > 0 && src.size() < count)
+		return false;
+	const std::size_t real_count = (count == 0) ? src.size() : count;
+	DataType data(src.begin(), src.begin() + real_count);
+	return Append(data, true) == WriteStatus::Written;
+}
+
+bool BroadcastFIFO::WriteInternal(const std::size_t& count, DataType&& src) noexcept {
+	if (count > 0 && src.size() < count)
+		return false;
+	if (count != 0 && count < src.size()) {
+		DataType data(std::make_move_iterator(src.begin()), std::make_move_iterator(src.begin() + count));
+		return Append(data, true) == WriteStatus::Written;
+	}
+	return Append(src, true) == WriteStatus::Written;
+}
\ No newline at end of file
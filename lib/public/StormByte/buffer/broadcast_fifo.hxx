@@ -0,0 +1,245 @@
+#pragma once
+
+#include <StormByte/buffer/chunk_queue.hxx>
+#include <StormByte/buffer/shared_fifo.hxx>
+
+#include <vector>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class BroadcastFIFO
+	 * @brief SharedFIFO that fans one stream out to many independent consumers.
+	 *
+	 * @par Overview
+	 *  Written chunks are stored once in a @ref ChunkQueue. Every Consumer obtained
+	 *  through Producer::Consumer() gets its own read cursor over that storage,
+	 *  so N readers see the full stream without N copies of the data. Copies of
+	 *  one Consumer share its cursor, as with a regular SharedFIFO.
+	 *
+	 * @par Reclamation
+	 *  Chunks are released as soon as every attached cursor has moved past them.
+	 *  From a cursor's point of view both Read() and Extract() consume bytes;
+	 *  Seek() can only move back over bytes still retained for slower cursors.
+	 *  A new Consumer starts at the oldest retained byte.
+	 *
+	 * @par Retention
+	 *  While no Consumer is attached, nothing is released: every byte written
+	 *  is kept for the first Consumer to come, whatever @c max_lag is, so a
+	 *  stream written before anyone subscribes is read whole. Such a buffer
+	 *  grows without bound until a Consumer attaches and reads, or until
+	 *  @ref Clear() is called; obtain the Consumers before writing when late
+	 *  subscribers are not wanted.
+	 *
+	 * @par Lag limits
+	 *  With a non-zero @c max_lag, a write that would leave some cursor more than
+	 *  @c max_lag bytes behind either blocks until that cursor catches up
+	 *  (@ref LagPolicy::Block) or detaches the cursor (@ref LagPolicy::Drop).
+	 *  A detached Consumer observes an error state. A cursor that has read
+	 *  everything never holds a write back, so writes larger than @c max_lag
+	 *  still go through. Non-blocking writes (Producer::WriteAsync()) never
+	 *  wait under @ref LagPolicy::Block: they are not admitted while the slowest
+	 *  cursor is too far behind, and suspend until it catches up.
+	 *
+	 * @par Usage
+	 * @code{.cpp}
+	 * Producer producer(std::make_shared<BroadcastFIFO>(1 << 20, LagPolicy::Block));
+	 * Consumer a = producer.Consumer();  // independent cursor
+	 * Consumer b = producer.Consumer();  // independent cursor
+	 * @endcode
+	 *
+	 * @par Thread safety
+	 *  All public member functions are thread-safe; cursors share this FIFO's mutex.
+	 *  The BroadcastFIFO itself is write-only: read through Consumers.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC BroadcastFIFO final: public SharedFIFO {
+		public:
+			/**
+			 * @brief Construct a BroadcastFIFO.
+			 * @param max_lag Maximum bytes a cursor may fall behind the writer; 0 disables the limit.
+			 * @param policy What to do when a write would exceed @p max_lag.
+			 */
+			BroadcastFIFO(const std::size_t& max_lag = 0, const LagPolicy& policy = LagPolicy::Block) noexcept;
+
+			/**
+			 * @brief Copy constructor deleted.
+			 */
+			BroadcastFIFO(const BroadcastFIFO&)						= delete;
+
+			/**
+			 * @brief Move constructor deleted; cursors refer to this instance.
+			 */
+			BroadcastFIFO(BroadcastFIFO&&)							= delete;
+
+			/**
+			 * @brief Destructor.
+			 */
+			~BroadcastFIFO() noexcept override						= default;
+
+			/**
+			 * @brief Copy assignment deleted.
+			 */
+			BroadcastFIFO& operator=(const BroadcastFIFO&)			= delete;
+
+			/**
+			 * @brief Move assignment deleted.
+			 */
+			BroadcastFIFO& operator=(BroadcastFIFO&&)				= delete;
+
+			/**
+			 * @brief No-op: bytes are released automatically once every cursor passed them.
+			 */
+			void 													Clean() noexcept override;
+
+			/**
+			 * @brief Release all retained bytes and move every cursor to the end of the stream.
+			 */
+			void 													Clear() noexcept override;
+
+			/**
+			 * @brief Close for further writes; every Consumer observes the close.
+			 */
+			void 													Close() noexcept override;
+
+			/**
+			 * @brief Unsupported on the writer side; read through Consumers.
+			 * @return Always false.
+			 */
+			bool 													Drop(const std::size_t& count) noexcept override;
+
+			/**
+			 * @brief Check whether no bytes are retained.
+			 * @return true if every retained byte has been released.
+			 */
+			bool 													Empty() const noexcept override;
+
+			/**
+			 * @brief Distance between the writer and the slowest attached cursor.
+			 * @return Number of bytes the slowest Consumer still has to read.
+			 */
+			std::size_t 											Lag() const noexcept;
+
+			/**
+			 * @brief Mark the stream as errored; every Consumer observes the error.
+			 */
+			void 													SetError() noexcept override;
+
+			/**
+			 * @brief Get the number of retained bytes.
+			 * @return Bytes written and not yet released.
+			 */
+			std::size_t 											Size() const noexcept override;
+
+			/**
+			 * @brief Get the number of attached cursors.
+			 * @return Number of live, non-detached Consumers.
+			 */
+			std::size_t 											Subscribers() const noexcept;
+
+		protected:
+			/**
+			 * @brief Create a new cursor for a Consumer.
+			 * @param self Shared pointer owning this BroadcastFIFO.
+			 * @return A per-consumer buffer reading from this FIFO's storage.
+			 */
+			std::shared_ptr<SharedFIFO> 							ConsumerView(std::shared_ptr<SharedFIFO> self) override;
+
+			/**
+			 * @brief Check without locking whether a write of @p n bytes passes the lag limit.
+			 * @param n Size of the write.
+			 * @return false only under @ref LagPolicy::Block, while the write would
+			 *         leave the slowest cursor more than @c max_lag bytes behind.
+			 */
+			bool 													Admits(const std::size_t& n) const noexcept override;
+
+			/**
+			 * @brief Write without waiting for the slowest cursor.
+			 * @param data Bytes to write; moved from only when written.
+			 * @return Full instead of blocking when @ref LagPolicy::Block holds the write back.
+			 */
+			WriteStatus 											TryWrite(DataType& data) noexcept override;
+
+		private:
+			class Cursor;											///< Per-consumer read cursor (defined in the implementation).
+
+			ChunkQueue m_chunks;									///< Shared storage.
+			std::vector<Cursor*> m_cursors;							///< Attached cursors.
+			std::atomic<std::size_t> m_end {0};						///< Published absolute end of the stream.
+			std::atomic<std::size_t> m_retained {0};				///< Published number of retained bytes.
+			std::atomic<std::size_t> m_slowest {0};					///< Published position of the slowest cursor (the end without cursors).
+			const std::size_t m_max_lag;							///< Lag limit in bytes (0: unlimited).
+			const LagPolicy m_policy;								///< Lag limit policy.
+
+			/**
+			 * @brief Append a chunk, enforcing the lag limit.
+			 * @param data Chunk to store; moved from only when written.
+			 * @param wait Whether to wait for the slowest cursor under @ref LagPolicy::Block.
+			 * @return Written, Full when it would have to wait and @p wait is false,
+			 *         or Rejected if closed or errored.
+			 */
+			WriteStatus 											Append(DataType& data, const bool& wait) noexcept;
+
+			/**
+			 * @brief Check whether a write would leave a cursor too far behind. Requires @c m_mutex.
+			 * @param position Cursor position.
+			 * @param size Size of the write.
+			 * @return true if the cursor has bytes left and the write exceeds @c max_lag.
+			 */
+			bool 													Exceeds(const std::size_t& position, const std::size_t& size) const noexcept;
+
+			/**
+			 * @brief Detach a cursor and release what it held back. Requires @c m_mutex.
+			 * @param cursor Cursor to detach.
+			 */
+			void 													Detach(Cursor* cursor) noexcept;
+
+			/**
+			 * @brief Unsupported: read through Consumers.
+			 * @return Always false.
+			 */
+			bool 													ReadInternal(const std::size_t& count, DataType& outBuffer, const Operation& flag) noexcept override;
+
+			/**
+			 * @brief Unsupported: read through Consumers.
+			 * @return Always false.
+			 */
+			bool 													ReadInternal(const std::size_t& count, WriteOnly& outBuffer, const Operation& flag) noexcept override;
+
+			/**
+			 * @brief Release every byte all cursors have passed and publish the
+			 *        slowest position. Requires @c m_mutex.
+			 */
+			void 													Reclaim() noexcept;
+
+			/**
+			 * @brief Wake the asynchronous waiters of every cursor that became ready.
+			 *        Called after a state change, with @c m_mutex released.
+			 */
+			void 													SignalCursors() const noexcept;
+
+			/**
+			 * @brief Position of the slowest attached cursor. Requires @c m_mutex.
+			 * @return Smallest cursor position, or the stream end without cursors.
+			 */
+			std::size_t 											Slowest() const noexcept;
+
+			/**
+			 * @brief Store a copy of @p count bytes of @p src.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													WriteInternal(const std::size_t& count, const DataType& src) noexcept override;
+
+			/**
+			 * @brief Store @p src, moving it when the whole vector is written.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													WriteInternal(const std::size_t& count, DataType&& src) noexcept override;
+	};
+}
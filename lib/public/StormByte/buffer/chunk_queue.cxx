@@ -0,0 +1,92 @@
+#include <StormByte/buffer/chunk_queue.hxx>
+
+#include <algorithm>
+
+using namespace StormByte::Buffer;
+
+std::size_t ChunkQueue::ChunkEnd(const std::size_t& position) const noexcept {
+	const Chunk& chunk = m_chunks[Locate(position)];
+	return chunk.start + chunk.data.size();
+}
+
+std::size_t ChunkQueue::Chunks(const std::size_t& position) const noexcept {
+	if (position >= m_end)
+		return 0;
+	return m_chunks.size() - Locate(std::max(position, m_begin));
+}
+
+void ChunkQueue::Clear() noexcept {
+	m_chunks.clear();
+	m_begin = m_end;
+}
+
+bool ChunkQueue::Copy(const std::size_t& position, const std::size_t& count, DataType& out) const noexcept {
+	if (position < m_begin || position + count > m_end)
+		return false;
+	if (count == 0)
+		return true;
+
+	out.reserve(out.size() + count);
+	std::size_t index = Locate(position);
+	std::size_t offset = position - m_chunks[index].start;
+	std::size_t remaining = count;
+	while (remaining > 0) {
+		const DataType& data = m_chunks[index].data;
+		const std::size_t take = std::min(remaining, data.size() - offset);
+		out.insert(out.end(), data.begin() + offset, data.begin() + offset + take);
+		remaining -= take;
+		offset = 0;
+		++index;
+	}
+	return true;
+}
+
+std::size_t ChunkQueue::FrontSize() const noexcept {
+	if (m_chunks.empty())
+		return 0;
+	const Chunk& front = m_chunks.front();
+	return front.start + front.data.size() - m_begin;
+}
+
+bool ChunkQueue::Pop(DataType& out) noexcept {
+	if (m_chunks.empty())
+		return false;
+	Chunk& front = m_chunks.front();
+	const std::size_t skip = m_begin - front.start;
+	if (skip > 0)
+		front.data.erase(front.data.begin(), front.data.begin() + skip);
+	out = std::move(front.data);
+	m_begin = front.start + skip + out.size();
+	m_chunks.pop_front();
+	return true;
+}
+
+void ChunkQueue::Push(const DataType& data, const std::size_t& count) {
+	const std::size_t real_count = (count == 0 || count > data.size()) ? data.size() : count;
+	if (real_count == 0)
+		return;
+	m_chunks.push_back({ m_end, DataType(data.begin(), data.begin() + real_count) });
+	m_end += real_count;
+}
+
+void ChunkQueue::Push(DataType&& data) {
+	if (data.empty())
+		return;
+	const std::size_t size = data.size();
+	m_chunks.push_back({ m_end, std::move(data) });
+	m_end += size;
+}
+
+void ChunkQueue::Release(const std::size_t& position) noexcept {
+	const std::size_t target = std::clamp(position, m_begin, m_end);
+	while (!m_chunks.empty() && m_chunks.front().start + m_chunks.front().data.size() <= target)
+		m_chunks.pop_front();
+	m_begin = target;
+}
+
+std::size_t ChunkQueue::Locate(const std::size_t& position) const noexcept {
+	// Chunks are sorted by start offset: find the last one starting at or before position
+	auto it = std::upper_bound(m_chunks.begin(), m_chunks.end(), position,
+		[](const std::size_t& pos, const Chunk& chunk) { return pos < chunk.start; });
+	return static_cast<std::size_t>(std::distance(m_chunks.begin(), it)) - 1;
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <StormByte/buffer/typedefs.hxx>
+
+#include <deque>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class ChunkQueue
+	 * @brief Queue of byte chunks addressed by absolute stream offsets.
+	 *
+	 * @par Overview
+	 *  ChunkQueue stores written @c DataType chunks as they are (moved in, never
+	 *  flattened) and addresses their bytes by absolute stream offsets: the first
+	 *  byte ever pushed is offset 0 and offsets keep growing as chunks are pushed,
+	 *  even after older bytes are released. This lets several readers keep their
+	 *  own positions over a single copy of the data and lets whole chunks be
+	 *  handed back out without copying.
+	 *
+	 * @par Thread safety
+	 *  This class is **not thread-safe**. It is the storage building block of the
+	 *  chunked SharedFIFO variants, which guard it with their own mutex.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC ChunkQueue final {
+		public:
+			/**
+			 * @brief Construct an empty ChunkQueue.
+			 */
+			ChunkQueue() noexcept										= default;
+
+			/**
+			 * @brief Copy constructor.
+			 */
+			ChunkQueue(const ChunkQueue&)								= default;
+
+			/**
+			 * @brief Move constructor.
+			 */
+			ChunkQueue(ChunkQueue&&) noexcept							= default;
+
+			/**
+			 * @brief Destructor.
+			 */
+			~ChunkQueue() noexcept										= default;
+
+			/**
+			 * @brief Copy assignment operator.
+			 */
+			ChunkQueue& operator=(const ChunkQueue&)					= default;
+
+			/**
+			 * @brief Move assignment operator.
+			 */
+			ChunkQueue& operator=(ChunkQueue&&) noexcept				= default;
+
+			/**
+			 * @brief Absolute offset of the first retained byte.
+			 * @return Offset of the oldest byte not yet released.
+			 */
+			inline std::size_t 											Begin() const noexcept {
+				return m_begin;
+			}
+
+			/**
+			 * @brief End of the chunk holding a byte.
+			 * @param position Absolute offset inside [@ref Begin(), @ref End()).
+			 * @return Absolute offset one past the last byte of that chunk.
+			 */
+			std::size_t 												ChunkEnd(const std::size_t& position) const noexcept;
+
+			/**
+			 * @brief Number of chunks currently stored.
+			 * @return Number of chunks holding at least one retained byte.
+			 */
+			inline std::size_t 											Chunks() const noexcept {
+				return m_chunks.size();
+			}
+
+			/**
+			 * @brief Number of chunks holding bytes at or after a position.
+			 * @param position Absolute offset.
+			 * @return Stored chunks ending after @p position.
+			 */
+			std::size_t 												Chunks(const std::size_t& position) const noexcept;
+
+			/**
+			 * @brief Release every chunk.
+			 * @details Offsets keep growing: @ref Begin() becomes @ref End().
+			 */
+			void 														Clear() noexcept;
+
+			/**
+			 * @brief Append bytes from the stored range into @p out.
+			 * @param position Absolute offset of the first byte to copy.
+			 * @param count Number of bytes to copy.
+			 * @param out Vector the bytes are appended to.
+			 * @return false if the range is not fully retained, true otherwise.
+			 */
+			bool 														Copy(const std::size_t& position, const std::size_t& count, DataType& out) const noexcept;
+
+			/**
+			 * @brief Check whether no bytes are retained.
+			 * @return true if @ref Begin() equals @ref End().
+			 */
+			inline bool 												Empty() const noexcept {
+				return m_begin == m_end;
+			}
+
+			/**
+			 * @brief Absolute offset one past the last pushed byte.
+			 * @return Total number of bytes ever pushed.
+			 */
+			inline std::size_t 											End() const noexcept {
+				return m_end;
+			}
+
+			/**
+			 * @brief Size of the remaining part of the front chunk.
+			 * @return Number of retained bytes in the oldest chunk, 0 if empty.
+			 */
+			std::size_t 												FrontSize() const noexcept;
+
+			/**
+			 * @brief Remove the remaining part of the front chunk.
+			 * @param out Receives the chunk. When the chunk was not partially released
+			 *        it is moved out unchanged (no copy).
+			 * @return false if the queue is empty, true otherwise.
+			 */
+			bool 														Pop(DataType& out) noexcept;
+
+			/**
+			 * @brief Append a chunk by copy.
+			 * @param data Source bytes.
+			 * @param count Number of bytes to take from the front of @p data; 0 takes all.
+			 */
+			void 														Push(const DataType& data, const std::size_t& count = 0);
+
+			/**
+			 * @brief Append a chunk by move.
+			 * @param data Chunk to store as is. Empty chunks are ignored.
+			 */
+			void 														Push(DataType&& data);
+
+			/**
+			 * @brief Release every byte before @p position.
+			 * @param position Absolute offset; clamped to [@ref Begin(), @ref End()].
+			 * @details Chunks entirely before @p position are freed; a partially
+			 *          released front chunk is kept until it is fully passed.
+			 */
+			void 														Release(const std::size_t& position) noexcept;
+
+			/**
+			 * @brief Number of retained bytes.
+			 * @return @ref End() minus @ref Begin().
+			 */
+			inline std::size_t 											Size() const noexcept {
+				return m_end - m_begin;
+			}
+
+		private:
+			/**
+			 * @brief Stored chunk together with its absolute start offset.
+			 */
+			struct Chunk {
+				std::size_t start;										///< Absolute offset of data[0].
+				DataType data;											///< Chunk bytes.
+			};
+
+			std::deque<Chunk> m_chunks;									///< Stored chunks, oldest first.
+			std::size_t m_begin {0};									///< Absolute offset of the first retained byte.
+			std::size_t m_end {0};										///< Absolute offset one past the last byte.
+
+			/**
+			 * @brief Find the chunk holding @p position.
+			 * @param position Absolute offset inside [@ref Begin(), @ref End()).
+			 * @return Index into @c m_chunks.
+			 */
+			std::size_t 												Locate(const std::size_t& position) const noexcept;
+	};
+}
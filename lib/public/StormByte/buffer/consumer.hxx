@@ -1,5 +1,6 @@
 #pragma once
 
+#include <StormByte/buffer/async.hxx>
 #include <StormByte/buffer/shared_fifo.hxx>
 
 #include <memory>
@@ -36,6 +37,12 @@ namespace StormByte::Buffer {
 	 *    or the buffer becomes unreadable (closed or error). If count is 0, returns
 	 *    all available data immediately and clears the buffer.
 	 *
+	 * @par Asynchronous reads
+	 *  @ref ReadAsync(), @ref ReadSomeAsync(), @ref ExtractAsync() and
+	 *  @ref ExtractSomeAsync() return awaitables for use in coroutines: instead of
+	 *  blocking, the coroutine is suspended and resumed by the writer (or by the
+	 *  given @ref Executor) once the bytes are available.
+	 *
 	 * @par Producer-Consumer relationship
 	 *  Consumer instances cannot be created directly. They must be obtained from
 	 *  a Producer using Producer::Consumer(). This ensures proper buffer sharing
@@ -108,6 +115,14 @@ namespace StormByte::Buffer {
 				return !(*this == other);
 			}
 
+			/**
+			 * @brief Clear the readable descriptor, setting it again if still readable.
+			 * @see ReadableDescriptor(), SharedFIFO::AcknowledgeReadable()
+			 */
+			inline void 												AcknowledgeReadable() const noexcept {
+				m_buffer->AcknowledgeReadable();
+			}
+
 			/**
 			 * @brief Gets available bytes for reading.
 			 * @return Number of bytes available from the current read position.
@@ -163,6 +178,25 @@ namespace StormByte::Buffer {
 				return m_buffer->Empty();
 			}
 
+			/**
+			 * @brief Start counting traffic and blocked time on the shared buffer.
+			 * @see SharedFIFO::EnableStatistics(), Statistics()
+			 */
+			inline void 												EnableStatistics() const noexcept {
+				m_buffer->EnableStatistics();
+			}
+
+			/**
+			 * @brief Record the shared buffer's events to @p tracer.
+			 * @param tracer Tracer receiving the events.
+			 * @param id Buffer id the events carry.
+			 * @return false if the buffer already has a tracer or @p tracer is null.
+			 * @see SharedFIFO::EnableTracing()
+			 */
+			inline bool 												EnableTracing(std::shared_ptr<Tracer> tracer, const std::uint32_t& id) const noexcept {
+				return m_buffer->EnableTracing(std::move(tracer), id);
+			}
+
 			/**
 			 * @brief Check if the reader has reached end-of-file.
 			 * @return true if buffer is closed or in error state and no bytes available.
@@ -194,6 +228,43 @@ namespace StormByte::Buffer {
 				return m_buffer->Extract(count, outBuffer);
 			}
 
+			/**
+			 * @brief Blocking destructive read of the next message.
+			 * @param outBuffer Replaced with the message bytes.
+			 * @return false if no message became available (closed or error), true otherwise.
+			 * @details With a @ref MessageFIFO each message is one write, handed over by
+			 *          move. Other buffers return every byte available.
+			 * @see SharedFIFO::ExtractMessage()
+			 */
+			inline bool 												ExtractMessage(DataType& outBuffer) noexcept {
+				return m_buffer->ExtractMessage(outBuffer);
+			}
+
+			/**
+			 * @brief Asynchronous @ref Extract() that suspends instead of blocking.
+			 * @param count Number of bytes to extract; 0 extracts all available once at least one byte is.
+			 * @param outBuffer Vector to fill with extracted bytes; must outlive the awaitable.
+			 * @param executor Executor resuming the coroutine; null resumes in the writing thread.
+			 * @return Awaitable yielding the bool @ref Extract() would return.
+			 * @see ReadAsync()
+			 */
+			inline ReadAwaitable 										ExtractAsync(const std::size_t& count, DataType& outBuffer, std::shared_ptr<Executor> executor = nullptr) noexcept {
+				return { m_buffer, count, false, true, outBuffer, std::move(executor) };
+			}
+
+			/**
+			 * @brief Asynchronous extract of whatever is available, up to @p max bytes.
+			 * @param max Maximum bytes to extract; 0 for no maximum.
+			 * @param outBuffer Vector to fill with extracted bytes; must outlive the awaitable.
+			 * @param executor Executor resuming the coroutine; null resumes in the writing thread.
+			 * @return Awaitable yielding true once at least one byte was extracted, false
+			 *         if the buffer was closed empty or errored.
+			 * @see ReadSomeAsync()
+			 */
+			inline ReadAwaitable 										ExtractSomeAsync(const std::size_t& max, DataType& outBuffer, std::shared_ptr<Executor> executor = nullptr) noexcept {
+				return { m_buffer, max, true, true, outBuffer, std::move(executor) };
+			}
+
 			/**
 			 * @brief Read all bytes until end-of-file into an existing buffer.
 			 * @param outBuffer Vector to fill with read bytes; resized as needed.
@@ -240,6 +311,52 @@ namespace StormByte::Buffer {
 				return m_buffer->HasError();
 			}
 
+			/**
+			 * @brief Byte limit of the buffer's bounded mode.
+			 * @return Maximum unread bytes before writers wait; 0 if unbounded.
+			 * @see SharedFIFO::Limit()
+			 */
+			inline std::size_t 											Limit() const noexcept {
+				return m_buffer->Limit();
+			}
+
+			/**
+			 * @brief Call @p callback once the buffer is closed.
+			 * @param callback Callback to run once.
+			 * @param executor Executor to post the callback to (null: run it in the closing thread).
+			 * @return Callback id for @ref RemoveCallback().
+			 * @see SharedFIFO::OnClosed()
+			 */
+			inline std::size_t 											OnClosed(SharedFIFO::Callback callback, std::shared_ptr<Executor> executor = nullptr) const noexcept {
+				return m_buffer->OnClosed(std::move(callback), std::move(executor));
+			}
+
+			/**
+			 * @brief Call @p callback once the buffer enters the error state.
+			 * @param callback Callback to run once.
+			 * @param executor Executor to post the callback to (null: run it in the signalling thread).
+			 * @return Callback id for @ref RemoveCallback().
+			 * @see SharedFIFO::OnError()
+			 */
+			inline std::size_t 											OnError(SharedFIFO::Callback callback, std::shared_ptr<Executor> executor = nullptr) const noexcept {
+				return m_buffer->OnError(std::move(callback), std::move(executor));
+			}
+
+			/**
+			 * @brief Call @p callback when at least @p min_bytes can be read, or at end of stream.
+			 * @param min_bytes Bytes that must be available (0 behaves as 1).
+			 * @param callback Callback to run.
+			 * @param persistent Keep the callback armed after it fired.
+			 * @param executor Executor to post the callback to (null: run it in the writing thread).
+			 * @return Callback id for @ref RemoveCallback().
+			 * @details Lets a reactor drive many consumers without blocking a thread on
+			 *          each: read without blocking (up to @ref AvailableBytes()) from the callback.
+			 * @see SharedFIFO::OnReadable()
+			 */
+			inline std::size_t 											OnReadable(const std::size_t& min_bytes, SharedFIFO::Callback callback, const bool& persistent = false, std::shared_ptr<Executor> executor = nullptr) const noexcept {
+				return m_buffer->OnReadable(min_bytes, std::move(callback), persistent, std::move(executor));
+			}
+
 			/**
 			 * @brief Read bytes into an existing buffer.
 			 * @param count Number of bytes to read; 0 reads all available from read position.
@@ -260,6 +377,45 @@ namespace StormByte::Buffer {
 				return m_buffer->Read(count, outBuffer);
 			}
 
+			/**
+			 * @brief Blocking read of the next message, advancing the read position.
+			 * @param outBuffer Replaced with the message bytes.
+			 * @return false if no message became available (closed or error), true otherwise.
+			 * @see SharedFIFO::ReadMessage()
+			 */
+			inline bool 												ReadMessage(DataType& outBuffer) const noexcept {
+				return m_buffer->ReadMessage(outBuffer);
+			}
+
+			/**
+			 * @brief Asynchronous @ref Read() that suspends instead of blocking.
+			 * @param count Number of bytes to read; 0 reads all available once at least one byte is.
+			 * @param outBuffer Vector to fill with read bytes; must outlive the awaitable.
+			 * @param executor Executor resuming the coroutine; null resumes in the writing thread.
+			 * @return Awaitable yielding the bool @ref Read() would return.
+			 * @details @code
+			 *          DataType header;
+			 *          if (!co_await consumer.ReadAsync(16, header))
+			 *              co_return;
+			 *          @endcode
+			 * @see AsyncOperation
+			 */
+			inline ReadAwaitable 										ReadAsync(const std::size_t& count, DataType& outBuffer, std::shared_ptr<Executor> executor = nullptr) const noexcept {
+				return { m_buffer, count, false, false, outBuffer, std::move(executor) };
+			}
+
+			/**
+			 * @brief Asynchronous read of whatever is available, up to @p max bytes.
+			 * @param max Maximum bytes to read; 0 for no maximum.
+			 * @param outBuffer Vector to fill with read bytes; must outlive the awaitable.
+			 * @param executor Executor resuming the coroutine; null resumes in the writing thread.
+			 * @return Awaitable yielding true once at least one byte was read, false if the
+			 *         buffer was closed with nothing left or errored.
+			 */
+			inline ReadAwaitable 										ReadSomeAsync(const std::size_t& max, DataType& outBuffer, std::shared_ptr<Executor> executor = nullptr) const noexcept {
+				return { m_buffer, max, true, false, outBuffer, std::move(executor) };
+			}
+
 			/**
 			 * @brief Read all bytes until end-of-file into an existing buffer.
 			 * @param outBuffer Vector to fill with read bytes; resized as needed.
@@ -276,6 +432,27 @@ namespace StormByte::Buffer {
 				m_buffer->ReadUntilEoF(outBuffer);
 			}
 
+			/**
+			 * @brief Descriptor that polls readable while bytes can be read, or at end of stream.
+			 * @return File descriptor for poll/epoll, or -1 if unsupported on this platform.
+			 * @details Lets one poll/epoll thread service many consumers next to sockets.
+			 *          Owned by the buffer; do not close it.
+			 * @see AcknowledgeReadable(), SharedFIFO::ReadableDescriptor()
+			 */
+			inline int 													ReadableDescriptor() const noexcept {
+				return m_buffer->ReadableDescriptor();
+			}
+
+			/**
+			 * @brief Unregister a readiness callback.
+			 * @param id Id returned when registering.
+			 * @return false if the id is unknown (already fired one-shot or removed).
+			 * @see SharedFIFO::RemoveCallback()
+			 */
+			inline bool 												RemoveCallback(const std::size_t& id) const noexcept {
+				return m_buffer->RemoveCallback(id);
+			}
+
 			/**
 			 * @brief Non-destructive peek at buffer data without advancing read position.
 			 * @param count Number of bytes to peek; 0 peeks all available from read position.
@@ -340,6 +517,15 @@ namespace StormByte::Buffer {
 				return m_buffer->Size();
 			}
 
+			/**
+			 * @brief Read the shared buffer's counters.
+			 * @return Counters; all zero until statistics are enabled.
+			 * @see SharedFIFO::Statistics()
+			 */
+			inline SharedFIFO::Counters 								Statistics() const noexcept {
+				return m_buffer->Statistics();
+			}
+
 		private:
 			std::shared_ptr<SharedFIFO> m_buffer;						///< Underlying shared FIFO buffer.
 
@@ -0,0 +1,164 @@
+#include <StormByte/buffer/consumer_set.hxx>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+using namespace StormByte::Buffer;
+
+struct ConsumerSet::State {
+	struct Member {
+		Consumer consumer;											///< Watched consumer.
+		std::size_t min_bytes;										///< Bytes that make it ready.
+		std::size_t callback {0};									///< Readiness callback id.
+		bool queued {false};										///< Already in the ready-list.
+
+		bool Ready() const noexcept {
+			return !consumer.IsWritable() || consumer.AvailableBytes() >= min_bytes;
+		}
+	};
+
+	std::mutex mutex;												///< Protects everything below.
+	std::condition_variable cv;										///< Signalled when the ready-list grows.
+	std::unordered_map<std::size_t, Member> members;				///< Members by id.
+	std::deque<std::size_t> ready;									///< Members that may be ready.
+	std::vector<std::size_t> reported;								///< Members returned by the last Select().
+	std::size_t next {0};											///< Next member id.
+
+	void Queue(const std::size_t& id) noexcept {
+		{
+			std::scoped_lock<std::mutex> lock(mutex);
+			auto it = members.find(id);
+			if (it == members.end() || it->second.queued)
+				return;
+			it->second.queued = true;
+			ready.push_back(id);
+		}
+		cv.notify_one();
+	}
+};
+
+ConsumerSet::ConsumerSet() noexcept: m_state(std::make_shared<State>()) {}
+
+ConsumerSet::~ConsumerSet() noexcept {
+	if (!m_state)
+		return;
+	std::unordered_map<std::size_t, State::Member> members;
+	{
+		std::scoped_lock<std::mutex> lock(m_state->mutex);
+		members.swap(m_state->members);
+	}
+	for (const auto& [id, member]: members)
+		(void)member.consumer.RemoveCallback(member.callback);
+}
+
+std::size_t ConsumerSet::Add(const Consumer& consumer, const std::size_t& min_bytes) noexcept {
+	std::size_t id;
+	{
+		std::scoped_lock<std::mutex> lock(m_state->mutex);
+		id = m_state->next++;
+		m_state->members.emplace(id, State::Member { consumer, std::max<std::size_t>(min_bytes, 1) });
+	}
+	// Registered unlocked: a consumer that is already ready calls back right away
+	std::weak_ptr<State> state = m_state;
+	const std::size_t callback = consumer.OnReadable(min_bytes, [state, id]() {
+		if (auto locked = state.lock())
+			locked->Queue(id);
+	}, true);
+	bool removed;
+	{
+		std::scoped_lock<std::mutex> lock(m_state->mutex);
+		auto it = m_state->members.find(id);
+		removed = it == m_state->members.end();
+		if (!removed)
+			it->second.callback = callback;
+	}
+	if (removed)
+		(void)consumer.RemoveCallback(callback);
+	return id;
+}
+
+bool ConsumerSet::Empty() const noexcept {
+	std::scoped_lock<std::mutex> lock(m_state->mutex);
+	return m_state->members.empty();
+}
+
+bool ConsumerSet::Remove(const std::size_t& id) noexcept {
+	std::unique_lock<std::mutex> lock(m_state->mutex);
+	auto it = m_state->members.find(id);
+	if (it == m_state->members.end())
+		return false;
+	State::Member member = std::move(it->second);
+	m_state->members.erase(it);
+	lock.unlock();
+	// Stale ready-list entries are skipped by Wait(); wake it if the set emptied
+	m_state->cv.notify_all();
+	(void)member.consumer.RemoveCallback(member.callback);
+	return true;
+}
+
+std::vector<std::size_t> ConsumerSet::Select() noexcept {
+	return Wait(nullptr, nullptr);
+}
+
+std::vector<std::size_t> ConsumerSet::Select(const std::chrono::milliseconds& timeout) noexcept {
+	const auto deadline = std::chrono::steady_clock::now() + timeout;
+	return Wait(&deadline, nullptr);
+}
+
+std::vector<std::size_t> ConsumerSet::Select(const std::stop_token& stop) noexcept {
+	// Locks before notifying: a Wait() that checked the token is asleep by then.
+	// The callback is unregistered before returning, so the state outlives it.
+	State* state = m_state.get();
+	const std::stop_callback wake(stop, [state]() {
+		{
+			std::scoped_lock<std::mutex> lock(state->mutex);
+		}
+		state->cv.notify_all();
+	});
+	return Wait(nullptr, &stop);
+}
+
+std::size_t ConsumerSet::Size() const noexcept {
+	std::scoped_lock<std::mutex> lock(m_state->mutex);
+	return m_state->members.size();
+}
+
+std::vector<std::size_t> ConsumerSet::Wait(const std::chrono::steady_clock::time_point* deadline, const std::stop_token* stop) noexcept {
+	std::vector<std::size_t> result;
+	std::unique_lock<std::mutex> lock(m_state->mutex);
+	// Level-triggered: what was ready last time is checked again, since no
+	// callback fires for bytes that were already there
+	for (const std::size_t& id: m_state->reported) {
+		auto it = m_state->members.find(id);
+		if (it != m_state->members.end() && !it->second.queued) {
+			it->second.queued = true;
+			m_state->ready.push_front(id);
+		}
+	}
+	m_state->reported.clear();
+
+	while (!m_state->members.empty()) {
+		while (!m_state->ready.empty()) {
+			const std::size_t id = m_state->ready.front();
+			m_state->ready.pop_front();
+			auto it = m_state->members.find(id);
+			if (it == m_state->members.end())
+				continue;
+			// Dequeued before checking: a change from now on queues it again
+			it->second.queued = false;
+			if (it->second.Ready())
+				result.push_back(id);
+		}
+		if (!result.empty() || (stop && stop->stop_requested()))
+			break;
+		if (!deadline)
+			m_state->cv.wait(lock);
+		else if (m_state->cv.wait_until(lock, *deadline) == std::cv_status::timeout && m_state->ready.empty())
+			break;
+	}
+	m_state->reported = result;
+	return result;
+}
\ No newline at end of file
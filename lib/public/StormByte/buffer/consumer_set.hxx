@@ -0,0 +1,135 @@
+#pragma once
+
+#include <StormByte/buffer/consumer.hxx>
+
+#include <chrono>
+#include <memory>
+#include <stop_token>
+#include <vector>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class ConsumerSet
+	 * @brief Waits on many consumers at once, like @c poll() does on descriptors.
+	 *
+	 * @par Overview
+	 *  Consumers are added with the number of bytes that makes each of them ready.
+	 *  @ref Select() blocks until at least one member is ready and returns the ids
+	 *  of the ready members. A member is ready when it has at least its minimum
+	 *  bytes available, is closed, or is in error.
+	 *
+	 * @par Complexity
+	 *  Every member feeds a shared ready-list through a persistent readiness
+	 *  callback (see SharedFIFO::OnReadable()), so a wakeup costs the number of
+	 *  members that changed, not the number of members. Members returned by a
+	 *  Select() are checked again by the next one (level-triggered): a member
+	 *  that was not fully drained, or that reached end of stream, keeps being
+	 *  reported until it is drained or removed.
+	 *
+	 * @par Thread safety
+	 *  Add(), Remove() and Select() may be called from any thread, but only one
+	 *  thread should Select() at a time: concurrent callers share the ready-list.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC ConsumerSet final {
+		public:
+			/**
+			 * @brief Create an empty set.
+			 */
+			ConsumerSet() noexcept;
+
+			/**
+			 * @brief Copy constructor deleted.
+			 */
+			ConsumerSet(const ConsumerSet&)									= delete;
+
+			/**
+			 * @brief Move constructor.
+			 */
+			ConsumerSet(ConsumerSet&&) noexcept								= default;
+
+			/**
+			 * @brief Destructor; unregisters from every member.
+			 */
+			~ConsumerSet() noexcept;
+
+			/**
+			 * @brief Copy assignment deleted.
+			 */
+			ConsumerSet& operator=(const ConsumerSet&)						= delete;
+
+			/**
+			 * @brief Move assignment deleted.
+			 */
+			ConsumerSet& operator=(ConsumerSet&&)							= delete;
+
+			/**
+			 * @brief Add a consumer to the set.
+			 * @param consumer Consumer to watch.
+			 * @param min_bytes Bytes that make it ready (0 behaves as 1).
+			 * @return Member id, assigned in order starting at 0.
+			 */
+			std::size_t 													Add(const Consumer& consumer, const std::size_t& min_bytes = 1) noexcept;
+
+			/**
+			 * @brief Check if the set has no members.
+			 * @return true if empty.
+			 */
+			bool 															Empty() const noexcept;
+
+			/**
+			 * @brief Remove a member.
+			 * @param id Member id returned by @ref Add().
+			 * @return true if it was a member.
+			 */
+			bool 															Remove(const std::size_t& id) noexcept;
+
+			/**
+			 * @brief Wait until at least one member is ready.
+			 * @return Ids of the ready members; empty only when the set is empty.
+			 */
+			std::vector<std::size_t> 										Select() noexcept;
+
+			/**
+			 * @brief Wait until at least one member is ready or @p timeout elapses.
+			 * @param timeout Maximum time to wait.
+			 * @return Ids of the ready members; empty on timeout or when the set is empty.
+			 */
+			std::vector<std::size_t> 										Select(const std::chrono::milliseconds& timeout) noexcept;
+
+			/**
+			 * @brief Wait until at least one member is ready or stop is requested on @p stop.
+			 * @param stop Stop token, for instance the one a CancellablePipeFunction receives.
+			 * @return Ids of the ready members; empty if stop is requested while none is ready or when the set is empty.
+			 * @details Lets a stage wait for input it does not own and still return
+			 *          as soon as its run is cancelled.
+			 */
+			std::vector<std::size_t> 										Select(const std::stop_token& stop) noexcept;
+
+			/**
+			 * @brief Number of members.
+			 * @return Member count.
+			 */
+			std::size_t 													Size() const noexcept;
+
+		private:
+			struct State;													///< Ready-list shared with the member callbacks.
+
+			std::shared_ptr<State> m_state;									///< Members and ready-list.
+
+			/**
+			 * @brief Common implementation of the Select() overloads.
+			 * @param deadline Time to give up at, if any.
+			 * @param stop Stop token to give up on, if any.
+			 * @return Ids of the ready members.
+			 */
+			std::vector<std::size_t> 										Wait(const std::chrono::steady_clock::time_point* deadline, const std::stop_token* stop) noexcept;
+	};
+}
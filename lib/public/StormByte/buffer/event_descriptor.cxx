@@ -0,0 +1,61 @@
+#include <StormByte/buffer/event_descriptor.hxx>
+
+#include <cstdint>
+
+#ifdef LINUX
+#include <sys/eventfd.h>
+#include <unistd.h>
+#elif !defined(WINDOWS)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace StormByte::Buffer;
+
+EventDescriptor::EventDescriptor() noexcept {
+	#ifdef LINUX
+	m_read = m_write = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	#elif !defined(WINDOWS)
+	int fds[2];
+	if (::pipe(fds) == 0) {
+		for (int fd: fds) {
+			::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+			::fcntl(fd, F_SETFD, FD_CLOEXEC);
+		}
+		m_read = fds[0];
+		m_write = fds[1];
+	}
+	#endif
+}
+
+EventDescriptor::~EventDescriptor() noexcept {
+	#ifndef WINDOWS
+	if (m_write != -1 && m_write != m_read)
+		::close(m_write);
+	if (m_read != -1)
+		::close(m_read);
+	#endif
+}
+
+void EventDescriptor::Clear() noexcept {
+	if (m_read == -1 || !m_set.load(std::memory_order_acquire))
+		return;
+	#ifndef WINDOWS
+	// Non-blocking: drain whatever was written, eventfd counter or pipe bytes
+	std::uint64_t buffer;
+	while (::read(m_read, &buffer, sizeof(buffer)) > 0) {}
+	#endif
+	// Only after draining: a Set() racing with the drain must not leave the
+	// flag set with no token behind it. One that lands before this store is
+	// lost, which the callers' re-check after Clear() makes up for.
+	m_set.store(false, std::memory_order_release);
+}
+
+void EventDescriptor::Set() noexcept {
+	if (m_write == -1 || m_set.exchange(true, std::memory_order_acq_rel))
+		return;
+	#ifndef WINDOWS
+	const std::uint64_t one = 1;
+	(void)!::write(m_write, &one, sizeof(one));
+	#endif
+}
\ No newline at end of file
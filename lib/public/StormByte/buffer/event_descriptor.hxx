@@ -0,0 +1,85 @@
+#pragma once
+
+#include <StormByte/buffer/visibility.h>
+
+#include <atomic>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class EventDescriptor
+	 * @brief File descriptor that a poll/epoll loop can wait on, set and cleared by the library.
+	 *
+	 * @par Overview
+	 *  Backed by a non-blocking @c eventfd on Linux and by a non-blocking pipe on
+	 *  other POSIX systems. The descriptor polls readable while set. It is not
+	 *  available on Windows, where @ref Handle() returns -1.
+	 *
+	 * @par Thread safety
+	 *  @ref Set() and @ref Clear() may be called concurrently from any thread.
+	 *  A concurrent Set() and Clear() may leave the descriptor readable once more
+	 *  than needed, never the opposite.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC EventDescriptor final {
+		public:
+			/**
+			 * @brief Create a cleared descriptor.
+			 */
+			EventDescriptor() noexcept;
+
+			/**
+			 * @brief Copy constructor deleted.
+			 */
+			EventDescriptor(const EventDescriptor&)					= delete;
+
+			/**
+			 * @brief Move constructor deleted.
+			 */
+			EventDescriptor(EventDescriptor&&)						= delete;
+
+			/**
+			 * @brief Destructor; closes the descriptor.
+			 */
+			~EventDescriptor() noexcept;
+
+			/**
+			 * @brief Copy assignment deleted.
+			 */
+			EventDescriptor& operator=(const EventDescriptor&)		= delete;
+
+			/**
+			 * @brief Move assignment deleted.
+			 */
+			EventDescriptor& operator=(EventDescriptor&&)			= delete;
+
+			/**
+			 * @brief Make the descriptor poll unreadable.
+			 */
+			void 													Clear() noexcept;
+
+			/**
+			 * @brief Descriptor to register in a poll/epoll set (for reading).
+			 * @return The descriptor, or -1 if it could not be created or is unsupported.
+			 */
+			inline int 												Handle() const noexcept {
+				return m_read;
+			}
+
+			/**
+			 * @brief Make the descriptor poll readable.
+			 */
+			void 													Set() noexcept;
+
+		private:
+			int m_read {-1};										///< Descriptor polled by the user.
+			int m_write {-1};										///< Descriptor written to (same as @c m_read for eventfd).
+			std::atomic<bool> m_set {false};						///< Whether the descriptor was last set.
+	};
+}
@@ -0,0 +1,145 @@
+#include <StormByte/buffer/execution.hxx>
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+using namespace StormByte::Buffer;
+
+struct Execution::State {
+	std::mutex mutex;												///< Protects every member.
+	std::condition_variable cv;										///< Signalled when the last stage returns.
+	std::size_t pending;											///< Stages still running or queued.
+	std::vector<StageStatus> stages;								///< Status by stage.
+	std::vector<Callback> callbacks;								///< Run once @c pending reaches zero.
+	const std::vector<Producer> producers;							///< Buffers the stages write to; owned by the run.
+	std::stop_source stop;											///< Cancellation requested by Cancel().
+
+	State(const std::size_t& count, std::vector<Producer>&& buffers):
+		pending(count), stages(count, StageStatus::Running), producers(std::move(buffers)) {}
+};
+
+Execution::Execution(std::vector<Producer> producers, class Consumer output):
+	m_state(std::make_shared<State>(producers.size(), std::move(producers))), m_outputs{ std::move(output) } {}
+
+Execution::Execution(const std::size_t& stages, std::vector<Producer> buffers, std::vector<class Consumer> outputs):
+	m_state(std::make_shared<State>(stages, std::move(buffers))), m_outputs(std::move(outputs)) {}
+
+void Execution::Cancel() const noexcept {
+	// Stop first: stages woken by the errors below see the request. The input
+	// belongs to the caller and may be shared, so it is left alone
+	(void)m_state->stop.request_stop();
+	SetError();
+}
+
+bool Execution::Done() const noexcept {
+	std::scoped_lock<std::mutex> lock(m_state->mutex);
+	return m_state->pending == 0;
+}
+
+bool Execution::OnComplete(Callback callback) const noexcept {
+	std::vector<StageStatus> stages;
+	{
+		std::scoped_lock<std::mutex> lock(m_state->mutex);
+		try {
+			if (m_state->pending > 0) {
+				m_state->callbacks.push_back(std::move(callback));
+				return true;
+			}
+			stages = m_state->stages;
+		}
+		catch (...) {
+			return false;
+		}
+	}
+	try {
+		callback(stages);
+	}
+	catch (...) {
+		// Callbacks report their own failures
+	}
+	return true;
+}
+
+class Consumer Execution::Output() const noexcept {
+	return m_outputs.front();
+}
+
+std::vector<class Consumer> Execution::Outputs() const noexcept {
+	try {
+		return m_outputs;
+	}
+	catch (...) {
+		return {};
+	}
+}
+
+void Execution::SetError() const noexcept {
+	// Fixed at construction: no lock needed; Producer copies share the buffer
+	for (Producer producer: m_state->producers)
+		producer.SetError();
+}
+
+std::vector<Execution::StageStatus> Execution::Stages() const noexcept {
+	std::scoped_lock<std::mutex> lock(m_state->mutex);
+	try {
+		return m_state->stages;
+	}
+	catch (...) {
+		return {};
+	}
+}
+
+bool Execution::StopRequested() const noexcept {
+	return m_state->stop.stop_requested();
+}
+
+std::stop_token Execution::StopToken() const noexcept {
+	return m_state->stop.get_token();
+}
+
+bool Execution::Succeeded() const noexcept {
+	std::scoped_lock<std::mutex> lock(m_state->mutex);
+	return m_state->pending == 0 && std::all_of(m_state->stages.begin(), m_state->stages.end(), [](const StageStatus& status) {
+		return status == StageStatus::Succeeded;
+	});
+}
+
+void Execution::Wait() const noexcept {
+	std::unique_lock<std::mutex> lock(m_state->mutex);
+	m_state->cv.wait(lock, [this]() { return m_state->pending == 0; });
+}
+
+bool Execution::WaitFor(const std::chrono::steady_clock::duration& timeout) const noexcept {
+	std::unique_lock<std::mutex> lock(m_state->mutex);
+	return m_state->cv.wait_for(lock, timeout, [this]() { return m_state->pending == 0; });
+}
+
+void Execution::Finish(const std::size_t& stage, const bool& failed) const noexcept {
+	std::vector<Callback> callbacks;
+	std::vector<StageStatus> stages;
+	{
+		std::scoped_lock<std::mutex> lock(m_state->mutex);
+		m_state->stages[stage] = failed ? StageStatus::Failed : StageStatus::Succeeded;
+		if (--m_state->pending > 0)
+			return;
+		callbacks.swap(m_state->callbacks);
+		if (!callbacks.empty()) {
+			try {
+				stages = m_state->stages;
+			}
+			catch (...) {
+				callbacks.clear();
+			}
+		}
+	}
+	m_state->cv.notify_all();
+	for (Callback& callback: callbacks) {
+		try {
+			callback(stages);
+		}
+		catch (...) {
+			// Callbacks report their own failures
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <StormByte/buffer/producer.hxx>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stop_token>
+#include <vector>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class Execution
+	 * @brief Handle to one run of a Pipeline or Graph, returned by their Execute().
+	 *
+	 * @par Overview
+	 *  Gives the run's output and reports, once, when every stage has
+	 *  returned: @ref Wait() and @ref WaitFor() block on a condition variable
+	 *  signalled by the last stage, and @ref OnComplete() callbacks run in the
+	 *  thread finishing it. Each stage ends as succeeded, or failed when it
+	 *  threw or left its output in the error state.
+	 *
+	 * @par Cancellation
+	 *  @ref Cancel() stops a run at once: it requests stop on the token
+	 *  CancellablePipeFunction stages receive, then errors the run's own
+	 *  buffers, which wakes every reader and writer blocked on them. Stages
+	 *  polling the token return within one check. The input belongs to the
+	 *  caller and may be shared (a BroadcastFIFO cursor, for instance), so it
+	 *  is left alone. A Pipeline feeds a plain or coroutine first stage through
+	 *  a copy of an open input that the run owns and errors too; a stage
+	 *  given the token that reads the input itself wakes on it through
+	 *  ConsumerSet::Select(const std::stop_token&), as parallel stages and
+	 *  FusedStage do.
+	 *
+	 * @par Ownership
+	 *  The run owns its intermediate buffers: runs of the same Pipeline share
+	 *  nothing but the stage functions, so they may overlap. The buffers live as
+	 *  long as a handle, a stage or a reader of the output refers to them.
+	 *
+	 * @par Thread safety
+	 *  Handles are cheap copies sharing the same run; every method may be
+	 *  called from any thread.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC Execution final {
+		friend class Graph;
+		friend class Pipeline;
+		public:
+			/**
+			 * @brief Outcome of one stage.
+			 */
+			enum class StageStatus: std::uint8_t {
+				Running,											///< Queued or running.
+				Succeeded,											///< Returned with its output closed or still writable.
+				Failed												///< Threw, or left its output in the error state.
+			};
+
+			/**
+			 * @brief Completion callback; receives the status of every stage.
+			 */
+			using Callback = std::function<void(const std::vector<StageStatus>&)>;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param other Handle to share the run of.
+			 */
+			Execution(const Execution& other)							= default;
+
+			/**
+			 * @brief Move constructor.
+			 * @param other Handle to take the run from.
+			 */
+			Execution(Execution&& other) noexcept						= default;
+
+			/**
+			 * @brief Destructor; the run continues without the handle.
+			 */
+			~Execution() noexcept										= default;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param other Handle to share the run of.
+			 * @return Reference to this handle.
+			 */
+			Execution& operator=(const Execution& other)				= default;
+
+			/**
+			 * @brief Move assignment.
+			 * @param other Handle to take the run from.
+			 * @return Reference to this handle.
+			 */
+			Execution& operator=(Execution&& other) noexcept			= default;
+
+			/**
+			 * @brief Stop the run: request stop, then error its intermediate and output buffers.
+			 * @details For a client that went away: stages blocked on the run's
+			 *          buffers wake up at once and stages checking @ref StopToken()
+			 *          return at their next check. The caller's input is not
+			 *          touched; see the Cancellation section for the first stage.
+			 */
+			void 														Cancel() const noexcept;
+
+			/**
+			 * @brief Check whether every stage has returned.
+			 * @return true once the run is complete.
+			 */
+			bool 														Done() const noexcept;
+
+			/**
+			 * @brief Call @p callback once every stage has returned.
+			 * @param callback Callback receiving the status of every stage.
+			 * @return false if the callback could not be registered.
+			 * @details The callback runs in the thread finishing the last stage, or
+			 *          at once in the calling thread if the run is already complete.
+			 *          Exceptions it throws are discarded.
+			 */
+			bool 														OnComplete(Callback callback) const noexcept;
+
+			/**
+			 * @brief Output of the last stage.
+			 * @return Consumer of the run's output (the input itself for an empty pipeline);
+			 *         the first of @ref Outputs() for a Graph.
+			 */
+			class Consumer 												Output() const noexcept;
+
+			/**
+			 * @brief Every output of the run.
+			 * @return The single output of a Pipeline run, or one Consumer per
+			 *         stream of a Graph that no node reads, by stream id.
+			 */
+			std::vector<class Consumer> 								Outputs() const noexcept;
+
+			/**
+			 * @brief Set every intermediate buffer of this run to the error state.
+			 * @details Stages notice at their next read or write and return; other
+			 *          runs of the same Pipeline are not affected. The run's input
+			 *          is left as is.
+			 */
+			void 														SetError() const noexcept;
+
+			/**
+			 * @brief Status of every stage, in execution order.
+			 * @return Statuses so far; @c Running for stages not returned yet.
+			 */
+			std::vector<StageStatus> 									Stages() const noexcept;
+
+			/**
+			 * @brief Check whether @ref Cancel() was called.
+			 * @return true once the run was cancelled.
+			 */
+			bool 														StopRequested() const noexcept;
+
+			/**
+			 * @brief Token of the run, as passed to CancellablePipeFunction stages.
+			 * @return Stop token set by @ref Cancel().
+			 */
+			std::stop_token 											StopToken() const noexcept;
+
+			/**
+			 * @brief Check whether the run completed with every stage succeeded.
+			 * @return false while running or if any stage failed.
+			 */
+			bool 														Succeeded() const noexcept;
+
+			/**
+			 * @brief Block until every stage has returned.
+			 * @warning Must not be called from a stage of the same run.
+			 */
+			void 														Wait() const noexcept;
+
+			/**
+			 * @brief Block until every stage has returned or @p timeout elapses.
+			 * @param timeout Longest time to wait.
+			 * @return true if the run is complete.
+			 */
+			bool 														WaitFor(const std::chrono::steady_clock::duration& timeout) const noexcept;
+
+		private:
+			struct State;												///< Completion state shared by the handles.
+
+			std::shared_ptr<State> m_state;								///< Shared completion state.
+			std::vector<class Consumer> m_outputs;						///< Outputs of the run; never empty.
+
+			/**
+			 * @brief Start tracking a run.
+			 * @param producers Output of every stage, in order; one stage each.
+			 * @param output Output of the last stage (the input when there are no stages).
+			 */
+			Execution(std::vector<Producer> producers, class Consumer output);
+
+			/**
+			 * @brief Start tracking a run whose stages do not map to one buffer each.
+			 * @param stages Number of stages.
+			 * @param buffers Every buffer the run writes to, errored by @ref SetError().
+			 * @param outputs Outputs of the run; at least one.
+			 */
+			Execution(const std::size_t& stages, std::vector<Producer> buffers, std::vector<class Consumer> outputs);
+
+			/**
+			 * @brief Record that a stage returned; the last one completes the run.
+			 * @param stage Stage index.
+			 * @param failed Whether the stage failed.
+			 */
+			void 														Finish(const std::size_t& stage, const bool& failed) const noexcept;
+	};
+}
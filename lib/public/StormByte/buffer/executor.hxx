@@ -0,0 +1,53 @@
+#pragma once
+
+#include <StormByte/buffer/visibility.h>
+
+#include <cstddef>
+#include <functional>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class Executor
+	 * @brief Interface for running tasks on threads owned by someone else.
+	 *
+	 * @par Overview
+	 *  Asynchronous buffer operations (Consumer::ReadAsync(), Producer::WriteAsync())
+	 *  resume their coroutine through an Executor: the thread whose write, read or
+	 *  close satisfied the operation posts the continuation instead of running it.
+	 *  Without an executor the continuation runs inline in that thread.
+	 *
+	 * @par Thread safety
+	 *  @ref Post() may be called from any thread, concurrently.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC Executor {
+		public:
+			/**
+			 * @brief Virtual destructor.
+			 */
+			virtual ~Executor() noexcept								= default;
+
+			/**
+			 * @brief Schedule a task to run once, on a thread of the executor's choosing.
+			 * @param task Task to run.
+			 */
+			virtual void 												Post(std::function<void()> task) = 0;
+
+			/**
+			 * @brief Number of tasks the executor can run at the same time.
+			 * @return Worker count of a fixed-size executor, 0 if it starts threads as needed.
+			 * @details Work that blocks waiting on other tasks checks this to reject
+			 *          an executor too small to ever run them all at once.
+			 */
+			inline virtual std::size_t 									Capacity() const noexcept {
+				return 0;
+			}
+	};
+}
@@ -0,0 +1,88 @@
+#include <StormByte/buffer/fifo_pool.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+using namespace StormByte::Buffer;
+
+struct FIFOPool::State {
+	const std::size_t max_idle;										///< Largest number of idle buffers.
+	const std::size_t max_capacity;									///< Largest allocation kept or reserved.
+	std::mutex mutex;												///< Guards @c idle.
+	std::vector<std::unique_ptr<SharedFIFO>> idle;					///< Reset buffers waiting for reuse.
+	std::atomic<std::size_t> created {0};							///< Buffers created.
+	std::atomic<std::size_t> reused {0};							///< Buffers handed out again.
+	std::atomic<std::size_t> hint {0};								///< Learned capacity; written under @c mutex.
+
+	State(const std::size_t& idle_limit, const std::size_t& capacity_limit) noexcept:
+		max_idle(idle_limit), max_capacity(capacity_limit) {}
+};
+
+FIFOPool::FIFOPool(const std::size_t& max_idle, const std::size_t& max_capacity):
+	m_state(std::make_shared<State>(max_idle, max_capacity)) {}
+
+FIFOPool::~FIFOPool() noexcept = default;
+
+Producer FIFOPool::Acquire() {
+	std::unique_ptr<SharedFIFO> fifo;
+	{
+		std::scoped_lock<std::mutex> lock(m_state->mutex);
+		if (!m_state->idle.empty()) {
+			fifo = std::move(m_state->idle.back());
+			m_state->idle.pop_back();
+		}
+	}
+	if (fifo)
+		m_state->reused.fetch_add(1, std::memory_order_relaxed);
+	else {
+		fifo = std::make_unique<SharedFIFO>();
+		m_state->created.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// Nobody else refers to the buffer yet, so it is reserved without its lock
+	const std::size_t hint = m_state->hint.load(std::memory_order_relaxed);
+	if (fifo->m_buffer.capacity() < hint) {
+		try {
+			fifo->m_buffer.reserve(hint);
+		}
+		catch (...) {}
+	}
+
+	std::weak_ptr<State> pool = m_state;
+	return Producer(std::shared_ptr<SharedFIFO>(fifo.release(), [pool](SharedFIFO* released) noexcept {
+		std::unique_ptr<SharedFIFO> owned(released);
+		auto state = pool.lock();
+		std::size_t grown = 0;
+		// Reset outside the pool lock: dropped callbacks may release other pooled buffers
+		if (!state || !owned->Recycle(state->max_capacity, grown))
+			return;
+		std::scoped_lock<std::mutex> lock(state->mutex);
+		const std::size_t hint = state->hint.load(std::memory_order_relaxed);
+		state->hint.store(std::max(hint - hint / 8, std::min(grown, state->max_capacity)), std::memory_order_relaxed);
+		if (state->idle.size() < state->max_idle) {
+			try {
+				state->idle.push_back(std::move(owned));
+			}
+			catch (...) {}
+		}
+	}));
+}
+
+std::size_t FIFOPool::Created() const noexcept {
+	return m_state->created.load(std::memory_order_relaxed);
+}
+
+std::size_t FIFOPool::Idle() const noexcept {
+	std::scoped_lock<std::mutex> lock(m_state->mutex);
+	return m_state->idle.size();
+}
+
+std::size_t FIFOPool::Reused() const noexcept {
+	return m_state->reused.load(std::memory_order_relaxed);
+}
+
+std::size_t FIFOPool::SizeHint() const noexcept {
+	return m_state->hint.load(std::memory_order_relaxed);
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <StormByte/buffer/producer.hxx>
+
+#include <cstddef>
+#include <memory>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class FIFOPool
+	 * @brief Free list of SharedFIFO buffers reused across pipeline runs.
+	 *
+	 * @par Overview
+	 *  @ref Acquire() hands out a Producer over an unbounded SharedFIFO. When
+	 *  the last Producer or Consumer of that buffer goes away, the buffer is
+	 *  reset (emptied, reopened, callbacks, statistics and tracing dropped) and
+	 *  kept for the next @ref Acquire() together with its allocation, so a
+	 *  steady stream of runs stops growing buffers from nothing.
+	 *
+	 * @par Size hint
+	 *  The pool remembers how far returned buffers grew, decaying by an eighth
+	 *  on each return, and reserves that much in buffers it creates or hands
+	 *  out again. Buffers larger than the capacity limit are freed instead of
+	 *  kept, and so is every buffer once @c max_idle are waiting.
+	 *
+	 * @par Lifetime
+	 *  Buffers handed out may outlive the pool; they are then simply freed.
+	 *  A buffer whose event descriptor was requested is never reused.
+	 *
+	 * @par Thread safety
+	 *  Every method may be called from any thread, and buffers may be released
+	 *  from any thread.
+	 *
+	 * @see Pipeline::SetBufferPool()
+	 */
+	class STORMBYTE_BUFFER_PUBLIC FIFOPool final {
+		public:
+			/**
+			 * @brief Create an empty pool.
+			 * @param max_idle Largest number of buffers kept for reuse.
+			 * @param max_capacity Largest allocation, in bytes, kept or reserved.
+			 */
+			explicit FIFOPool(const std::size_t& max_idle = 64, const std::size_t& max_capacity = 1 << 20);
+
+			/**
+			 * @brief Copy constructor deleted.
+			 */
+			FIFOPool(const FIFOPool&)									= delete;
+
+			/**
+			 * @brief Move constructor deleted.
+			 */
+			FIFOPool(FIFOPool&&)										= delete;
+
+			/**
+			 * @brief Free the idle buffers; buffers in use are freed when released.
+			 */
+			~FIFOPool() noexcept;
+
+			/**
+			 * @brief Copy assignment deleted.
+			 */
+			FIFOPool& operator=(const FIFOPool&)						= delete;
+
+			/**
+			 * @brief Move assignment deleted.
+			 */
+			FIFOPool& operator=(FIFOPool&&)								= delete;
+
+			/**
+			 * @brief Take an idle buffer, or create one.
+			 * @return Producer over an empty, open buffer.
+			 */
+			Producer 													Acquire();
+
+			/**
+			 * @brief Number of buffers created by @ref Acquire().
+			 * @return Created buffer count.
+			 */
+			std::size_t 												Created() const noexcept;
+
+			/**
+			 * @brief Number of buffers waiting for reuse.
+			 * @return Idle buffer count.
+			 */
+			std::size_t 												Idle() const noexcept;
+
+			/**
+			 * @brief Number of @ref Acquire() calls served by an idle buffer.
+			 * @return Reuse count.
+			 */
+			std::size_t 												Reused() const noexcept;
+
+			/**
+			 * @brief Capacity reserved in buffers handed out.
+			 * @return Learned size hint, in bytes.
+			 */
+			std::size_t 												SizeHint() const noexcept;
+
+		private:
+			struct State;												///< Idle buffers and counters, shared with the buffers' deleters.
+
+			std::shared_ptr<State> m_state;								///< Shared with every buffer handed out.
+	};
+}
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <StormByte/buffer/consumer_set.hxx>
+#include <StormByte/buffer/pipeline.hxx>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <stop_token>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @brief Callable transforming a chunk of bytes in place.
+	 * @details Called as @c transform(chunk) with a DataType it may modify,
+	 *          grow, shrink or empty; what is left is passed on.
+	 */
+	template<class Transform>
+	concept ChunkTransform = std::invocable<Transform&, DataType&>;
+
+	/**
+	 * @brief Marks a chunk transform that must run as a pipeline stage of its own.
+	 * @details Use it for a transform that blocks or is slow enough to be worth a
+	 *          thread of its own, so it overlaps with its neighbours instead of
+	 *          sharing their loop: @c MakePipeline(decode, Threaded{compress}, encode).
+	 */
+	template<ChunkTransform Transform>
+	struct Threaded {
+		Transform transform;										///< Transform to run alone.
+	};
+
+	template<class Transform> Threaded(Transform) -> Threaded<Transform>;
+
+	/**
+	 * @class FusedStage
+	 * @brief Pipeline stage running a fixed sequence of chunk transforms in one loop.
+	 *
+	 * @par Overview
+	 *  Every Pipeline stage boundary costs a PipeFunction call through
+	 *  @c std::function, a SharedFIFO with its lock, and a thread handoff. A
+	 *  FusedStage holds its transforms by type in a tuple and applies all of
+	 *  them to each chunk before writing it, so the compiler can inline them
+	 *  into a single loop and no buffer sits between them.
+	 *
+	 * @par Chunks
+	 *  The stage reads its input in chunks of at most @c chunk_size bytes, in
+	 *  order: it waits for one byte and then takes whatever else is available
+	 *  up to a chunk, so a slow producer is never held back until a whole
+	 *  chunk arrives. A transform keeping state across chunks must
+	 *  therefore not assume chunk boundaries fall anywhere in particular. A chunk
+	 *  left empty by a transform is not written.
+	 *
+	 * @par Errors
+	 *  An exception thrown by a transform fails the stage, as for any
+	 *  PipeFunction. An errored input errors the output.
+	 *
+	 * @par Cancellation
+	 *  The stage checks the run's stop token before each chunk, and waits for
+	 *  input through ConsumerSet::Select(const std::stop_token&), so a cancelled
+	 *  run stops after at most one chunk even when its input stays open.
+	 *
+	 * @par Copies
+	 *  A FusedStage is a CancellablePipeFunction. Every run applies fresh copies of the
+	 *  transforms, so state they keep starts over with each run; transforms must
+	 *  therefore be copyable.
+	 *
+	 * @see MakePipeline(), Threaded, Pipeline::AddPipe()
+	 */
+	template<ChunkTransform... Transforms>
+	class FusedStage final {
+		public:
+			/**
+			 * @brief Create a stage applying @p transforms in order.
+			 * @param transforms Transforms to fuse.
+			 * @param chunk_size Most bytes read at a time.
+			 */
+			explicit FusedStage(std::tuple<Transforms...> transforms = {}, const std::size_t& chunk_size = 65536):
+			m_transforms(std::move(transforms)), m_chunk_size(chunk_size > 0 ? chunk_size : 1) {}
+
+			/**
+			 * @brief Run the stage: transform every chunk of @p in and write it to @p out.
+			 * @param in Stage input.
+			 * @param out Stage output; closed at end of input, errored if the input errored.
+			 * @param stop Stop token of the run; the stage errors its output and
+			 *        returns once it is set.
+			 */
+			void 													operator()(Consumer in, Producer out, std::shared_ptr<Logger::Log>, std::stop_token stop) const {
+				// Every run starts from the transforms' initial state
+				FusedStage run(*this);
+				while (true) {
+					if (stop.stop_requested()) {
+						out.SetError();
+						return;
+					}
+					if (in.AvailableBytes() == 0 && in.IsWritable()) {
+						// The input may be the caller's: wait on it and on the run's token
+						ConsumerSet input;
+						(void)input.Add(in);
+						(void)input.Select(stop);
+						continue;
+					}
+					DataType chunk;
+					// Wait for one byte, then take whatever else is there up to a chunk
+					if (!in.Extract(1, chunk))
+						break;
+					const std::size_t more = std::min(in.AvailableBytes(), m_chunk_size - 1);
+					if (more > 0)
+						(void)in.Extract(more, chunk);
+					run.Apply(chunk);
+					if (!chunk.empty() && !out.Write(std::move(chunk)))
+						return;
+				}
+				if (in.HasError())
+					out.SetError();
+				else
+					out.Close();
+			}
+
+			/**
+			 * @brief Add this stage and @p stages to @p pipeline, fusing adjacent transforms.
+			 * @param pipeline Pipeline to add stages to.
+			 * @param stages Chunk transforms, Threaded transforms, or PipeFunction
+			 *        compatible callables.
+			 * @details Transforms following this stage's own join it; a Threaded
+			 *          transform or a PipeFunction becomes a stage of its own and the
+			 *          transforms after it start a new FusedStage with the same chunk
+			 *          size. A FusedStage with no transform adds nothing.
+			 */
+			template<class... Stages>
+			void 													AddTo(Pipeline& pipeline, Stages&&... stages) && {
+				if constexpr (sizeof...(Stages) == 0) {
+					if constexpr (sizeof...(Transforms) > 0)
+						pipeline.AddPipe(CancellablePipeFunction(std::move(*this)));
+				}
+				else
+					std::move(*this).Append(pipeline, std::forward<Stages>(stages)...);
+			}
+
+			/**
+			 * @brief Apply every transform to @p chunk, in order.
+			 * @param chunk Bytes to transform in place.
+			 */
+			void 													Apply(DataType& chunk) {
+				std::apply([&chunk](Transforms&... transforms) {
+					(std::invoke(transforms, chunk), ...);
+				}, m_transforms);
+			}
+
+		private:
+			std::tuple<Transforms...> m_transforms;					///< Transforms, applied first to last.
+			std::size_t m_chunk_size;								///< Most bytes read at a time.
+
+			/**
+			 * @brief Check whether @p Stage is a Threaded transform.
+			 */
+			template<class Stage>
+			static constexpr bool 									IsThreaded(const Stage*) noexcept { return false; }
+
+			/**
+			 * @brief Check whether @p Stage is a Threaded transform.
+			 */
+			template<class Transform>
+			static constexpr bool 									IsThreaded(const Threaded<Transform>*) noexcept { return true; }
+
+			/**
+			 * @brief Take the next stage: fuse it, or close this group and add it alone.
+			 * @param pipeline Pipeline to add stages to.
+			 * @param stage Next stage.
+			 * @param rest Stages after it.
+			 */
+			template<class Stage, class... Rest>
+			void 													Append(Pipeline& pipeline, Stage&& stage, Rest&&... rest) && {
+				using Type = std::decay_t<Stage>;
+				const std::size_t chunk_size = m_chunk_size;
+				if constexpr (IsThreaded(static_cast<const Type*>(nullptr))) {
+					std::move(*this).AddTo(pipeline);
+					using Transform = decltype(Type::transform);
+					FusedStage<Transform>(std::tuple<Transform>(std::forward<Stage>(stage).transform), chunk_size).AddTo(pipeline);
+					FusedStage<>({}, chunk_size).AddTo(pipeline, std::forward<Rest>(rest)...);
+				}
+				else if constexpr (ChunkTransform<Type>) {
+					FusedStage<Transforms..., Type>(std::tuple_cat(std::move(m_transforms), std::tuple<Type>(std::forward<Stage>(stage))), chunk_size)
+						.AddTo(pipeline, std::forward<Rest>(rest)...);
+				}
+				else {
+					static_assert(std::is_constructible_v<PipeFunction, Stage>, "a stage must be a chunk transform, a Threaded transform or a PipeFunction");
+					std::move(*this).AddTo(pipeline);
+					pipeline.AddPipe(PipeFunction(std::forward<Stage>(stage)));
+					FusedStage<>({}, chunk_size).AddTo(pipeline, std::forward<Rest>(rest)...);
+				}
+			}
+	};
+
+	/**
+	 * @brief Build a Pipeline from @p stages, fusing adjacent chunk transforms.
+	 * @param stages Chunk transforms (@c void(DataType&)), Threaded transforms,
+	 *        or PipeFunction compatible callables, in execution order.
+	 * @return Pipeline whose stages are the fused groups, each Threaded
+	 *         transform and each PipeFunction; SharedFIFO buffers only sit
+	 *         between those.
+	 * @details Stage types are checked at compile time. Consecutive transforms
+	 *          become one FusedStage that reads 64 KiB chunks, for instance
+	 *          @c MakePipeline(strip, lowercase, Threaded{compress}) runs as two
+	 *          stages. Use FusedStage::AddTo() to pick another chunk size or to
+	 *          extend an existing pipeline.
+	 * @see FusedStage
+	 */
+	template<class... Stages>
+	Pipeline MakePipeline(Stages&&... stages) {
+		Pipeline pipeline;
+		FusedStage<>().AddTo(pipeline, std::forward<Stages>(stages)...);
+		return pipeline;
+	}
+}
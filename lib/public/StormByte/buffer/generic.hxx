@@ -597,7 +597,10 @@ namespace StormByte::Buffer {
 			bool 															Write(const std::size_t& count, Rrw&& r) noexcept {
 				using Dec = std::remove_cvref_t<Rrw>;
 				if (count == 0) return Write(std::forward<Rrw>(r));
-				if constexpr (std::same_as<Dec, DataType>) {
+				if constexpr (std::same_as<Dec, DataType> && !std::is_rvalue_reference_v<Rrw&&>) {
+					// An lvalue DataType is the caller's: copy it
+					return Write(std::min(count, r.size()), static_cast<const DataType&>(r));
+				} else if constexpr (std::same_as<Dec, DataType>) {
 					// r is DataType; we can move and resize if needed
 					DataType tmp = std::move(r);
 					if (tmp.size() > count) tmp.resize(count);
@@ -632,7 +635,10 @@ namespace StormByte::Buffer {
 				requires(std::ranges::range_value_t<Rr> v) { static_cast<std::byte>(v); }
 			bool 															Write(Rr&& r) noexcept {
 				using Dec = std::remove_cvref_t<Rr>;
-				if constexpr (std::same_as<Dec, DataType>) {
+				if constexpr (std::same_as<Dec, DataType> && !std::is_rvalue_reference_v<Rr&&>) {
+					// An lvalue DataType is the caller's: copy it
+					return Write(static_cast<std::size_t>(r.size()), static_cast<const DataType&>(r));
+				} else if constexpr (std::same_as<Dec, DataType>) {
 					// r is already the library DataType (std::vector<std::byte>), forward to move overload
 					return Write(static_cast<std::size_t>(r.size()), std::move(r));
 				} else {
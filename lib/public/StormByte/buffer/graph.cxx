@@ -0,0 +1,302 @@
+#include <StormByte/buffer/broadcast_fifo.hxx>
+#include <StormByte/buffer/consumer_set.hxx>
+#include <StormByte/buffer/graph.hxx>
+#include <StormByte/buffer/thread_pool.hxx>
+
+#include <algorithm>
+#include <optional>
+#include <stop_token>
+#include <unordered_map>
+
+using namespace StormByte::Buffer;
+
+namespace {
+	// Copy @p in to @p out as data arrives; false if @p in errored, a write failed or @p stop was requested
+	bool Forward(Consumer& in, Producer& out, const std::stop_token& stop = {}) noexcept {
+		while (true) {
+			if (stop.stop_requested())
+				return false;
+			if (stop.stop_possible() && in.AvailableBytes() == 0 && in.IsWritable()) {
+				// The input is the caller's: wait on it and on the run's token
+				ConsumerSet input;
+				(void)input.Add(in);
+				(void)input.Select(stop);
+				continue;
+			}
+			DataType data;
+			// Wait for one byte, then take whatever else is there
+			if (!in.Extract(1, data))
+				return !in.HasError();
+			(void)in.Extract(0, data);
+			if (!out.Write(std::move(data)))
+				return false;
+		}
+	}
+
+	// Whether a node left one of its outputs in the error state
+	bool Failed(const std::vector<Producer>& outputs) noexcept {
+		return std::any_of(outputs.begin(), outputs.end(), [](const Producer& out) { return out.HasError(); });
+	}
+
+	// Relay the graph input into the buffer its readers share, until @p stop is requested
+	void Relay(Consumer in, Producer out, const std::stop_token& stop) noexcept {
+		if (Forward(in, out, stop))
+			out.Close();
+		else
+			out.SetError();
+	}
+}
+
+Graph::Graph() noexcept: m_pool(std::make_shared<FIFOPool>()) {}
+
+std::size_t Graph::AddMerge(MergeFunction merge, const std::vector<std::size_t>& inputs) {
+	if (inputs.empty() || std::any_of(inputs.begin(), inputs.end(), [this](const std::size_t& input) { return input >= m_streams; }))
+		return Invalid;
+	m_nodes.push_back({ nullptr, nullptr, std::move(merge), inputs, NewStreams(1) });
+	return m_nodes.back().outputs.front();
+}
+
+std::vector<std::size_t> Graph::AddSplit(SplitFunction split, const std::size_t& input, const std::size_t& outputs) {
+	if (input >= m_streams || outputs == 0)
+		return {};
+	m_nodes.push_back({ nullptr, std::move(split), nullptr, { input }, NewStreams(outputs) });
+	return m_nodes.back().outputs;
+}
+
+std::size_t Graph::AddStage(PipeFunction stage, const std::size_t& input) {
+	if (input >= m_streams)
+		return Invalid;
+	m_nodes.push_back({ std::move(stage), nullptr, nullptr, { input }, NewStreams(1) });
+	return m_nodes.back().outputs.front();
+}
+
+MergeFunction Graph::Concatenate() {
+	return [](std::vector<Consumer> inputs, Producer out, std::shared_ptr<Logger::Log>) {
+		for (Consumer& in: inputs) {
+			if (!Forward(in, out)) {
+				out.SetError();
+				return;
+			}
+		}
+		out.Close();
+	};
+}
+
+Execution Graph::Execute(Consumer input, const ExecutionMode& mode, std::shared_ptr<Logger::Log> log) const noexcept {
+	std::optional<Producer> relay;
+	std::vector<std::vector<Consumer>> inputs;
+	std::vector<std::vector<Producer>> outputs;
+	bool tee = false;
+	std::size_t stages = 0;
+	std::shared_ptr<Executor> executor;
+	std::optional<Execution> started;
+	try {
+		std::vector<std::size_t> readers(m_streams, 0);
+		for (const Node& node: m_nodes)
+			for (const std::size_t& stream: node.inputs)
+				++readers[stream];
+		tee = readers[Input] > 1;
+
+		// Streams read more than once are stored once, with a cursor per reader;
+		// buffers[s - 1] is stream s, and relay stands for the input when shared or copied
+		std::vector<Producer> buffers;
+		buffers.reserve(m_streams);
+		if (tee)
+			relay.emplace(std::make_shared<BroadcastFIFO>());
+		else if (mode == ExecutionMode::Async && readers[Input] == 1 && input.IsWritable()) {
+			// A node would block on the caller's open input, out of reach of
+			// Cancel: it reads a copy owned by the run instead, bounded like the
+			// input so its writer still waits for that node
+			if (input.Limit() > 0)
+				relay.emplace(std::make_shared<SharedFIFO>(input.Limit()));
+			else
+				relay.emplace(m_pool ? m_pool->Acquire() : Producer());
+		}
+		for (std::size_t stream = 1; stream < m_streams; ++stream) {
+			if (readers[stream] > 1)
+				buffers.emplace_back(std::make_shared<BroadcastFIFO>());
+			else if (m_pool)
+				buffers.push_back(m_pool->Acquire());
+			else
+				buffers.emplace_back();
+		}
+
+		// Every cursor exists before anything is written, so none misses data
+		const auto reader = [&](const std::size_t& stream) -> Consumer {
+			if (stream == Input)
+				return relay ? relay->Consumer() : input;
+			return buffers[stream - 1].Consumer();
+		};
+		inputs.resize(m_nodes.size());
+		outputs.resize(m_nodes.size());
+		for (std::size_t i = 0; i < m_nodes.size(); ++i) {
+			for (const std::size_t& stream: m_nodes[i].inputs)
+				inputs[i].push_back(reader(stream));
+			for (const std::size_t& stream: m_nodes[i].outputs)
+				outputs[i].push_back(buffers[stream - 1]);
+		}
+		std::vector<Consumer> results;
+		for (std::size_t stream = 1; stream < m_streams; ++stream)
+			if (readers[stream] == 0)
+				results.push_back(buffers[stream - 1].Consumer());
+		if (results.empty())
+			results.push_back(input);
+
+		stages = m_nodes.size() + (tee ? 1 : 0);
+		std::vector<Producer> written = buffers;
+		if (relay)
+			written.push_back(*relay);
+		started.emplace(Execution(stages, std::move(written), std::move(results)));
+		if (mode == ExecutionMode::Async)
+			executor = m_executor ? m_executor : ThreadPool::Shared();
+	}
+	catch (...) {
+		// Could not set the run up: no node started, every one of them fails
+		Producer failed;
+		failed.SetError();
+		const Execution run(m_nodes.size(), { failed }, { failed.Consumer() });
+		for (std::size_t i = 0; i < m_nodes.size(); ++i)
+			run.Finish(i, true);
+		return run;
+	}
+	const Execution run = *started;
+
+	// Run one node and close what it left open, as Pipeline does, in both modes
+	const auto execute = [](const Node& node, std::vector<Consumer>& in, std::vector<Producer>& out, const std::shared_ptr<Logger::Log>& log) noexcept {
+		try {
+			if (node.stage)
+				node.stage(in.front(), out.front(), log);
+			else if (node.split)
+				node.split(in.front(), out, log);
+			else
+				node.merge(in, out.front(), log);
+		}
+		catch (...) {
+			for (Producer& producer: out)
+				producer.SetError();
+		}
+		for (Producer& producer: out)
+			if (producer.IsWritable())
+				producer.Close();
+		return Failed(out);
+	};
+
+	if (mode == ExecutionMode::Sync) {
+		// Node order is a topological order: every input is complete when read
+		if (tee) {
+			Relay(input, *relay, run.StopToken());
+			run.Finish(m_nodes.size(), relay->HasError());
+		}
+		for (std::size_t i = 0; i < m_nodes.size(); ++i)
+			run.Finish(i, execute(m_nodes[i], inputs[i], outputs[i], log));
+		return run;
+	}
+
+	// Every node holds its worker until it returns, and so does the relay: on a
+	// fixed pool with fewer workers than that the run could wait for good, so
+	// it fails at once
+	const std::size_t capacity = executor->Capacity();
+	if (capacity > 0 && capacity < m_nodes.size() + (relay ? 1 : 0)) {
+		run.SetError();
+		for (std::size_t i = 0; i < stages; ++i)
+			run.Finish(i, true);
+		return run;
+	}
+	if (tee) {
+		try {
+			executor->Post([input, out = *relay, run, index = m_nodes.size()]() mutable {
+				Relay(input, out, run.StopToken());
+				run.Finish(index, out.HasError());
+			});
+		}
+		catch (...) {
+			relay->SetError();
+			run.Finish(m_nodes.size(), true);
+		}
+	}
+	else if (relay) {
+		// Not a stage, as in Pipeline: copies until the input ends, the run is
+		// cancelled or every node returned
+		std::stop_source done;
+		bool posted = false;
+		try {
+			// Once every node returned nothing reads the copy: erroring it also
+			// wakes a relay waiting for room in it
+			if (run.OnComplete([done, out = *relay](const std::vector<Execution::StageStatus>&) mutable {
+				(void)done.request_stop();
+				out.SetError();
+			})) {
+				executor->Post([input, out = *relay, run, done]() mutable {
+					const std::stop_callback cancel(run.StopToken(), [&done]() noexcept { (void)done.request_stop(); });
+					Relay(input, out, done.get_token());
+				});
+				posted = true;
+			}
+		}
+		catch (...) {
+			// Handled below
+		}
+		// Could not relay: the node reading the input sees it fail
+		if (!posted)
+			relay->SetError();
+	}
+	for (std::size_t i = 0; i < m_nodes.size(); ++i) {
+		try {
+			executor->Post([execute, current = m_nodes[i], in = std::move(inputs[i]), out = outputs[i], log, run, i]() mutable {
+				run.Finish(i, execute(current, in, out, log));
+			});
+		}
+		catch (...) {
+			// Could not schedule: the node fails and its readers see the error
+			for (Producer& producer: outputs[i])
+				producer.SetError();
+			run.Finish(i, true);
+		}
+	}
+	return run;
+}
+
+MergeFunction Graph::Interleave() {
+	return [](std::vector<Consumer> inputs, Producer out, std::shared_ptr<Logger::Log>) {
+		ConsumerSet set;
+		std::unordered_map<std::size_t, Consumer> members;
+		for (const Consumer& in: inputs)
+			members.emplace(set.Add(in), in);
+		while (!set.Empty()) {
+			for (const std::size_t& id: set.Select()) {
+				Consumer& in = members.at(id);
+				DataType data;
+				if (in.Extract(0, data)) {
+					if (!out.Write(std::move(data)))
+						return;
+				}
+				else if (in.HasError()) {
+					out.SetError();
+					return;
+				}
+				else if (in.EoF())
+					(void)set.Remove(id);
+			}
+		}
+		out.Close();
+	};
+}
+
+std::size_t Graph::Nodes() const noexcept {
+	return m_nodes.size();
+}
+
+void Graph::SetBufferPool(std::shared_ptr<FIFOPool> pool) noexcept {
+	m_pool = std::move(pool);
+}
+
+void Graph::SetExecutor(std::shared_ptr<Executor> executor) noexcept {
+	m_executor = std::move(executor);
+}
+
+std::vector<std::size_t> Graph::NewStreams(const std::size_t& count) {
+	std::vector<std::size_t> streams(count);
+	for (std::size_t& stream: streams)
+		stream = m_streams++;
+	return streams;
+}
\ No newline at end of file
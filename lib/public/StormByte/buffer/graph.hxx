@@ -0,0 +1,222 @@
+#pragma once
+
+#include <StormByte/buffer/consumer.hxx>
+#include <StormByte/buffer/execution.hxx>
+#include <StormByte/buffer/executor.hxx>
+#include <StormByte/buffer/fifo_pool.hxx>
+#include <StormByte/buffer/producer.hxx>
+#include <StormByte/buffer/typedefs.hxx>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class Graph
+	 * @brief Processing graph: stages connected by streams in any acyclic topology.
+	 *
+	 * @par Overview
+	 *  Where a Pipeline is a chain, a Graph lets stages branch and join. Every
+	 *  node reads one or more streams and writes one or more new streams; stream
+	 *  @ref Input is the data passed to Execute(). Nodes can only read streams
+	 *  that already exist, so a graph is acyclic by construction and its node
+	 *  order is a valid execution order.
+	 *  - @ref AddStage(): one input, one output, a regular PipeFunction.
+	 *  - @ref AddSplit(): one input routed to several outputs.
+	 *  - @ref AddMerge(): several inputs combined into one output, for instance
+	 *    with @ref Concatenate() or @ref Interleave().
+	 *
+	 * @par Tee
+	 *  Any stream may be read by several nodes. Such a stream is a BroadcastFIFO:
+	 *  its data is stored once and every reader has its own cursor over it, so
+	 *  branches do not copy the stream into buffers of their own. When several
+	 *  nodes read the graph input, one extra stage, after the nodes, relays the
+	 *  input into such a buffer.
+	 *
+	 * @par Outputs
+	 *  Streams no node reads are the outputs of a run, in id order:
+	 *  Execution::Outputs() returns them and Execution::Output() the first one.
+	 *  A graph without nodes passes its input through.
+	 *
+	 * @par Execution
+	 *  As with Pipeline, every Execute() call is an independent run with its own
+	 *  buffers. Async runs post every node to the executor, by default
+	 *  @ref ThreadPool::Shared() like the blocking stages of a Pipeline; a node
+	 *  holds its worker while it runs. Sync runs every node in the caller's
+	 *  thread in order, each over the complete output of the nodes before it.
+	 *  In an Async run, a single node reading an input still open reads a copy
+	 *  the run relays, so Execution::Cancel() can wake it; that relay is not a
+	 *  stage, and the copy has the input's byte limit, so a bounded input still
+	 *  makes its writer wait for the node. Stage statuses follow node order. Single-reader streams come from the
+	 *  graph's @ref FIFOPool.
+	 *
+	 * @par Example
+	 * @code{.cpp}
+	 * Graph graph;
+	 * const std::size_t hash = graph.AddStage(sha256);             // reads the input
+	 * const std::size_t packed = graph.AddStage(compress);         // reads it too: a tee
+	 * const std::vector<std::size_t> parts = graph.AddSplit(by_type, packed, 2);
+	 * graph.AddMerge(Graph::Concatenate(), { hash, parts[0] });
+	 * Execution run = graph.Execute(input.Consumer(), ExecutionMode::Async, log);
+	 * // run.Outputs(): parts[1], then the merge
+	 * @endcode
+	 *
+	 * @see Pipeline, BroadcastFIFO, ConsumerSet
+	 */
+	class STORMBYTE_BUFFER_PUBLIC Graph final {
+		public:
+			static constexpr std::size_t Input = 0;					///< Stream id of the graph input.
+			static constexpr std::size_t Invalid = static_cast<std::size_t>(-1);	///< Returned when a node could not be added.
+
+			/**
+			 * @brief Create an empty graph with its own buffer pool.
+			 */
+			Graph() noexcept;
+
+			/**
+			 * @brief Copy constructor; the copy shares the buffer pool.
+			 * @param other Graph to copy.
+			 */
+			Graph(const Graph& other)								= default;
+
+			/**
+			 * @brief Move constructor.
+			 * @param other Graph to move from.
+			 */
+			Graph(Graph&& other) noexcept							= default;
+
+			/**
+			 * @brief Destructor; runs in progress continue without the graph.
+			 */
+			~Graph() noexcept										= default;
+
+			/**
+			 * @brief Copy assignment; shares the buffer pool.
+			 * @param other Graph to copy.
+			 * @return Reference to this graph.
+			 */
+			Graph& operator=(const Graph& other)					= default;
+
+			/**
+			 * @brief Move assignment.
+			 * @param other Graph to move from.
+			 * @return Reference to this graph.
+			 */
+			Graph& operator=(Graph&& other) noexcept				= default;
+
+			/**
+			 * @brief Add a node combining several streams into a new one.
+			 * @param merge Function receiving one Consumer per input, in order.
+			 * @param inputs Streams to read; the same stream may appear twice.
+			 * @return Id of the output stream, or @ref Invalid if an input does not exist.
+			 * @see Concatenate(), Interleave()
+			 */
+			std::size_t 											AddMerge(MergeFunction merge, const std::vector<std::size_t>& inputs);
+
+			/**
+			 * @brief Add a node routing one stream to several new ones.
+			 * @param split Function receiving one Producer per output, in order.
+			 * @param input Stream to read.
+			 * @param outputs Number of output streams; at least one.
+			 * @return Ids of the output streams, or none if @p input does not exist
+			 *         or @p outputs is zero.
+			 */
+			std::vector<std::size_t> 								AddSplit(SplitFunction split, const std::size_t& input, const std::size_t& outputs);
+
+			/**
+			 * @brief Add a node transforming one stream into a new one.
+			 * @param stage Stage function, as for Pipeline::AddPipe().
+			 * @param input Stream to read (default: the graph input).
+			 * @return Id of the output stream, or @ref Invalid if @p input does not exist.
+			 */
+			std::size_t 											AddStage(PipeFunction stage, const std::size_t& input = Input);
+
+			/**
+			 * @brief Merge function writing each input whole, one after the other.
+			 * @return MergeFunction for @ref AddMerge().
+			 * @details Input @c i + 1 is read once input @c i has ended; it keeps
+			 *          buffering meanwhile. An errored input errors the output.
+			 */
+			static MergeFunction 									Concatenate();
+
+			/**
+			 * @brief Start a run of the graph on @p input.
+			 * @param input Data of stream @ref Input.
+			 * @param mode Async (nodes run on the executor) or Sync (in the calling thread).
+			 * @param log Logger passed to the nodes.
+			 * @return Handle to the run and its outputs.
+			 * @details Every call is an independent run; calls may overlap, also from
+			 *          several threads, as long as the graph is not changed meanwhile.
+			 */
+			Execution 												Execute(Consumer input, const ExecutionMode& mode, std::shared_ptr<Logger::Log> log) const noexcept;
+
+			/**
+			 * @brief Merge function writing data from whichever input has some, as it arrives.
+			 * @return MergeFunction for @ref AddMerge().
+			 * @details Waits on every input at once through a ConsumerSet and moves
+			 *          whatever a ready input holds. The bytes of each input keep their
+			 *          order; inputs interleave at the granularity of what they held
+			 *          when read. An errored input errors the output.
+			 */
+			static MergeFunction 									Interleave();
+
+			/**
+			 * @brief Number of nodes.
+			 * @return Nodes added so far; also the number of stages of a run,
+			 *         without the input relay.
+			 */
+			std::size_t 											Nodes() const noexcept;
+
+			/**
+			 * @brief Select the pool single-reader streams are taken from.
+			 * @param pool Pool to use (null: allocate fresh buffers for every run).
+			 * @see Pipeline::SetBufferPool()
+			 */
+			void 													SetBufferPool(std::shared_ptr<FIFOPool> pool) noexcept;
+
+			/**
+			 * @brief Select the executor nodes are posted to.
+			 * @param executor Executor to use (null: @ref ThreadPool::Shared()).
+			 * @details Every node holds a worker until it returns: a fixed-size pool
+			 *          needs a worker for every node of every run going on at once,
+			 *          plus one relaying the input when several nodes read it or,
+			 *          for a single node, while it is still open. An
+			 *          Async run on an executor whose @ref Executor::Capacity() is
+			 *          below that for the run alone fails at once instead of stalling.
+			 */
+			void 													SetExecutor(std::shared_ptr<Executor> executor) noexcept;
+
+		private:
+			/**
+			 * @brief One node: exactly one of the three functions is set.
+			 */
+			struct Node {
+				PipeFunction stage;									///< One input, one output.
+				SplitFunction split;								///< One input, several outputs.
+				MergeFunction merge;								///< Several inputs, one output.
+				std::vector<std::size_t> inputs;					///< Streams read, in order.
+				std::vector<std::size_t> outputs;					///< Streams written, in order.
+			};
+
+			std::vector<Node> m_nodes;								///< Nodes in execution order.
+			std::size_t m_streams {1};								///< Streams created, the input included.
+			std::shared_ptr<Executor> m_executor;					///< Executor running the nodes (null: ThreadPool::Shared()).
+			std::shared_ptr<FIFOPool> m_pool;						///< Source of single-reader streams (null: not pooled).
+
+			/**
+			 * @brief Create the next @p count streams.
+			 * @param count Number of streams.
+			 * @return Their ids.
+			 */
+			std::vector<std::size_t> 								NewStreams(const std::size_t& count);
+	};
+}
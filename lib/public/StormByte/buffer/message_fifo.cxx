@@ -0,0 +1,262 @@
+#include <StormByte/buffer/message_fifo.hxx>
+
+#include <algorithm>
+#include <sstream>
+
+using namespace StormByte::Buffer;
+
+MessageFIFO::MessageFIFO() noexcept: SharedFIFO() {}
+
+std::size_t MessageFIFO::AvailableBytes() const noexcept {
+	return m_available.load(std::memory_order_acquire);
+}
+
+void MessageFIFO::Clean() noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	m_messages.Release(m_read);
+	Update();
+}
+
+void MessageFIFO::Clear() noexcept {
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		m_messages.Clear();
+		m_read = m_messages.End();
+		Update();
+	}
+	Signal();
+}
+
+void MessageFIFO::Close() noexcept {
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		m_closed.store(true, std::memory_order_release);
+	}
+	Trace(Tracer::Kind::Close);
+	m_cv.notify_all();
+	Signal();
+}
+
+bool MessageFIFO::Drop(const std::size_t& count) noexcept {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	if (count != 0 && count > m_messages.End() - m_read)
+		WaitReadable(count, lock);
+
+	const std::size_t avail = m_messages.End() - m_read;
+	if (m_error || avail == 0 || count > avail)
+		return false;
+	m_read += count;
+	m_messages.Release(m_read);
+	CountRead(count);
+	Update();
+	return true;
+}
+
+bool MessageFIFO::Empty() const noexcept {
+	return Size() == 0;
+}
+
+bool MessageFIFO::EoF() const noexcept {
+	if (m_error.load(std::memory_order_acquire))
+		return true;
+	return m_closed.load(std::memory_order_acquire) && AvailableBytes() == 0;
+}
+
+bool MessageFIFO::ExtractMessage(DataType& outBuffer) noexcept {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	if (m_error)
+		return false;
+	WaitReadable(1, lock);
+	if (m_error || m_messages.End() == m_read)
+		return false;
+
+	// Bytes passed by Read() go first, then the front message leaves by move
+	const std::size_t avail = m_messages.End() - m_read;
+	m_messages.Release(m_read);
+	(void)m_messages.Pop(outBuffer);
+	m_read = m_messages.Begin();
+	CountRead(avail - (m_messages.End() - m_read));
+	Update();
+	return true;
+}
+
+std::string MessageFIFO::HexDump(const std::size_t& collumns, const std::size_t& byte_limit) const noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	const std::size_t begin = m_messages.Begin();
+	const std::size_t avail = m_messages.End() - m_read;
+	const std::size_t count = byte_limit > 0 ? std::min(avail, byte_limit) : avail;
+
+	std::ostringstream oss;
+	oss << "Size: " << m_messages.Size() << " bytes\n";
+	oss << "Read Position: " << m_read - begin << '\n';
+	oss << "Status: " << (m_closed ? "closed" : "opened") << " and " << (m_error ? "error" : "ready");
+	oss << '\n';
+
+	if (count > 0) {
+		DataType data;
+		(void)m_messages.Copy(m_read, count, data);
+		std::span<const std::byte> view(data.data(), data.size());
+		oss << FormatHexLines(view, m_read - begin, collumns == 0 ? 16 : collumns);
+	}
+	return oss.str();
+}
+
+std::size_t MessageFIFO::Messages() const noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	return m_messages.Chunks(m_read);
+}
+
+bool MessageFIFO::ReadMessage(DataType& outBuffer) noexcept {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	if (m_error)
+		return false;
+	WaitReadable(1, lock);
+	if (m_error || m_messages.End() == m_read)
+		return false;
+
+	const std::size_t end = m_messages.ChunkEnd(m_read);
+	outBuffer.clear();
+	(void)m_messages.Copy(m_read, end - m_read, outBuffer);
+	CountRead(end - m_read);
+	m_read = end;
+	Update();
+	return true;
+}
+
+void MessageFIFO::Seek(const std::ptrdiff_t& offset, const Position& mode) const noexcept {
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		const std::ptrdiff_t begin = static_cast<std::ptrdiff_t>(m_messages.Begin());
+		const std::ptrdiff_t end = static_cast<std::ptrdiff_t>(m_messages.End());
+		const std::ptrdiff_t base = mode == Position::Absolute ? begin : static_cast<std::ptrdiff_t>(m_read);
+		m_read = static_cast<std::size_t>(std::clamp(base + offset, begin, end));
+		Update();
+	}
+	// Seeking back makes bytes readable again
+	m_cv.notify_all();
+	Signal();
+}
+
+void MessageFIFO::SetError() noexcept {
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		m_error.store(true, std::memory_order_release);
+	}
+	Trace(Tracer::Kind::Error);
+	m_cv.notify_all();
+	Signal();
+}
+
+std::size_t MessageFIFO::Size() const noexcept {
+	return m_retained.load(std::memory_order_acquire);
+}
+
+void MessageFIFO::Append(DataType&& message) noexcept {
+	CountWrite(message.size(), m_messages.End() - m_read + message.size());
+	m_messages.Push(std::move(message));
+	Update();
+}
+
+void MessageFIFO::Update() const noexcept {
+	m_available.store(m_messages.End() - m_read, std::memory_order_release);
+	m_retained.store(m_messages.Size(), std::memory_order_release);
+}
+
+bool MessageFIFO::ReadInternal(const std::size_t& count, DataType& outBuffer, const Operation& flag) noexcept {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	std::size_t avail = m_messages.End() - m_read;
+	if (m_error || (m_closed && avail == 0))
+		return false;
+
+	const std::size_t real_count = count == 0 ? avail : count;
+	if (real_count > avail && !m_closed) {
+		WaitReadable(real_count, lock);
+		avail = m_messages.End() - m_read;
+	}
+	if (m_error || (avail == 0 && count == 0) || real_count > avail)
+		return false;
+
+	switch (flag) {
+		case Operation::Peek:
+			(void)m_messages.Copy(m_read, real_count, outBuffer);
+			return true;
+		case Operation::Read:
+			(void)m_messages.Copy(m_read, real_count, outBuffer);
+			m_read += real_count;
+			break;
+		case Operation::Extract: {
+			m_messages.Release(m_read);
+			std::size_t remaining = real_count;
+			// A whole front message is moved out instead of copied
+			if (outBuffer.empty() && m_messages.FrontSize() <= remaining) {
+				(void)m_messages.Pop(outBuffer);
+				remaining -= outBuffer.size();
+			}
+			(void)m_messages.Copy(m_messages.Begin(), remaining, outBuffer);
+			m_read = m_messages.Begin() + remaining;
+			m_messages.Release(m_read);
+			break;
+		}
+		default:
+			return false;
+	}
+	// Bytes the read position moved past; Read() bytes extracted again are not counted twice
+	const std::size_t left = m_messages.End() - m_read;
+	CountRead(avail > left ? avail - left : 0);
+	Update();
+	return true;
+}
+
+bool MessageFIFO::ReadInternal(const std::size_t& count, WriteOnly& outBuffer, const Operation& flag) noexcept {
+	DataType data;
+	if (!ReadInternal(count, data, flag))
+		return false;
+	return outBuffer.Write(0, std::move(data));
+}
+
+void MessageFIFO::WaitReadable(const std::size_t& n, std::unique_lock<std::mutex>& lock) const {
+	const auto ready = [&] {
+		return m_closed || m_error || m_messages.End() - m_read >= n;
+	};
+	if (ready())
+		return;
+	const auto start = StartWait();
+	m_cv.wait(lock, ready);
+	CountWait(start, false);
+}
+
+bool MessageFIFO::WriteInternal(const std::size_t& count, const DataType& src) noexcept {
+	if (count > 0 && src.size() < count)
+		return false;
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		if (m_closed || m_error)
+			return false;
+		m_messages.Push(src, count);
+		CountWrite(count == 0 ? src.size() : count, m_messages.End() - m_read);
+		Update();
+	}
+	m_cv.notify_all();
+	Signal();
+	return true;
+}
+
+bool MessageFIFO::WriteInternal(const std::size_t& count, DataType&& src) noexcept {
+	if (count > 0 && src.size() < count)
+		return false;
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		if (m_closed || m_error)
+			return false;
+		const std::size_t bytes = count == 0 ? src.size() : count;
+		if (count == 0 || count == src.size())
+			m_messages.Push(std::move(src));
+		else
+			m_messages.Push(src, count);
+		CountWrite(bytes, m_messages.End() - m_read);
+		Update();
+	}
+	m_cv.notify_all();
+	Signal();
+	return true;
+}
\ No newline at end of file
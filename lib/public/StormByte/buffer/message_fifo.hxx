@@ -0,0 +1,225 @@
+#pragma once
+
+#include <StormByte/buffer/chunk_queue.hxx>
+#include <StormByte/buffer/shared_fifo.hxx>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class MessageFIFO
+	 * @brief SharedFIFO that keeps write boundaries, for message-oriented streams.
+	 *
+	 * @par Overview
+	 *  Every write is stored as its own node in a @ref ChunkQueue instead of being
+	 *  appended to one contiguous vector. A vector written by move is kept as is,
+	 *  and @ref ExtractMessage() hands it back out by move, so passing a message
+	 *  from a Producer to a Consumer copies no bytes.
+	 *
+	 * @par Messages and bytes
+	 *  A message is one write. @ref ReadMessage() and @ref ExtractMessage() return
+	 *  the message at the read position. If byte-level reads stopped inside a
+	 *  message, they return the rest of it. Byte-level reads (@ref Read(),
+	 *  @ref Extract(), @ref Peek(), @ref Drop()) work as in a @ref SharedFIFO and
+	 *  may span message boundaries.
+	 *
+	 * @par Semantics
+	 *  Blocking, close and error behave as in @ref SharedFIFO. Positions are
+	 *  relative to the oldest retained byte. Differences:
+	 *  - @ref Extract() and @ref ExtractMessage() release every byte up to the new
+	 *    read position, including bytes previously passed by @ref Read();
+	 *  - @ref Data() is not available (messages are not contiguous) and returns an
+	 *    empty buffer; use @ref Peek() instead.
+	 *  Producer write combining merges small writes and so merges messages too;
+	 *  leave it disabled on producers feeding a MessageFIFO.
+	 *
+	 * @par Thread safety
+	 *  All public member functions are thread-safe. Status queries only load atomics.
+	 *
+	 * @see ReorderFIFO, which feeds the messages in sequence order.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC MessageFIFO: public SharedFIFO {
+		public:
+			/**
+			 * @brief Construct an empty MessageFIFO.
+			 */
+			MessageFIFO() noexcept;
+
+			/**
+			 * @brief Copy constructor deleted.
+			 */
+			MessageFIFO(const MessageFIFO&)							= delete;
+
+			/**
+			 * @brief Move constructor deleted.
+			 */
+			MessageFIFO(MessageFIFO&&)								= delete;
+
+			/**
+			 * @brief Destructor.
+			 */
+			~MessageFIFO() noexcept override						= default;
+
+			/**
+			 * @brief Copy assignment deleted.
+			 */
+			MessageFIFO& operator=(const MessageFIFO&)				= delete;
+
+			/**
+			 * @brief Move assignment deleted.
+			 */
+			MessageFIFO& operator=(MessageFIFO&&)					= delete;
+
+			/**
+			 * @brief Get the number of bytes from the read position to the end.
+			 * @return Readable bytes.
+			 */
+			std::size_t 											AvailableBytes() const noexcept override;
+
+			/**
+			 * @brief Release every byte before the read position.
+			 */
+			void 													Clean() noexcept override;
+
+			/**
+			 * @brief Release every message and move the read position to the end.
+			 */
+			void 													Clear() noexcept override;
+
+			/**
+			 * @brief Close for further writes and wake every waiter.
+			 */
+			void 													Close() noexcept override;
+
+			/**
+			 * @brief Contiguous data is not available for a queue of messages.
+			 * @return An empty buffer.
+			 */
+			inline const DataType& 									Data() const noexcept override {
+				return m_buffer;
+			}
+
+			/**
+			 * @brief Skip and release @p count bytes, blocking like @ref Read().
+			 * @param count Number of bytes to skip.
+			 * @return false if not enough bytes became available, true otherwise.
+			 */
+			bool 													Drop(const std::size_t& count) noexcept override;
+
+			/**
+			 * @brief Check whether no bytes are retained.
+			 * @return true if nothing is stored.
+			 */
+			bool 													Empty() const noexcept override;
+
+			/**
+			 * @brief Check for end of stream.
+			 * @return true if errored, or closed with no bytes left to read.
+			 */
+			bool 													EoF() const noexcept override;
+
+			/**
+			 * @brief Blocking destructive read of the next message.
+			 * @param outBuffer Replaced with the message. A message not partially read
+			 *        before is the written vector itself, moved out.
+			 * @return false if no message became available (closed or error), true otherwise.
+			 */
+			bool 													ExtractMessage(DataType& outBuffer) noexcept override;
+
+			/**
+			 * @brief Hex dump of the retained bytes.
+			 * @param collumns Bytes per line (0 selects 16).
+			 * @param byte_limit Maximum bytes to dump (0 for all available).
+			 * @return Formatted dump.
+			 */
+			std::string 											HexDump(const std::size_t& collumns = 0, const std::size_t& byte_limit = 0) const noexcept override;
+
+			/**
+			 * @brief Number of messages from the read position to the end.
+			 * @return Messages readable, counting a partially read one.
+			 */
+			std::size_t 											Messages() const noexcept;
+
+			/**
+			 * @brief Blocking copy of the next message, advancing the read position past it.
+			 * @param outBuffer Replaced with the message bytes.
+			 * @return false if no message became available (closed or error), true otherwise.
+			 */
+			bool 													ReadMessage(DataType& outBuffer) noexcept override;
+
+			/**
+			 * @brief Move the read position within the retained bytes.
+			 * @param offset Offset to apply.
+			 * @param mode Absolute (from the oldest retained byte) or Relative.
+			 */
+			void 													Seek(const std::ptrdiff_t& offset, const Position& mode) const noexcept override;
+
+			/**
+			 * @brief Mark the buffer as errored and wake every waiter.
+			 */
+			void 													SetError() noexcept override;
+
+			/**
+			 * @brief Get the number of retained bytes.
+			 * @return Bytes written and not yet released.
+			 */
+			std::size_t 											Size() const noexcept override;
+
+		protected:
+			/**
+			 * @brief Store @p message as one message, by move. Requires @c m_mutex.
+			 * @param message Bytes to store; empty messages are skipped.
+			 * @details Waiters are not woken: the caller notifies @c m_cv and calls
+			 *          Signal() once it released the lock.
+			 */
+			void 													Append(DataType&& message) noexcept;
+
+		private:
+			ChunkQueue m_messages;									///< Stored messages.
+			mutable std::size_t m_read {0};							///< Absolute read position.
+			mutable std::atomic<std::size_t> m_available {0};		///< Published readable bytes.
+			mutable std::atomic<std::size_t> m_retained {0};		///< Published retained bytes.
+
+			/**
+			 * @brief Publish the byte counters for lock-free status queries. Requires @c m_mutex.
+			 */
+			void 													Update() const noexcept;
+
+			/**
+			 * @brief Blocking read.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													ReadInternal(const std::size_t& count, DataType& outBuffer, const Operation& flag) noexcept override;
+
+			/**
+			 * @brief Blocking read into a WriteOnly buffer; an extracted whole message is passed on by move.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													ReadInternal(const std::size_t& count, WriteOnly& outBuffer, const Operation& flag) noexcept override;
+
+			/**
+			 * @brief Wait until @p n bytes are readable, or closed/errored.
+			 * @param n Number of bytes required.
+			 * @param lock Held lock on @c m_mutex.
+			 */
+			void 													WaitReadable(const std::size_t& n, std::unique_lock<std::mutex>& lock) const;
+
+			/**
+			 * @brief Store a copy of @p count bytes of @p src (0 for all) as one message.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													WriteInternal(const std::size_t& count, const DataType& src) noexcept override;
+
+			/**
+			 * @brief Store @p src as one message, moving it when it is written whole.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													WriteInternal(const std::size_t& count, DataType&& src) noexcept override;
+	};
+}
@@ -0,0 +1,290 @@
+#include <StormByte/buffer/mpmc_fifo.hxx>
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+using namespace StormByte::Buffer;
+
+namespace {
+	std::size_t RingSize(const std::size_t& capacity) noexcept {
+		std::size_t size = 2;
+		while (size < capacity)
+			size <<= 1;
+		return size;
+	}
+}
+
+MPMCFIFO::MPMCFIFO(const std::size_t& capacity) noexcept:
+SharedFIFO(), m_cells(new Cell[RingSize(capacity)]), m_mask(RingSize(capacity) - 1) {
+	for (std::size_t i = 0; i <= m_mask; ++i)
+		m_cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+MPMCFIFO::~MPMCFIFO() noexcept = default;
+
+std::size_t MPMCFIFO::AvailableBytes() const noexcept {
+	// Consumed first: it never passes the visible count loaded afterwards
+	const std::size_t consumed = m_consumed.load(std::memory_order_acquire);
+	return m_visible.load(std::memory_order_seq_cst) - consumed;
+}
+
+void MPMCFIFO::Clean() noexcept {}
+
+void MPMCFIFO::Clear() noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	CopyOut(AvailableBytes(), nullptr, true);
+}
+
+void MPMCFIFO::Close() noexcept {
+	m_closing.store(true, std::memory_order_seq_cst);
+	SignalSpace(true);
+	// Writers that passed the closing check finish publishing before EoF can be seen
+	while (m_inflight.load(std::memory_order_seq_cst) > 0)
+		std::this_thread::yield();
+	m_closed.store(true, std::memory_order_seq_cst);
+	SignalData(true);
+}
+
+bool MPMCFIFO::Drop(const std::size_t& count) noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	if (count != 0 && count > AvailableBytes())
+		WaitReadable(count);
+
+	const std::size_t avail = AvailableBytes();
+	if (avail == 0 || count > avail)
+		return false;
+	CopyOut(count, nullptr, true);
+	return true;
+}
+
+bool MPMCFIFO::Empty() const noexcept {
+	return AvailableBytes() == 0;
+}
+
+bool MPMCFIFO::EoF() const noexcept {
+	if (m_error.load(std::memory_order_acquire))
+		return true;
+	return m_closed.load(std::memory_order_acquire) && AvailableBytes() == 0;
+}
+
+std::string MPMCFIFO::HexDump(const std::size_t& collumns, const std::size_t& byte_limit) const noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	const std::size_t avail = AvailableBytes();
+	const std::size_t count = byte_limit > 0 ? std::min(avail, byte_limit) : avail;
+	const std::size_t position = m_consumed.load(std::memory_order_relaxed);
+
+	std::ostringstream oss;
+	oss << "Size: " << avail << " bytes\n";
+	oss << "Read Position: " << position << '\n';
+	oss << "Status: " << (m_closed ? "closed" : "opened") << " and " << (m_error ? "error" : "ready");
+	oss << '\n';
+
+	if (count > 0) {
+		DataType data;
+		CopyOut(count, &data, false);
+		std::span<const std::byte> view(data.data(), data.size());
+		oss << FormatHexLines(view, position, collumns == 0 ? 16 : collumns);
+	}
+	return oss.str();
+}
+
+void MPMCFIFO::Seek(const std::ptrdiff_t& offset, const Position&) const noexcept {
+	if (offset <= 0)
+		return;
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	CopyOut(std::min(static_cast<std::size_t>(offset), AvailableBytes()), nullptr, true);
+}
+
+void MPMCFIFO::SetError() noexcept {
+	m_error.store(true, std::memory_order_seq_cst);
+	SignalSpace(true);
+	SignalData(true);
+}
+
+std::size_t MPMCFIFO::Size() const noexcept {
+	return AvailableBytes();
+}
+
+void MPMCFIFO::Advance() noexcept {
+	bool advanced = false;
+	std::size_t frontier = m_frontier.load(std::memory_order_seq_cst);
+	while (true) {
+		const Cell& cell = m_cells[frontier & m_mask];
+		if (cell.sequence.load(std::memory_order_seq_cst) != frontier + 1)
+			break;
+		// If the cell is consumed and reused meanwhile the frontier moved on and the CAS fails
+		const std::size_t size = cell.size.load(std::memory_order_relaxed);
+		if (m_frontier.compare_exchange_strong(frontier, frontier + 1, std::memory_order_seq_cst)) {
+			m_visible.fetch_add(size, std::memory_order_seq_cst);
+			advanced = true;
+			++frontier;
+		}
+	}
+	if (advanced)
+		SignalData();
+}
+
+void MPMCFIFO::CopyOut(const std::size_t& count, DataType* out, const bool& consume) const noexcept {
+	std::size_t head = m_head;
+	std::size_t offset = m_head_offset;
+	std::size_t remaining = count;
+	bool freed = false;
+
+	if (out && (!out->empty() || offset != 0))
+		out->reserve(out->size() + count);
+	while (remaining > 0) {
+		Cell& cell = m_cells[head & m_mask];
+		const std::size_t size = cell.data.size();
+		const std::size_t take = std::min(remaining, size - offset);
+		if (out) {
+			if (consume && offset == 0 && take == size && out->empty())
+				*out = std::move(cell.data);
+			else
+				out->insert(out->end(), cell.data.begin() + static_cast<std::ptrdiff_t>(offset), cell.data.begin() + static_cast<std::ptrdiff_t>(offset + take));
+		}
+		offset += take;
+		remaining -= take;
+		if (offset == size) {
+			if (consume) {
+				DataType().swap(cell.data);
+				cell.sequence.store(head + m_mask + 1, std::memory_order_seq_cst);
+				freed = true;
+			}
+			++head;
+			offset = 0;
+		}
+	}
+
+	if (consume) {
+		m_head = head;
+		m_head_offset = offset;
+		m_consumed.fetch_add(count, std::memory_order_release);
+		if (freed)
+			SignalSpace();
+	}
+}
+
+bool MPMCFIFO::Push(DataType&& data) noexcept {
+	if (data.empty())
+		return IsWritable();
+
+	m_inflight.fetch_add(1, std::memory_order_seq_cst);
+	if (m_closing.load(std::memory_order_seq_cst) || m_error.load(std::memory_order_seq_cst)) {
+		m_inflight.fetch_sub(1, std::memory_order_seq_cst);
+		return false;
+	}
+
+	const std::size_t ticket = m_tail.fetch_add(1, std::memory_order_relaxed);
+	Cell& cell = m_cells[ticket & m_mask];
+	if (cell.sequence.load(std::memory_order_seq_cst) != ticket) {
+		// Ring is full: wait for a consumer to free this cell
+		m_space_waiters.fetch_add(1, std::memory_order_seq_cst);
+		while (true) {
+			const std::uint32_t signal = m_space_signal.load(std::memory_order_seq_cst);
+			if (cell.sequence.load(std::memory_order_seq_cst) == ticket)
+				break;
+			if (m_closing.load(std::memory_order_seq_cst) || m_error.load(std::memory_order_seq_cst)) {
+				// Mark the ticket abandoned before looking at the cell one last time:
+				// cells are freed in ticket order, so any later ticket that gets its
+				// cell from here on sees the mark and fails instead of publishing
+				// past a gap the frontier can never cross
+				std::size_t abandoned = m_abandoned.load(std::memory_order_seq_cst);
+				while (ticket < abandoned && !m_abandoned.compare_exchange_weak(abandoned, ticket, std::memory_order_seq_cst))
+					;
+				if (cell.sequence.load(std::memory_order_seq_cst) == ticket)
+					break;
+				m_space_waiters.fetch_sub(1, std::memory_order_seq_cst);
+				m_inflight.fetch_sub(1, std::memory_order_seq_cst);
+				return false;
+			}
+			m_space_signal.wait(signal, std::memory_order_seq_cst);
+		}
+		m_space_waiters.fetch_sub(1, std::memory_order_seq_cst);
+	}
+
+	if (ticket > m_abandoned.load(std::memory_order_seq_cst)) {
+		// An earlier ticket was abandoned: this write would never become readable
+		m_inflight.fetch_sub(1, std::memory_order_seq_cst);
+		return false;
+	}
+
+	const std::size_t size = data.size();
+	cell.data = std::move(data);
+	cell.size.store(size, std::memory_order_relaxed);
+	cell.sequence.store(ticket + 1, std::memory_order_seq_cst);
+
+	Advance();
+	m_inflight.fetch_sub(1, std::memory_order_seq_cst);
+	return true;
+}
+
+bool MPMCFIFO::ReadInternal(const std::size_t& count, DataType& outBuffer, const Operation& flag) noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	std::size_t avail = AvailableBytes();
+	if (m_error || (m_closed && avail == 0))
+		return false;
+
+	const std::size_t real_count = count == 0 ? avail : count;
+	if (real_count > avail && !m_closed) {
+		WaitReadable(real_count);
+		avail = AvailableBytes();
+	}
+	if (m_error || (avail == 0 && count == 0) || real_count > avail)
+		return false;
+
+	CopyOut(real_count, &outBuffer, flag != Operation::Peek);
+	return true;
+}
+
+bool MPMCFIFO::ReadInternal(const std::size_t& count, WriteOnly& outBuffer, const Operation& flag) noexcept {
+	DataType data;
+	if (!ReadInternal(count, data, flag))
+		return false;
+	return outBuffer.Write(0, std::move(data));
+}
+
+void MPMCFIFO::SignalData(const bool& force) const noexcept {
+	// Consumers register before re-checking the visible count, so either they
+	// see the new bytes or we see them waiting
+	if (force || m_data_waiters.load(std::memory_order_seq_cst) > 0) {
+		m_data_signal.fetch_add(1, std::memory_order_seq_cst);
+		m_data_signal.notify_all();
+	}
+	Signal();
+}
+
+void MPMCFIFO::SignalSpace(const bool& force) const noexcept {
+	if (force || m_space_waiters.load(std::memory_order_seq_cst) > 0) {
+		m_space_signal.fetch_add(1, std::memory_order_seq_cst);
+		m_space_signal.notify_all();
+	}
+}
+
+void MPMCFIFO::WaitReadable(const std::size_t& n) const noexcept {
+	m_data_waiters.fetch_add(1, std::memory_order_seq_cst);
+	while (true) {
+		const std::uint32_t signal = m_data_signal.load(std::memory_order_seq_cst);
+		if (m_closed.load(std::memory_order_seq_cst) || m_error.load(std::memory_order_seq_cst) || AvailableBytes() >= n)
+			break;
+		m_data_signal.wait(signal, std::memory_order_seq_cst);
+	}
+	m_data_waiters.fetch_sub(1, std::memory_order_seq_cst);
+}
+
+bool MPMCFIFO::WriteInternal(const std::size_t& count, const DataType& src) noexcept {
+	if (count > 0 && src.size() < count)
+		return false;
+	if (!IsWritable())
+		return false;
+	const std::size_t real_count = (count == 0) ? src.size() : count;
+	return Push(DataType(src.begin(), src.begin() + static_cast<std::ptrdiff_t>(real_count)));
+}
+
+bool MPMCFIFO::WriteInternal(const std::size_t& count, DataType&& src) noexcept {
+	if (count > 0 && src.size() < count)
+		return false;
+	if (count != 0 && count < src.size())
+		return Push(DataType(std::make_move_iterator(src.begin()), std::make_move_iterator(src.begin() + static_cast<std::ptrdiff_t>(count))));
+	return Push(std::move(src));
+}
\ No newline at end of file
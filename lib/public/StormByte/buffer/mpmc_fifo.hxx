@@ -0,0 +1,271 @@
+#pragma once
+
+#include <StormByte/buffer/shared_fifo.hxx>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class MPMCFIFO
+	 * @brief SharedFIFO whose write path takes no lock, for many concurrent producers.
+	 *
+	 * @par Overview
+	 *  Storage is a ring of cells, each holding one whole write. A producer claims
+	 *  the next cell with an atomic fetch-add on the tail ticket, moves its bytes
+	 *  into the cell and publishes it by storing the cell's sequence number. No
+	 *  producer ever waits for another one to finish copying, and because a write
+	 *  occupies a single cell, writes from different producers are never
+	 *  interleaved byte-wise.
+	 *
+	 * @par Publish protocol
+	 *  Cells may be published out of order. A shared frontier ticket marks the
+	 *  end of the contiguous published prefix. Every producer advances it after
+	 *  publishing, over its own cell and any later cells that are already
+	 *  published. Consumers only ever read cells behind the frontier, so they
+	 *  never observe a partially written region.
+	 *
+	 * @par Consumers
+	 *  Consumers serialize among themselves on the inherited mutex but never
+	 *  contend with producers. This buffer is a queue: @ref Read() and
+	 *  @ref Extract() both consume bytes, @ref Peek() does not, and @ref Seek()
+	 *  can only skip forward.
+	 *
+	 * @par Capacity
+	 *  The ring holds @c capacity writes (rounded up to a power of two). When it
+	 *  is full, producers wait for consumers to free a cell. Bytes per write are
+	 *  not limited.
+	 *
+	 * @par Thread safety
+	 *  All public member functions are thread-safe. Status queries only load atomics.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC MPMCFIFO final: public SharedFIFO {
+		public:
+			/**
+			 * @brief Construct an MPMCFIFO.
+			 * @param capacity Number of in-flight writes the ring holds (minimum 2).
+			 */
+			MPMCFIFO(const std::size_t& capacity = 1024) noexcept;
+
+			/**
+			 * @brief Copy constructor deleted.
+			 */
+			MPMCFIFO(const MPMCFIFO&)								= delete;
+
+			/**
+			 * @brief Move constructor deleted.
+			 */
+			MPMCFIFO(MPMCFIFO&&)									= delete;
+
+			/**
+			 * @brief Destructor.
+			 */
+			~MPMCFIFO() noexcept override;
+
+			/**
+			 * @brief Copy assignment deleted.
+			 */
+			MPMCFIFO& operator=(const MPMCFIFO&)					= delete;
+
+			/**
+			 * @brief Move assignment deleted.
+			 */
+			MPMCFIFO& operator=(MPMCFIFO&&)							= delete;
+
+			/**
+			 * @brief Get the number of published bytes not yet consumed.
+			 * @return Readable bytes.
+			 */
+			std::size_t 											AvailableBytes() const noexcept override;
+
+			/**
+			 * @brief Number of cells in the ring.
+			 * @return Maximum number of writes buffered at once.
+			 */
+			inline std::size_t 										Capacity() const noexcept {
+				return m_mask + 1;
+			}
+
+			/**
+			 * @brief No-op: consumed bytes are released immediately.
+			 */
+			void 													Clean() noexcept override;
+
+			/**
+			 * @brief Consume every published byte.
+			 */
+			void 													Clear() noexcept override;
+
+			/**
+			 * @brief Close for further writes.
+			 * @details Waits for writes already in progress to be published, so every
+			 *          write that returned true is readable before @ref EoF().
+			 *          Producers waiting for a free cell give up and return false.
+			 */
+			void 													Close() noexcept override;
+
+			/**
+			 * @brief Contiguous data is not available for a ring of cells.
+			 * @return An empty buffer.
+			 */
+			inline const DataType& 									Data() const noexcept override {
+				return m_buffer;
+			}
+
+			/**
+			 * @brief Skip @p count bytes, blocking like @ref Read().
+			 * @param count Number of bytes to skip.
+			 * @return false if not enough bytes became available, true otherwise.
+			 */
+			bool 													Drop(const std::size_t& count) noexcept override;
+
+			/**
+			 * @brief Check whether no bytes are buffered.
+			 * @return true if nothing is readable.
+			 */
+			bool 													Empty() const noexcept override;
+
+			/**
+			 * @brief Check for end of stream.
+			 * @return true if errored, or closed with no bytes left to read.
+			 */
+			bool 													EoF() const noexcept override;
+
+			/**
+			 * @brief Hex dump of the readable bytes.
+			 * @param collumns Bytes per line (0 selects 16).
+			 * @param byte_limit Maximum bytes to dump (0 for all available).
+			 * @return Formatted dump.
+			 */
+			std::string 											HexDump(const std::size_t& collumns = 0, const std::size_t& byte_limit = 0) const noexcept override;
+
+			/**
+			 * @brief Check whether writes are accepted.
+			 * @return false once closing has started or an error was set.
+			 */
+			inline bool 											IsWritable() const noexcept override {
+				return !m_closing.load(std::memory_order_acquire) && !m_error.load(std::memory_order_acquire);
+			}
+
+			/**
+			 * @brief Skip forward; consumed bytes cannot be revisited.
+			 * @param offset Bytes to skip (negative offsets are ignored).
+			 * @param mode Both modes skip from the current read position.
+			 */
+			void 													Seek(const std::ptrdiff_t& offset, const Position& mode) const noexcept override;
+
+			/**
+			 * @brief Mark the buffer as errored and wake every waiter.
+			 */
+			void 													SetError() noexcept override;
+
+			/**
+			 * @brief Get the number of buffered bytes.
+			 * @return Same as @ref AvailableBytes().
+			 */
+			std::size_t 											Size() const noexcept override;
+
+		private:
+			/**
+			 * @brief One ring slot.
+			 * @details @c sequence equals the ticket that may fill the cell next, or
+			 *          that ticket plus one once it is published.
+			 */
+			struct Cell {
+				std::atomic<std::size_t> sequence {0};				///< Publication state.
+				std::atomic<std::size_t> size {0};					///< Size of @c data, readable without owning the cell.
+				DataType data;										///< Written bytes.
+			};
+
+			std::unique_ptr<Cell[]> m_cells;						///< Ring storage.
+			const std::size_t m_mask;								///< Ring size minus one.
+
+			alignas(64) std::atomic<std::size_t> m_tail {0};		///< Next ticket to claim.
+			std::atomic<std::size_t> m_inflight {0};				///< Writes between claim check and publish.
+			std::atomic<bool> m_closing {false};					///< Set by Close() before draining writers.
+			std::atomic<std::size_t> m_abandoned {std::numeric_limits<std::size_t>::max()};	///< Lowest ticket given up on while closing.
+
+			alignas(64) std::atomic<std::size_t> m_frontier {0};	///< First ticket not yet in the published prefix.
+			std::atomic<std::size_t> m_visible {0};					///< Bytes in the published prefix.
+
+			alignas(64) mutable std::size_t m_head {0};				///< Next ticket to consume (consumer lock).
+			mutable std::size_t m_head_offset {0};					///< Bytes consumed from the head cell (consumer lock).
+			mutable std::atomic<std::size_t> m_consumed {0};		///< Bytes consumed.
+
+			mutable std::atomic<std::uint32_t> m_data_signal {0};	///< Bumped to wake consumers.
+			mutable std::atomic<std::size_t> m_data_waiters {0};	///< Consumers waiting for data.
+			mutable std::atomic<std::uint32_t> m_space_signal {0};	///< Bumped to wake producers.
+			std::atomic<std::size_t> m_space_waiters {0};			///< Producers waiting for a free cell.
+
+			/**
+			 * @brief Advance the frontier over every published cell.
+			 */
+			void 													Advance() noexcept;
+
+			/**
+			 * @brief Copy or move bytes out of the head cells. Requires the consumer lock.
+			 * @param count Number of bytes; must be readable.
+			 * @param out Vector the bytes are appended to (may be null to skip).
+			 * @param consume Whether to consume the bytes and free exhausted cells.
+			 */
+			void 													CopyOut(const std::size_t& count, DataType* out, const bool& consume) const noexcept;
+
+			/**
+			 * @brief Claim a cell and publish @p data in it.
+			 * @param data Bytes of one write.
+			 * @return false if closing, errored or the cell never became free.
+			 */
+			bool 													Push(DataType&& data) noexcept;
+
+			/**
+			 * @brief Blocking read.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													ReadInternal(const std::size_t& count, DataType& outBuffer, const Operation& flag) noexcept override;
+
+			/**
+			 * @brief Blocking read into a WriteOnly buffer.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													ReadInternal(const std::size_t& count, WriteOnly& outBuffer, const Operation& flag) noexcept override;
+
+			/**
+			 * @brief Wake consumers blocked in @ref WaitReadable().
+			 * @param force Wake even if no consumer registered as waiting.
+			 */
+			void 													SignalData(const bool& force = false) const noexcept;
+
+			/**
+			 * @brief Wake producers waiting for a free cell.
+			 * @param force Wake even if no producer registered as waiting.
+			 */
+			void 													SignalSpace(const bool& force = false) const noexcept;
+
+			/**
+			 * @brief Wait until @p n bytes are readable, or closed/errored. Requires the consumer lock.
+			 * @param n Number of bytes required.
+			 */
+			void 													WaitReadable(const std::size_t& n) const noexcept;
+
+			/**
+			 * @brief Copy @p count bytes of @p src (0 for all) into a new write.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													WriteInternal(const std::size_t& count, const DataType& src) noexcept override;
+
+			/**
+			 * @brief Move @p src into a new write when it is written whole.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													WriteInternal(const std::size_t& count, DataType&& src) noexcept override;
+	};
+}
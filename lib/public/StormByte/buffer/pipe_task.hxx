@@ -0,0 +1,146 @@
+#pragma once
+
+#include <StormByte/buffer/visibility.h>
+
+#include <coroutine>
+#include <functional>
+#include <utility>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class PipeTask
+	 * @brief Coroutine type returned by cooperative pipeline stages (AsyncPipeFunction).
+	 *
+	 * @par Overview
+	 *  A stage written as a coroutine waits for input with @c co_await on
+	 *  Consumer::ExtractSomeAsync() and related calls instead of blocking. While
+	 *  suspended it holds no thread: the write that makes it ready posts its
+	 *  continuation to the executor it awaited with.
+	 *
+	 * @par Lifetime
+	 *  The coroutine is created suspended. @ref Start() runs it up to its first
+	 *  suspension and hands the frame over to the coroutine itself, which frees
+	 *  it when it returns; a task never started frees it on destruction. An
+	 *  exception escaping the coroutine is reported to the completion callback.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC PipeTask final {
+		public:
+			/**
+			 * @brief Completion callback; receives true if the coroutine threw.
+			 */
+			using Completion = std::function<void(const bool&)>;
+
+			/**
+			 * @brief Coroutine promise.
+			 */
+			struct promise_type {
+				Completion m_done;										///< Called once the coroutine returns.
+				bool m_failed {false};									///< Whether an exception escaped.
+
+				/**
+				 * @brief Final awaiter freeing the frame, then reporting completion.
+				 */
+				struct Final {
+					inline bool 										await_ready() const noexcept {
+						return false;
+					}
+
+					inline void 										await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+						Completion done = std::move(handle.promise().m_done);
+						const bool failed = handle.promise().m_failed;
+						handle.destroy();
+						if (done)
+							done(failed);
+					}
+
+					inline void 										await_resume() const noexcept {}
+				};
+
+				inline PipeTask 										get_return_object() noexcept {
+					return PipeTask(std::coroutine_handle<promise_type>::from_promise(*this));
+				}
+
+				inline std::suspend_always 								initial_suspend() const noexcept {
+					return {};
+				}
+
+				inline Final 											final_suspend() const noexcept {
+					return {};
+				}
+
+				inline void 											return_void() const noexcept {}
+
+				inline void 											unhandled_exception() noexcept {
+					m_failed = true;
+				}
+			};
+
+			/**
+			 * @brief Copy constructor deleted.
+			 */
+			PipeTask(const PipeTask&)									= delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param other Task to take the coroutine from.
+			 */
+			inline PipeTask(PipeTask&& other) noexcept: m_handle(std::exchange(other.m_handle, nullptr)) {}
+
+			/**
+			 * @brief Destructor; frees the coroutine if never started.
+			 */
+			inline ~PipeTask() noexcept {
+				if (m_handle)
+					m_handle.destroy();
+			}
+
+			/**
+			 * @brief Copy assignment deleted.
+			 */
+			PipeTask& operator=(const PipeTask&)						= delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param other Task to take the coroutine from.
+			 * @return Reference to this task.
+			 */
+			inline PipeTask& operator=(PipeTask&& other) noexcept {
+				if (this != &other) {
+					if (m_handle)
+						m_handle.destroy();
+					m_handle = std::exchange(other.m_handle, nullptr);
+				}
+				return *this;
+			}
+
+			/**
+			 * @brief Run the coroutine until it first suspends or returns.
+			 * @param done Called, in whichever thread finishes the coroutine, once it returns.
+			 * @details The task no longer owns the coroutine afterwards. Does nothing
+			 *          when the task is empty (already started or moved from).
+			 */
+			inline void 												Start(Completion done) noexcept {
+				if (!m_handle)
+					return;
+				m_handle.promise().m_done = std::move(done);
+				std::exchange(m_handle, nullptr).resume();
+			}
+
+		private:
+			std::coroutine_handle<promise_type> m_handle;				///< Coroutine not started yet.
+
+			/**
+			 * @brief Construct from the promise's handle.
+			 * @param handle Suspended coroutine.
+			 */
+			inline explicit PipeTask(std::coroutine_handle<promise_type> handle) noexcept: m_handle(handle) {}
+	};
+}
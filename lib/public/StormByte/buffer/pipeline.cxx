@@ -1,105 +1,728 @@
+#include <StormByte/buffer/consumer_set.hxx>
 #include <StormByte/buffer/pipeline.hxx>
 #include <StormByte/buffer/producer.hxx>
+#include <StormByte/buffer/reorder_fifo.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <utility>
 
 using namespace StormByte::Buffer;
 
-Pipeline::Pipeline(const Pipeline& other): m_pipes(other.m_pipes), m_producers(other.m_producers) {
-	m_threads.reserve(m_pipes.size() + 1);
+namespace {
+	/**
+	 * @brief Executor whose tasks run in the thread draining it (Sync mode).
+	 */
+	class Loop final: public Executor {
+		public:
+			void Post(std::function<void()> task) override {
+				{
+					std::scoped_lock<std::mutex> lock(m_mutex);
+					m_tasks.push_back(std::move(task));
+				}
+				m_cv.notify_all();
+			}
+
+			// A coroutine stage started
+			void Started() noexcept {
+				std::scoped_lock<std::mutex> lock(m_mutex);
+				++m_running;
+			}
+
+			// A coroutine stage returned; may be called from any thread
+			void Done() noexcept {
+				{
+					std::scoped_lock<std::mutex> lock(m_mutex);
+					--m_running;
+				}
+				m_cv.notify_all();
+			}
+
+			// Run posted tasks until every started stage has returned
+			void Drain() noexcept {
+				std::unique_lock<std::mutex> lock(m_mutex);
+				while (m_running > 0) {
+					if (m_tasks.empty()) {
+						// Waiting for another thread to feed the input
+						m_cv.wait(lock);
+						continue;
+					}
+					std::function<void()> task = std::move(m_tasks.front());
+					m_tasks.pop_front();
+					lock.unlock();
+					try {
+						task();
+					}
+					catch (...) {
+						// Stages report their own failures
+					}
+					task = nullptr;
+					lock.lock();
+				}
+			}
+
+		private:
+			std::mutex m_mutex;
+			std::condition_variable m_cv;
+			std::deque<std::function<void()>> m_tasks;
+			std::size_t m_running {0};
+	};
+
+	// Whether a stage left its output in the error state
+	bool Failed(Producer& out) noexcept {
+		return out.Consumer().HasError();
+	}
+
+	// Run @p pipe over one chunk and hand its output to @p out under @p sequence
+	bool RunChunk(const PipeFunction& pipe, DataType&& chunk, const std::uint64_t& sequence, Producer& out, const std::shared_ptr<StormByte::Logger::Log>& log) noexcept {
+		try {
+			Producer chunk_in, chunk_out;
+			(void)chunk_in.Write(std::move(chunk));
+			chunk_in.Close();
+			pipe(chunk_in.Consumer(), chunk_out, log);
+			Consumer result = chunk_out.Consumer();
+			if (result.HasError())
+				return false;
+			DataType bytes;
+			(void)result.Extract(0, bytes);
+			return out.WriteSequence(sequence, std::move(bytes));
+		}
+		catch (...) {
+			return false;
+		}
+	}
+
+	/**
+	 * @brief Chunks of one parallel stage currently being processed.
+	 */
+	struct Batch {
+		std::mutex mutex;
+		std::condition_variable cv;
+		std::deque<std::pair<std::uint64_t, DataType>> queued;		// Chunks posted, not started
+		std::size_t running {0};									// Chunks posted, not finished
+		std::uint64_t next {0};										// First chunk not finished
+		std::vector<bool> finished;									// Finished chunks past @c next, by sequence modulo size
+		bool failed {false};
+		const PipeFunction pipe;									// Kept here: a posted task may outlive the stage
+
+		Batch(const std::size_t& window, const PipeFunction& function): finished(window, false), pipe(function) {}
+
+		// Run the oldest queued chunk, if any; false if there was none
+		bool RunQueued(Producer& out, const std::shared_ptr<StormByte::Logger::Log>& log) noexcept {
+			std::pair<std::uint64_t, DataType> item;
+			bool skip;
+			{
+				std::scoped_lock<std::mutex> lock(mutex);
+				if (queued.empty())
+					return false;
+				item = std::move(queued.front());
+				queued.pop_front();
+				skip = failed;
+			}
+			// Once the stage failed nothing is written anymore
+			Finished(item.first, !skip && RunChunk(pipe, std::move(item.second), item.first, out, log));
+			return true;
+		}
+
+		void Finished(const std::uint64_t& sequence, const bool& ok) noexcept {
+			{
+				std::scoped_lock<std::mutex> lock(mutex);
+				--running;
+				failed = failed || !ok;
+				finished[sequence % finished.size()] = true;
+				while (finished[next % finished.size()])
+					finished[next++ % finished.size()] = false;
+			}
+			cv.notify_all();
+		}
+	};
+
+	// Split @p in into chunks processed by up to @p workers replicas of @p pipe on
+	// @p executor (inline when null), and write their outputs to @p out (a
+	// ReorderFIFO of 2 * @p workers slots) in input order; no chunk starts once
+	// @p stop is requested. Chunks no worker took yet are run by this loop while
+	// it waits, so it never starves on an executor it occupies itself
+	void RunParallel(const PipeFunction& pipe, const std::size_t& workers, const std::size_t& chunk_size, Consumer in,
+		Producer out, const std::shared_ptr<StormByte::Logger::Log>& log, const std::shared_ptr<Executor>& executor, const std::stop_token& stop) noexcept {
+		const std::size_t window = 2 * workers;
+		std::shared_ptr<Batch> batch;
+		try {
+			batch = std::make_shared<Batch>(window, pipe);
+		}
+		catch (...) {
+			out.SetError();
+			return;
+		}
+		// Wakes the loop below if the run is cancelled while it waits for a replica
+		const std::stop_callback wake(stop, [&batch]() {
+			{
+				std::scoped_lock<std::mutex> lock(batch->mutex);
+			}
+			batch->cv.notify_all();
+		});
+		for (std::uint64_t sequence = 0;; ++sequence) {
+			if (in.AvailableBytes() < chunk_size && in.IsWritable()) {
+				// The input is the caller's at the first stage: wait on it and on the run's token
+				ConsumerSet input;
+				(void)input.Add(in, chunk_size);
+				(void)input.Select(stop);
+			}
+			if (stop.stop_requested()) {
+				std::scoped_lock<std::mutex> lock(batch->mutex);
+				batch->failed = true;
+				break;
+			}
+			DataType chunk;
+			if (!in.Extract(chunk_size, chunk)) {
+				// Closed with less than a chunk left: the rest is the last one
+				chunk.clear();
+				if (in.HasError() || !in.Extract(0, chunk))
+					break;
+			}
+
+			if (!executor) {
+				if (!RunChunk(pipe, std::move(chunk), sequence, out, log)) {
+					batch->failed = true;
+					break;
+				}
+				continue;
+			}
+
+			{
+				// Bounded: at most @p workers chunks running, none parked past the reorder window
+				std::unique_lock<std::mutex> lock(batch->mutex);
+				while (!batch->failed && !stop.stop_requested() && (batch->running >= workers || sequence - batch->next >= window)) {
+					// Run a chunk no worker took yet instead of waiting for it: on a
+					// fixed pool this loop may hold the only worker there is
+					if (!batch->queued.empty()) {
+						lock.unlock();
+						(void)batch->RunQueued(out, log);
+						lock.lock();
+					}
+					else
+						batch->cv.wait(lock);
+				}
+				if (batch->failed || stop.stop_requested())
+					break;
+				try {
+					batch->queued.emplace_back(sequence, std::move(chunk));
+				}
+				catch (...) {
+					batch->failed = true;
+					break;
+				}
+				++batch->running;
+			}
+			try {
+				// Any task runs the oldest queued chunk; one finding none has nothing to do
+				executor->Post([out, log, batch]() mutable {
+					(void)batch->RunQueued(out, log);
+				});
+			}
+			catch (...) {
+				// Not posted: the chunk stays queued for this loop to run
+			}
+		}
+
+		// Chunks still queued are run here rather than left to a busy executor
+		while (batch->RunQueued(out, log)) {}
+		std::unique_lock<std::mutex> lock(batch->mutex);
+		batch->cv.wait(lock, [&]() { return batch->running == 0; });
+		if (batch->failed || in.HasError())
+			out.SetError();
+		else
+			out.Close();
+	}
+
+	// Copy the caller's input into the run's first buffer until it ends or @p stop is requested
+	void Relay(Consumer in, Producer out, const std::stop_token& stop) noexcept {
+		while (!stop.stop_requested()) {
+			if (in.AvailableBytes() == 0 && in.IsWritable()) {
+				// Wait on the input and on the stop request alike
+				ConsumerSet input;
+				(void)input.Add(in);
+				(void)input.Select(stop);
+				continue;
+			}
+			DataType data;
+			// Wait for one byte, then take whatever else is there
+			if (!in.Extract(1, data)) {
+				if (in.HasError())
+					out.SetError();
+				else
+					out.Close();
+				return;
+			}
+			(void)in.Extract(0, data);
+			if (!out.Write(std::move(data)))
+				return;
+		}
+		out.SetError();
+	}
 }
 
+struct Pipeline::Metrics {
+	const std::chrono::steady_clock::time_point origin;				///< When the run started.
+	const bool counting;											///< Whether statistics are collected.
+	const std::shared_ptr<Tracer> tracer;							///< Tracer of the run (null: not traced).
+	std::vector<Consumer> buffers;									///< Stage @c i reads @c buffers[i] and writes @c buffers[i + 1].
+	std::unique_ptr<std::atomic<std::int64_t>[]> started;			///< Nanoseconds from @c origin, plus one (0: not yet).
+	std::unique_ptr<std::atomic<std::int64_t>[]> finished;			///< Nanoseconds from @c origin, plus one (0: not yet).
+
+	Metrics(Consumer input, std::vector<Producer>& producers, const bool& statistics, std::shared_ptr<Tracer> trace):
+		origin(std::chrono::steady_clock::now()), counting(statistics), tracer(std::move(trace)),
+		started(std::make_unique<std::atomic<std::int64_t>[]>(producers.size())),
+		finished(std::make_unique<std::atomic<std::int64_t>[]>(producers.size())) {
+		buffers.reserve(producers.size() + 1);
+		buffers.push_back(std::move(input));
+		for (Producer& producer: producers)
+			buffers.push_back(producer.Consumer());
+		for (std::size_t i = 0; i < buffers.size(); ++i) {
+			if (counting)
+				buffers[i].EnableStatistics();
+			if (tracer)
+				(void)buffers[i].EnableTracing(tracer, static_cast<std::uint32_t>(i));
+		}
+	}
+
+	std::int64_t Now() const noexcept {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin).count() + 1;
+	}
+
+	void Start(const std::size_t& stage) noexcept {
+		started[stage].store(Now(), std::memory_order_relaxed);
+		if (tracer)
+			tracer->Record(Tracer::Kind::StageBegin, static_cast<std::uint32_t>(stage));
+	}
+
+	void Finish(const std::size_t& stage) noexcept {
+		finished[stage].store(Now(), std::memory_order_relaxed);
+		if (tracer)
+			tracer->Record(Tracer::Kind::StageEnd, static_cast<std::uint32_t>(stage));
+	}
+};
+
+struct Pipeline::Runs {
+	std::mutex mutex;												///< Protects every member.
+	std::vector<Execution> active;									///< Runs not known to be complete.
+	std::shared_ptr<Metrics> metrics;								///< Statistics of the run started last.
+};
+
+Pipeline::Pipeline() noexcept: m_pool(std::make_shared<FIFOPool>()), m_runs(std::make_shared<Runs>()) {}
+
+Pipeline::Pipeline(const Pipeline& other):
+	m_stages(other.m_stages), m_executor(other.m_executor), m_statistics(other.m_statistics), m_tracer(other.m_tracer),
+	m_pool(other.m_pool), m_runs(std::make_shared<Runs>()) {}
+
 Pipeline::~Pipeline() noexcept {
 	WaitForCompletion();
 }
 
 Pipeline& Pipeline::operator=(const Pipeline& other) {
 	if (this != &other) {
-		m_pipes = other.m_pipes;
-		m_producers = other.m_producers;
 		WaitForCompletion();
-		m_threads.clear();
-		m_threads.reserve(m_pipes.size());
+		m_stages = other.m_stages;
+		m_executor = other.m_executor;
+		m_statistics = other.m_statistics;
+		m_tracer = other.m_tracer;
+		m_pool = other.m_pool;
+		// Moved from: runs are tracked again
+		if (!m_runs)
+			m_runs = std::make_shared<Runs>();
 	}
 	return *this;
 }
 
+void Pipeline::AddAsyncPipe(const AsyncPipeFunction& pipe) {
+	m_stages.push_back({ nullptr, pipe });
+}
+
+void Pipeline::AddAsyncPipe(AsyncPipeFunction&& pipe) {
+	m_stages.push_back({ nullptr, std::move(pipe) });
+}
+
 void Pipeline::AddPipe(const PipeFunction& pipe) {
-	m_pipes.push_back(pipe);
-	m_threads.reserve(m_pipes.size() + 1);
+	m_stages.push_back({ pipe, nullptr });
 }
 
 void Pipeline::AddPipe(PipeFunction&& pipe) {
-	m_pipes.push_back(std::move(pipe));
-	m_threads.reserve(m_pipes.size() + 1);
+	m_stages.push_back({ std::move(pipe), nullptr });
+}
+
+void Pipeline::AddPipe(const CancellablePipeFunction& pipe) {
+	m_stages.push_back({ nullptr, nullptr, 0, 0, pipe });
+}
+
+void Pipeline::AddPipe(CancellablePipeFunction&& pipe) {
+	m_stages.push_back({ nullptr, nullptr, 0, 0, std::move(pipe) });
+}
+
+void Pipeline::AddParallelPipe(const PipeFunction& pipe, const std::size_t& workers, const std::size_t& chunk_size) {
+	AddParallelPipe(PipeFunction(pipe), workers, chunk_size);
+}
+
+void Pipeline::AddParallelPipe(PipeFunction&& pipe, const std::size_t& workers, const std::size_t& chunk_size) {
+	const std::size_t replicas = workers > 0 ? workers : std::max(1u, std::thread::hardware_concurrency());
+	m_stages.push_back({ std::move(pipe), nullptr, replicas, std::max<std::size_t>(chunk_size, 1) });
+}
+
+void Pipeline::Cancel() const noexcept {
+	if (!m_runs)
+		return;
+	std::scoped_lock<std::mutex> lock(m_runs->mutex);
+	for (const Execution& run: m_runs->active)
+		run.Cancel();
+}
+
+void Pipeline::EnableStatistics(const bool& enable) noexcept {
+	m_statistics = enable;
+}
+
+void Pipeline::SetBufferPool(std::shared_ptr<FIFOPool> pool) noexcept {
+	m_pool = std::move(pool);
 }
 
 void Pipeline::SetError() const noexcept {
-	for (auto& producer : m_producers) {
-		producer.SetError();
+	if (!m_runs)
+		return;
+	std::scoped_lock<std::mutex> lock(m_runs->mutex);
+	for (const Execution& run: m_runs->active)
+		run.SetError();
+}
+
+void Pipeline::SetExecutor(std::shared_ptr<Executor> executor) noexcept {
+	m_executor = std::move(executor);
+}
+
+void Pipeline::SetTracer(std::shared_ptr<Tracer> tracer) noexcept {
+	m_tracer = std::move(tracer);
+}
+
+std::vector<Pipeline::StageStatistics> Pipeline::Statistics() const noexcept {
+	std::vector<StageStatistics> stages;
+	if (!m_runs)
+		return stages;
+	std::shared_ptr<Metrics> metrics;
+	{
+		std::scoped_lock<std::mutex> lock(m_runs->mutex);
+		metrics = m_runs->metrics;
+	}
+	if (!metrics || !metrics->counting)
+		return stages;
+	try {
+		stages.resize(metrics->buffers.size() - 1);
 	}
+	catch (...) {
+		return stages;
+	}
+	const std::int64_t now = metrics->Now();
+	for (std::size_t i = 0; i < stages.size(); ++i) {
+		const SharedFIFO::Counters input = metrics->buffers[i].Statistics();
+		const SharedFIFO::Counters output = metrics->buffers[i + 1].Statistics();
+		StageStatistics& stage = stages[i];
+		stage.bytes_in = input.bytes_read;
+		stage.bytes_out = output.bytes_written;
+		stage.input_wait = input.read_wait;
+		stage.output_wait = output.write_wait;
+		stage.peak_queue = output.peak_bytes;
+		const std::int64_t started = metrics->started[i].load(std::memory_order_relaxed);
+		if (started > 0) {
+			// Still running: up to now
+			const std::int64_t finished = metrics->finished[i].load(std::memory_order_relaxed);
+			stage.wall_time = std::chrono::nanoseconds((finished > 0 ? finished : now) - started);
+		}
+	}
+	return stages;
 }
 
-Consumer Pipeline::Process(Consumer buffer, const ExecutionMode& mode, std::shared_ptr<Logger::Log> log) const noexcept {
-	// This guards double calls and do not harm in the first call
-	WaitForCompletion();
+Execution Pipeline::Execute(Consumer buffer, const ExecutionMode& mode, std::shared_ptr<Logger::Log> log) const noexcept {
+	// Every run owns its buffers: nothing here is shared with another call
+	std::vector<Producer> producers;
+	std::optional<Producer> relay;
+	std::shared_ptr<Metrics> metrics;
+	std::optional<Execution> started;
+	try {
+		producers.reserve(m_stages.size());
+		for (const Stage& stage: m_stages) {
+			// Parallel stages reassemble their chunks in order
+			if (stage.workers > 0)
+				producers.emplace_back(std::make_shared<ReorderFIFO>(2 * stage.workers));
+			else if (m_pool)
+				producers.push_back(m_pool->Acquire());
+			else
+				producers.emplace_back();
+		}
+
+		// A plain or coroutine first stage would block on the caller's open input,
+		// out of reach of Cancel: it reads a copy owned by the run instead. The
+		// copy is bounded like the input, so its writer still waits for that
+		// stage; a Sync run copies the input whole first, so it only copies an
+		// unbounded one, whose writer never waits anyway
+		if (!m_stages.empty() && m_stages.front().workers == 0 && !m_stages.front().cancellable && buffer.IsWritable()) {
+			if (buffer.Limit() == 0)
+				relay.emplace(m_pool ? m_pool->Acquire() : Producer());
+			else if (mode == ExecutionMode::Async)
+				relay.emplace(std::make_shared<SharedFIFO>(buffer.Limit()));
+		}
+
+		if (!m_stages.empty() && (m_statistics || m_tracer)) {
+			try {
+				metrics = std::make_shared<Metrics>(relay ? relay->Consumer() : buffer, producers, m_statistics, m_tracer);
+			}
+			catch (...) {
+				// Statistics and tracing are best effort: run without them
+			}
+		}
 
-	// Use pre-created producers corresponding to each pipe
-	if (m_pipes.empty()) {
 		// If there are not any stages, we do a passthrough
-		return buffer;
+		const Consumer output = producers.empty() ? buffer : producers.back().Consumer();
+		if (relay) {
+			std::vector<Producer> written = producers;
+			written.push_back(*relay);
+			started.emplace(Execution(m_stages.size(), std::move(written), { output }));
+		}
+		else
+			started.emplace(Execution(producers, output));
+		if (m_runs) {
+			std::scoped_lock<std::mutex> lock(m_runs->mutex);
+			m_runs->metrics = metrics;
+			// Forget the runs that completed
+			std::erase_if(m_runs->active, [](const Execution& active) { return active.Done(); });
+			// Sync runs too: Cancel() and SetError() may come from another thread
+			if (!producers.empty())
+				m_runs->active.push_back(*started);
+		}
 	}
-
-	// Reset producers to ensure a fresh run when reusing the pipeline
-	m_producers.clear();
-	m_producers.resize(m_pipes.size());
-	for (auto& prod : m_producers) {
-		prod = Producer();
+	catch (...) {
+		// Could not set the run up: no stage started, every one of them fails
+		Producer failed;
+		failed.SetError();
+		const Execution run(m_stages.size(), { failed }, { failed.Consumer() });
+		for (std::size_t i = 0; i < m_stages.size(); ++i)
+			run.Finish(i, true);
+		return run;
+	}
+	const Execution run = *started;
+	if (mode == ExecutionMode::Sync) {
+		// This thread is the only one: the input is copied whole before the
+		// first stage starts, waiting on the input and on the run's token alike
+		if (relay) {
+			std::stop_source done;
+			const std::stop_callback cancel(run.StopToken(), [&done]() noexcept { (void)done.request_stop(); });
+			// SetError() errors the copy without requesting stop
+			const Consumer copy = relay->Consumer();
+			const std::size_t errored = copy.OnError([done]() mutable { (void)done.request_stop(); });
+			Relay(buffer, *relay, done.get_token());
+			(void)copy.RemoveCallback(errored);
+		}
+		RunInline(relay ? relay->Consumer() : buffer, producers, log, metrics, run);
+		if (m_runs) {
+			// Every stage returned
+			std::scoped_lock<std::mutex> lock(m_runs->mutex);
+			std::erase_if(m_runs->active, [](const Execution& active) { return active.Done(); });
+		}
+		return run;
 	}
 
-	// Prepare storage for worker threads. We'll create threads for the first
-	// N-1 stages and store them in `m_threads` so we can join them later.
-	// This avoids creating detached threads that can cause sanitizer-reported
-	// leaks if they are still running at program exit.
-	m_threads.clear();
-	m_threads.reserve(m_pipes.size());
-
-	for (std::size_t i = 0; i < m_pipes.size(); ++i) {
-		Consumer stage_in = (i == 0) ? buffer : m_producers[i - 1].Consumer();
-		Producer stage_out = m_producers[i];
+	// Stages are queued in order, so every stage a running stage reads from
+	// has been started before it, whatever the number of workers.
 
-		// First N-1 stages: create a background thread and store it.
-            if (i < m_pipes.size() - 1) {
-            	m_threads.emplace_back([pipe = m_pipes[i], in = stage_in, out = stage_out, log]() mutable {
-            		pipe(in, out, log);
-            	});
-			continue;
+	if (relay) {
+		// Copies until the input ends, the run is cancelled or every stage returned
+		std::stop_source done;
+		bool posted = false;
+		try {
+			// Once every stage returned nothing reads the copy: erroring it also
+			// wakes a relay waiting for room in it
+			if (run.OnComplete([done, out = *relay](const std::vector<Execution::StageStatus>&) mutable {
+				(void)done.request_stop();
+				out.SetError();
+			})) {
+				const std::shared_ptr<Executor> executor = m_executor ? m_executor : ThreadPool::Shared();
+				executor->Post([in = buffer, out = *relay, run, done]() mutable {
+					const std::stop_callback cancel(run.StopToken(), [&done]() noexcept { (void)done.request_stop(); });
+					Relay(in, out, done.get_token());
+				});
+				posted = true;
+			}
+		}
+		catch (...) {
+			// Handled below
 		}
+		// Could not relay: the first stage sees its input fail
+		if (!posted)
+			relay->SetError();
+	}
 
-		// Last stage: detached/threaded only for Async; for Sync run inline.
-		if (mode == ExecutionMode::Async) {
-			m_threads.emplace_back([pipe = m_pipes[i], in = stage_in, out = stage_out, log]() mutable {
-				pipe(in, out, log);
-			});
-		} else {
-			// Run last stage inline for Sync semantics. After returning from
-			// this call we join all worker threads to ensure deterministic
-			// completion.
-			m_pipes[i](stage_in, stage_out, log);
-			for (auto &t : m_threads) {
-				if (t.joinable()) t.join();
+	for (std::size_t i = 0; i < m_stages.size(); ++i) {
+		Consumer stage_in = (i == 0) ? (relay ? relay->Consumer() : buffer) : producers[i - 1].Consumer();
+		Producer stage_out = producers[i];
+		try {
+			if (m_stages[i].workers > 0) {
+				// The splitting loop blocks on its input; the chunks themselves are CPU work
+				const std::shared_ptr<Executor> executor = m_executor ? m_executor : ThreadPool::Shared();
+				const std::shared_ptr<Executor> chunks = m_executor ? m_executor : std::static_pointer_cast<Executor>(WorkStealingPool::Shared());
+				// Held weakly: the task may run on that very executor and must not destroy it
+				executor->Post([stage = m_stages[i], in = stage_in, out = stage_out, log, run, pool = std::weak_ptr<Executor>(chunks), metrics, i]() mutable {
+					if (metrics)
+						metrics->Start(i);
+					{
+						// Released before the run completes, while the pipeline still holds it
+						const std::shared_ptr<Executor> chunks = pool.lock();
+						RunParallel(stage.pipe, stage.workers, stage.chunk_size, in, out, log, chunks, run.StopToken());
+					}
+					if (metrics)
+						metrics->Finish(i);
+					run.Finish(i, Failed(out));
+				});
+			}
+			else if (m_stages[i].pipe || m_stages[i].cancellable) {
+				const std::shared_ptr<Executor> executor = m_executor ? m_executor : ThreadPool::Shared();
+				executor->Post([stage = m_stages[i], in = stage_in, out = stage_out, log, run, metrics, i]() mutable {
+					if (metrics)
+						metrics->Start(i);
+					try {
+						if (stage.cancellable)
+							stage.cancellable(in, out, log, run.StopToken());
+						else
+							stage.pipe(in, out, log);
+					}
+					catch (...) {
+						out.SetError();
+					}
+					// The next stage reads until end of data: end it even if the stage did not
+					if (out.IsWritable())
+						out.Close();
+					if (metrics)
+						metrics->Finish(i);
+					run.Finish(i, Failed(out));
+				});
+			}
+			else {
+				std::shared_ptr<Executor> executor = m_executor ? m_executor : std::static_pointer_cast<Executor>(WorkStealingPool::Shared());
+				executor->Post([pipe = m_stages[i].async, in = stage_in, out = stage_out, log, run, executor, metrics, i]() mutable {
+					if (metrics)
+						metrics->Start(i);
+					try {
+						// The coroutine may refer to the function's captures: keep it alive until it returns
+						auto function = std::make_shared<AsyncPipeFunction>(std::move(pipe));
+						// Moved into the coroutine frame: the task must not hold the last reference to its executor
+						PipeTask task = (*function)(in, out, log, std::move(executor));
+						task.Start([function, out, run, metrics, i](const bool& failed) mutable {
+							if (failed)
+								out.SetError();
+							else if (out.IsWritable())
+								out.Close();
+							if (metrics)
+								metrics->Finish(i);
+							run.Finish(i, Failed(out));
+						});
+					}
+					catch (...) {
+						out.SetError();
+						if (metrics)
+							metrics->Finish(i);
+						run.Finish(i, true);
+					}
+				});
 			}
-			m_threads.clear();
+		}
+		catch (...) {
+			// Could not schedule: the stage fails and downstream sees the error
+			stage_out.SetError();
+			run.Finish(i, true);
 		}
 	}
 
-	return m_producers.back().Consumer();
+	return run;
 }
 
-void Pipeline::WaitForCompletion() const noexcept {
-	for (std::size_t i = 0; i < m_threads.size(); ++i) {
-		if (m_threads[i].joinable()) {
-			m_threads[i].join();
+Consumer Pipeline::Process(Consumer buffer, const ExecutionMode& mode, std::shared_ptr<Logger::Log> log) const noexcept {
+	return Execute(std::move(buffer), mode, std::move(log)).Output();
+}
+
+void Pipeline::RunInline(Consumer buffer, std::vector<Producer>& producers, std::shared_ptr<Logger::Log> log, const std::shared_ptr<Metrics>& metrics, const Execution& run) const noexcept {
+	// Every stage runs in this thread: coroutine stages interleave through the
+	// loop, switching whenever one waits; a blocking stage starts once every
+	// stage before it has returned, so it never waits on a stage behind it.
+	const auto loop = std::make_shared<Loop>();
+	for (std::size_t i = 0; i < m_stages.size(); ++i) {
+		Consumer stage_in = (i == 0) ? buffer : producers[i - 1].Consumer();
+		Producer stage_out = producers[i];
+		if (m_stages[i].workers > 0) {
+			loop->Drain();
+			if (metrics)
+				metrics->Start(i);
+			RunParallel(m_stages[i].pipe, m_stages[i].workers, m_stages[i].chunk_size, stage_in, stage_out, log, nullptr, run.StopToken());
+			if (metrics)
+				metrics->Finish(i);
+			run.Finish(i, Failed(stage_out));
+		}
+		else if (m_stages[i].pipe || m_stages[i].cancellable) {
+			loop->Drain();
+			if (metrics)
+				metrics->Start(i);
+			try {
+				if (m_stages[i].cancellable)
+					m_stages[i].cancellable(stage_in, stage_out, log, run.StopToken());
+				else
+					m_stages[i].pipe(stage_in, stage_out, log);
+			}
+			catch (...) {
+				stage_out.SetError();
+			}
+			// The next stage reads until end of data: end it even if the stage did not
+			if (stage_out.IsWritable())
+				stage_out.Close();
+			if (metrics)
+				metrics->Finish(i);
+			run.Finish(i, Failed(stage_out));
 		}
+		else {
+			loop->Started();
+			if (metrics)
+				metrics->Start(i);
+			try {
+				auto function = std::make_shared<AsyncPipeFunction>(m_stages[i].async);
+				PipeTask task = (*function)(stage_in, stage_out, log, loop);
+				task.Start([function, out = stage_out, loop, metrics, run, i](const bool& failed) mutable {
+					if (failed)
+						out.SetError();
+					else if (out.IsWritable())
+						out.Close();
+					if (metrics)
+						metrics->Finish(i);
+					run.Finish(i, Failed(out));
+					loop->Done();
+				});
+			}
+			catch (...) {
+				stage_out.SetError();
+				if (metrics)
+					metrics->Finish(i);
+				run.Finish(i, true);
+				loop->Done();
+			}
+		}
+	}
+	loop->Drain();
+}
+
+void Pipeline::WaitForCompletion() const noexcept {
+	if (!m_runs)
+		return;
+	std::vector<Execution> active;
+	{
+		std::scoped_lock<std::mutex> lock(m_runs->mutex);
+		active.swap(m_runs->active);
 	}
-	m_threads.clear();
-	m_threads.reserve(m_pipes.size());
+	// Without the lock: a run may still be starting others
+	for (const Execution& run: active)
+		run.Wait();
 }
\ No newline at end of file
@@ -1,10 +1,16 @@
 #pragma once
 
 #include <StormByte/buffer/consumer.hxx>
+#include <StormByte/buffer/execution.hxx>
+#include <StormByte/buffer/fifo_pool.hxx>
+#include <StormByte/buffer/pipe_task.hxx>
 #include <StormByte/buffer/producer.hxx>
+#include <StormByte/buffer/thread_pool.hxx>
+#include <StormByte/buffer/tracer.hxx>
 #include <StormByte/buffer/typedefs.hxx>
+#include <StormByte/buffer/work_stealing_pool.hxx>
 
-#include <thread>
+#include <chrono>
 
 /**
  * @namespace Buffer
@@ -32,13 +38,42 @@ namespace StormByte::Buffer {
 	 * @endcode
 	 * - Read from `input` using `Read()` / `Extract()`
 	 * - Write processed bytes to `output` using `Write()`
-	 * - Close or `SetError()` the `output` when the stage finishes
+	 * - Close or `SetError()` the `output` when the stage finishes; an output
+	 *   left open is closed once the stage returns
 	 *
 	 * @par Execution modes
-	 * - `ExecutionMode::Async` (default): each stage is launched in its own detached
-	 *   thread. Stages process data concurrently and communicate via SharedFIFO buffers.
-	 * - `ExecutionMode::Sync` : stages run sequentially in the caller's thread; no
-	 *   detached threads are created.
+	 * - `ExecutionMode::Async` (default): each stage is posted to the pipeline's
+	 *   executor. Stages process data concurrently and communicate via SharedFIFO buffers.
+	 * - `ExecutionMode::Sync` : every stage runs in the caller's thread and
+	 *   Process() returns once all of them have finished. Blocking stages run one
+	 *   after the other, each over the whole output of the previous one; coroutine
+	 *   stages interleave, switching whenever one of them waits. No thread is
+	 *   involved, so the order of execution is deterministic.
+	 *
+	 * @par Executors
+	 * Stages run on an @ref Executor instead of a thread started per stage and per
+	 * call: by default the growing @ref ThreadPool::Shared() pool, whose workers are
+	 * reused across runs and across every Pipeline. @ref SetExecutor() selects
+	 * another one, for instance a ThreadPool shared by a group of pipelines.
+	 *
+	 * @par Coroutine stages
+	 * A blocking stage holds its worker while it waits for input, so running many
+	 * pipelines at once needs as many threads as waiting stages. Stages added with
+	 * @ref AddAsyncPipe() are coroutines (AsyncPipeFunction) that @c co_await their
+	 * input with the executor they are given: a waiting stage holds no thread, and
+	 * the write that feeds it posts its continuation. Without an executor set they
+	 * run on @ref WorkStealingPool::Shared(), one worker per core however many
+	 * pipelines are active.
+	 * @code{.cpp}
+	 * pipeline.AddAsyncPipe([](Consumer in, Producer out, std::shared_ptr<Logger::Log>, std::shared_ptr<Executor> ex) -> PipeTask {
+	 *     DataType data;
+	 *     while (co_await in.ExtractSomeAsync(0, data, ex) && !data.empty()) {
+	 *         co_await out.WriteAsync(std::move(data), ex);
+	 *         data.clear();
+	 *     }
+	 *     out.Close();
+	 * });
+	 * @endcode
 	 *
 	 * @par Example (conceptual, Async mode)
 	 * @code{.cpp}
@@ -57,6 +92,89 @@ namespace StormByte::Buffer {
 	 * Consumer result = pipeline.Process(input.Consumer(), ExecutionMode::Async, logger);
 	 * @endcode
 	 *
+	 * @par Completion
+	 * @ref Execute() starts the same run as Process() and returns an @ref Execution
+	 * handle: its output, plus a completion signalled once by the last stage to
+	 * return, with the status of every stage.
+	 * @code{.cpp}
+	 * Execution run = pipeline.Execute(input.Consumer(), ExecutionMode::Async, logger);
+	 * run.OnComplete([](const std::vector<Execution::StageStatus>& stages) { ... });
+	 * if (!run.WaitFor(std::chrono::seconds(5))) { ... }
+	 * @endcode
+	 *
+	 * @par Concurrent runs
+	 * Every Process() or Execute() call is an independent run with its own
+	 * buffers, so one configured Pipeline can serve many requests at once, for
+	 * instance from the threads of a server, without being copied per request.
+	 * The destructor waits for the runs still going.
+	 *
+	 * @par Statistics
+	 * After @ref EnableStatistics(), every later run counts, per stage, the bytes
+	 * read and written, the wall time, the time blocked reading its input and
+	 * writing its output, and the peak size of its output buffer. @ref Statistics()
+	 * returns a snapshot at any time, including while the stages run. Disabled, a
+	 * FIFO operation only tests one null pointer.
+	 * @code{.cpp}
+	 * pipeline.EnableStatistics();
+	 * Consumer result = pipeline.Process(input.Consumer(), ExecutionMode::Async, logger);
+	 * for (const auto& stage: pipeline.Statistics())
+	 *     std::cout << stage.bytes_out << " bytes, blocked " << stage.input_wait.count() << " ns\n";
+	 * @endcode
+	 *
+	 * @par Tracing
+	 * With a @ref Tracer set through @ref SetTracer(), every later run records its
+	 * stages starting and returning and, on each of its buffers, the reads, the
+	 * writes, the blocking waits, the close and the error. Tracer::Save() writes
+	 * a Chrome Trace Event file to open in chrome://tracing or ui.perfetto.dev.
+	 * Buffer 0 is the input and buffer @c i + 1 the output of stage @c i.
+	 *
+	 * @par Buffer reuse
+	 * Intermediate buffers come from a @ref FIFOPool: once a run's readers and
+	 * stages are done with a buffer, it goes back to the pool with its
+	 * allocation and serves a later run, which also starts with the capacity
+	 * earlier runs needed. Copies of a Pipeline share the pool;
+	 * @ref SetBufferPool() shares one between pipelines or turns reuse off.
+	 * Buffers of parallel stages are not pooled.
+	 *
+	 * @par Cancellation
+	 * Stages added as a CancellablePipeFunction also receive the run's
+	 * @c std::stop_token. @ref Cancel(), or Execution::Cancel() for one run,
+	 * requests stop and errors the run's own buffers: stages blocked reading or
+	 * writing them wake up at once, and a CPU-bound stage checking
+	 * @c stop_requested() between steps returns at its next check, so a run
+	 * whose client went away stops using CPU almost immediately. Parallel
+	 * stages start no further chunk once stop is requested.
+	 *
+	 * The input is the caller's and may be shared, so cancelling leaves it
+	 * alone. While it is open, a run feeds a plain or coroutine first stage
+	 * through a buffer of its own, which cancelling errors like the others. That
+	 * buffer has the input's byte limit, so a bounded input still makes its
+	 * writer wait for the stage. A Sync run, having no other thread, copies the
+	 * input whole before that stage starts, and so only when it is unbounded; a
+	 * bounded one is read directly. A CancellablePipeFunction first stage reads the input itself and
+	 * wakes on the token when it waits through
+	 * ConsumerSet::Select(const std::stop_token&), as parallel stages and
+	 * FusedStage do.
+	 * @code{.cpp}
+	 * pipeline.AddPipe([](Consumer in, Producer out, std::shared_ptr<Logger::Log>, std::stop_token stop) {
+	 *     ConsumerSet input;
+	 *     (void)input.Add(in, 4096);
+	 *     DataType block;
+	 *     // Wakes for a block, the end of the input or the run's cancellation
+	 *     while (!input.Select(stop).empty() && in.Extract(4096, block)) {
+	 *         for (std::size_t round = 0; round < rounds && !stop.stop_requested(); ++round)
+	 *             Mix(block);
+	 *         if (stop.stop_requested() || !out.Write(std::move(block)))
+	 *             return;
+	 *         block.clear();
+	 *     }
+	 *     out.Close();
+	 * });
+	 * Execution run = pipeline.Execute(input.Consumer(), ExecutionMode::Async, logger);
+	 * // Client disconnected
+	 * run.Cancel();
+	 * @endcode
+	 *
 	 * @par Error handling
 	 * Stages should catch and handle errors locally. To propagate failure, a stage
 	 * may call `SetError()` on its output buffer; downstream stages will observe
@@ -67,17 +185,31 @@ namespace StormByte::Buffer {
 	 * - Prefer simple, focused transformations per stage.
 	 * - Use Sync mode for deterministic debugging; use Async for throughput on multi-core systems.
 	 * - When using Async mode, ensure any captured data remains valid for the lifetime
-	 *   of the detached thread (use value captures or `std::shared_ptr`).
+	 *   of the stage (use value captures or `std::shared_ptr`).
 	 *
 	 * @see PipeFunction, Consumer, Producer, SharedFIFO, ExecutionMode
 	 */
 	class STORMBYTE_BUFFER_PUBLIC Pipeline final {
 		public:
+			/**
+			 * @brief Counters of one stage, returned by @ref Statistics().
+			 * @details Throughput is @c bytes_out over @c wall_time. A stage waiting in
+			 *          a coroutine does not block, so coroutine stages report no wait.
+			 */
+			struct StageStatistics {
+				std::size_t bytes_in {0};							///< Bytes the stage consumed from its input.
+				std::size_t bytes_out {0};							///< Bytes the stage wrote to its output.
+				std::chrono::nanoseconds wall_time {0};				///< Time since the stage started, up to when it returned.
+				std::chrono::nanoseconds input_wait {0};			///< Time blocked waiting for input.
+				std::chrono::nanoseconds output_wait {0};			///< Time blocked waiting for room in a bounded output.
+				std::size_t peak_queue {0};							///< Most bytes queued in the output at once.
+			};
+
 			/**
 			 * @brief Default constructor
 			 * Initializes an empty pipeline buffer.
 			 */
-			Pipeline() noexcept										= default;
+			Pipeline() noexcept;
 
 			/**
 			 * @brief Copy constructor
@@ -112,11 +244,28 @@ namespace StormByte::Buffer {
 			 */
 			Pipeline& operator=(Pipeline&& other) noexcept			= default;
 
+			/**
+			 * @brief Add a cooperative (coroutine) processing stage to the pipeline.
+			 * @param pipe Coroutine function to execute as a pipeline stage.
+			 * @details Stages are executed in the order they are added, whatever their kind.
+			 *          The stage must pass the executor it receives to the awaitables it
+			 *          waits on, so it is resumed on the pipeline's workers.
+			 * @see AsyncPipeFunction, PipeTask, Process()
+			 */
+			void 													AddAsyncPipe(const AsyncPipeFunction& pipe);
+
+			/**
+			 * @brief Add a cooperative (coroutine) processing stage to the pipeline (move version).
+			 * @param pipe Coroutine function to move into the pipeline.
+			 * @see AddAsyncPipe(const AsyncPipeFunction&)
+			 */
+			void 													AddAsyncPipe(AsyncPipeFunction&& pipe);
+
 			/**
 			 * @brief Add a processing stage to the pipeline.
 			 * @param pipe Function to execute as a pipeline stage.
 			 * @details Stages are executed in the order they are added. Each stage runs
-			 *          in its own thread when Process() is called.
+			 *          as a task on the pipeline's executor when Process() is called.
 			 * @see PipeFunction, Process()
 			 */
 			void 													AddPipe(const PipeFunction& pipe);
@@ -130,10 +279,107 @@ namespace StormByte::Buffer {
 			void 													AddPipe(PipeFunction&& pipe);
 
 			/**
-			 * @brief Mark all internal pipeline stages as errored, causing them to stop accepting writes.
+			 * @brief Add a processing stage that observes cancellation.
+			 * @param pipe Function to execute as a pipeline stage; it receives the
+			 *        run's stop token as its last argument.
+			 * @details Runs as the other blocking stages. The token is set by
+			 *          @ref Cancel() and Execution::Cancel(); checking it is a single
+			 *          atomic load, cheap enough for inner loops.
+			 * @see CancellablePipeFunction, Cancel()
+			 */
+			void 													AddPipe(const CancellablePipeFunction& pipe);
+
+			/**
+			 * @brief Add a processing stage that observes cancellation (move version).
+			 * @param pipe Function to move into the pipeline.
+			 * @see AddPipe(const CancellablePipeFunction&)
+			 */
+			void 													AddPipe(CancellablePipeFunction&& pipe);
+
+			/**
+			 * @brief Add a data-parallel stage running replicas of @p pipe over chunks of its input.
+			 * @param pipe Function run once per chunk.
+			 * @param workers Replicas running at the same time (0: hardware concurrency).
+			 * @param chunk_size Bytes per chunk; the last chunk may be shorter.
+			 * @details For CPU-bound work that is independent per chunk (hashing,
+			 *          compression, encoding). The stage input is split into
+			 *          @p chunk_size byte chunks; each replica receives one chunk as a
+			 *          closed input, and what it writes to its output becomes that
+			 *          chunk's result. Results are written to the next stage in input
+			 *          order through a ReorderFIFO. At most @p workers chunks run at
+			 *          once and at most 2 * @p workers are held past the first
+			 *          unfinished one, so memory stays bounded. A replica that throws
+			 *          or errors its output fails the stage.
+			 *
+			 *          Chunks run on the pipeline's executor, by default on
+			 *          @ref WorkStealingPool::Shared(); in Sync mode they run one after
+			 *          the other in the caller's thread. The loop splitting the input
+			 *          runs chunks no worker has taken yet itself, so the stage needs
+			 *          only one worker of a fixed-size executor, like any blocking stage.
+			 * @see AddPipe(), ReorderFIFO
+			 */
+			void 													AddParallelPipe(const PipeFunction& pipe, const std::size_t& workers = 0, const std::size_t& chunk_size = 65536);
+
+			/**
+			 * @brief Add a data-parallel stage (move version).
+			 * @param pipe Function run once per chunk.
+			 * @param workers Replicas running at the same time (0: hardware concurrency).
+			 * @param chunk_size Bytes per chunk; the last chunk may be shorter.
+			 * @see AddParallelPipe(const PipeFunction&, const std::size_t&, const std::size_t&)
+			 */
+			void 													AddParallelPipe(PipeFunction&& pipe, const std::size_t& workers = 0, const std::size_t& chunk_size = 65536);
+
+			/**
+			 * @brief Cancel every running execution.
+			 * @details Calls Execution::Cancel() on each run not known to be complete:
+			 *          stop is requested on their tokens and their intermediate and
+			 *          output buffers are set to error; their inputs are left alone.
+			 *          Use Execution::Cancel() to stop a single run.
+			 * @note The operation is thread-safe and may be called concurrently.
+			 */
+			void 													Cancel() const noexcept;
+
+			/**
+			 * @brief Collect per-stage statistics in the following runs.
+			 * @param enable Whether to collect them.
+			 * @details Takes effect on the next Process() call, which enables the
+			 *          counters of its input and of every intermediate buffer.
+			 * @see Statistics(), SharedFIFO::EnableStatistics()
+			 */
+			void 													EnableStatistics(const bool& enable = true) noexcept;
+
+			/**
+			 * @brief Execute the pipeline on input data and return a handle to the run.
+			 * @param buffer Consumer providing input data to the first pipeline stage.
+			 * @param mode Execution mode, as for Process().
+			 * @param log Logger instance for logging within pipeline stages.
+			 * @return Handle giving the output and signalled once every stage has returned.
+			 * @details Same run as Process(), which returns @c Execute(...).Output().
+			 *          Use Execution::Wait(), Execution::WaitFor() or
+			 *          Execution::OnComplete() to learn when the stages finished and
+			 *          whether they failed, instead of polling the output. If the
+			 *          run's buffers cannot be allocated, the returned run is already
+			 *          complete with every stage failed and an errored output.
+			 * @see Execution, Process()
+			 */
+			Execution 												Execute(Consumer buffer, const ExecutionMode& mode, std::shared_ptr<Logger::Log> log) const noexcept;
+
+			/**
+			 * @brief Select the pool intermediate buffers are taken from.
+			 * @param pool Pool to use, possibly shared with other pipelines (null: allocate
+			 *        fresh buffers for every run).
+			 * @details Takes effect on the next Process() call; buffers of earlier runs
+			 *          return to the pool they came from.
+			 * @see FIFOPool
+			 */
+			void 													SetBufferPool(std::shared_ptr<FIFOPool> pool) noexcept;
+
+			/**
+			 * @brief Mark the internal buffers of every running execution as errored, causing them to stop accepting writes.
 			 *
 			 * @details This notifies every internal pipe so they transition to an error state and become
 			 *          unwritable; readers will observe end-of-data once existing buffered data is consumed.
+			 *          Use Execution::SetError() to stop a single run.
 			 *          The method is `const` because it performs thread-safe signaling on shared state, not
 			 *          logical mutation of the pipeline object itself.
 			 *
@@ -141,16 +387,53 @@ namespace StormByte::Buffer {
 			 */
 			void 													SetError() const noexcept;
 
+			/**
+			 * @brief Select the executor stages are posted to.
+			 * @param executor Executor to use; null selects @ref ThreadPool::Shared() for
+			 *        blocking stages and @ref WorkStealingPool::Shared() for coroutine stages.
+			 * @details A blocking stage occupies a worker until it returns, since it
+			 *          waits on its input. A fixed-size pool must have a worker for every
+			 *          blocking stage that runs at the same time (summed over the
+			 *          pipelines sharing it), or a growing ThreadPool must be used.
+			 *          Coroutine stages only occupy a worker while they have work to do.
+			 * @see ThreadPool, WorkStealingPool
+			 */
+			void 													SetExecutor(std::shared_ptr<Executor> executor) noexcept;
+
+			/**
+			 * @brief Record the events of the following runs to @p tracer.
+			 * @param tracer Tracer to use (null: stop tracing).
+			 * @details Takes effect on the next Process() call. The input buffer is
+			 *          only traced if it has no tracer yet. Several pipelines may
+			 *          share a tracer; their stage and buffer ids then overlap.
+			 * @see Tracer
+			 */
+			void 													SetTracer(std::shared_ptr<Tracer> tracer) noexcept;
+
+			/**
+			 * @brief Snapshot of the last run's per-stage counters.
+			 * @return One entry per stage in execution order; empty if the last run
+			 *         did not collect statistics.
+			 * @details The last run is the one started last, whether or not it is
+			 *          still running. May be called from any thread at any time.
+			 *          Counters are read one by one, so a running stage's entry may be
+			 *          slightly inconsistent.
+			 * @see EnableStatistics()
+			 */
+			std::vector<StageStatistics> 							Statistics() const noexcept;
+
 			/**
 			 * @brief Execute the pipeline on input data.
 			 * @param buffer Consumer providing input data to the first pipeline stage.
-			 * @param mode Execution mode: ExecutionMode::Async (concurrent detached threads) or
-			 *             ExecutionMode::Sync (sequential execution in caller thread).
+			 * @param mode Execution mode: ExecutionMode::Async (stages run concurrently on the executor) or
+			 *             ExecutionMode::Sync (every stage runs in the caller's thread).
 			 * @param log Logger instance for logging within pipeline stages.
 			 * @return Consumer for reading the final output from the last pipeline stage.
 			 * 
-			 * @details Async: Launches all pipeline stages concurrently in detached threads. Sync:
-			 *          Executes each stage sequentially; no new threads are created. Each stage:
+			 * @details Async: Posts all pipeline stages to the executor and returns. Sync:
+			 *          Runs every stage in the caller's thread and returns once all have finished;
+			 *          @p buffer must therefore be closed, or fed and closed by another thread.
+			 *          A stage returning without closing its output has it closed. Each stage:
 			 *          - Reads data from the previous stage (or the input buffer for the first stage)
 			 *          - Processes the data according to its transformation logic
 			 *          - Writes results to a SharedFIFO buffer that feeds the next stage
@@ -159,7 +442,7 @@ namespace StormByte::Buffer {
 			 *
 			 * @par Thread Execution
 			 *          Async: Parallel processing across stages; implicit cleanup.
-			 *          Sync : Deterministic ordering; no thread coordination required.
+			 *          Sync : Deterministic ordering; single-threaded, no context switches.
 			 *
 			 * @par Data Availability
 			 *          Data becomes available in the output Consumer as the pipeline processes it:
@@ -168,11 +451,10 @@ namespace StormByte::Buffer {
 			 *          - EoF() returns true when no more data can be produced (unwritable & empty)
 			 *
 			 * @par Multiple Invocations
-			 *          Each call creates new buffers; Async spawns threads, Sync reuses caller thread.
-			 *          Executing Process more than once on the same Pipeline object while a previous
-			 *          execution is still running is undefined behavior. Always wait until the prior
-			 *          run has completed (e.g., the returned Consumer reaches EoF) before invoking
-			 *          Process again on the same instance.
+			 *          Each call is an independent run owning its own buffers; stages run on the
+			 *          executor's threads. Any number of runs may overlap, and Process() may be
+			 *          called concurrently from several threads on the same Pipeline, as long as
+			 *          no thread changes its stages or settings meanwhile.
 			 *
 			 * @warning Async: Captured variables must remain valid for thread lifetime (use value capture/shared_ptr).
 			 *          Sync : Standard lifetimes apply.
@@ -182,13 +464,39 @@ namespace StormByte::Buffer {
 			Consumer												Process(Consumer buffer, const ExecutionMode& mode, std::shared_ptr<Logger::Log> log) const noexcept;
 
 		private:
-			std::vector<PipeFunction> m_pipes;						///< Vector of pipe functions
-			mutable std::vector<Producer> m_producers;				///< Vector of intermediate consumers
-			mutable std::vector<std::thread> m_threads;				///< Vector of threads for execution
+			struct Metrics;											///< Statistics and tracing of one Process() call.
+			struct Runs;											///< Runs started by Process() calls.
+
+			/**
+			 * @brief One stage: exactly one of the three functions is set.
+			 */
+			struct Stage {
+				PipeFunction pipe;									///< Blocking stage, or per-chunk function.
+				AsyncPipeFunction async;							///< Coroutine stage.
+				std::size_t workers {0};							///< Replicas of a parallel stage (0: not parallel).
+				std::size_t chunk_size {0};							///< Chunk size of a parallel stage.
+				CancellablePipeFunction cancellable {};			///< Blocking stage receiving the stop token.
+			};
+
+			std::vector<Stage> m_stages;							///< Stages in execution order
+			std::shared_ptr<Executor> m_executor;					///< Executor running the stages (null: ThreadPool::Shared()).
+			bool m_statistics {false};								///< Whether runs collect statistics.
+			std::shared_ptr<Tracer> m_tracer;						///< Tracer of the following runs (null: not traced).
+			std::shared_ptr<FIFOPool> m_pool;						///< Source of intermediate buffers (null: not pooled).
+			std::shared_ptr<Runs> m_runs;							///< Runs not known to be complete (null once moved from).
+
+			/**
+			 * @brief Run every stage in the calling thread (Sync mode).
+			 * @param buffer Input of the first stage.
+			 * @param producers Output of every stage.
+			 * @param log Logger passed to the stages.
+			 * @param metrics Statistics and tracing of the run (null: neither).
+			 * @param run Completion of the run, told as each stage returns.
+			 */
+			void 													RunInline(Consumer buffer, std::vector<Producer>& producers, std::shared_ptr<Logger::Log> log, const std::shared_ptr<Metrics>& metrics, const Execution& run) const noexcept;
 
 			/**
-			 * @brief Wait for all pipeline threads to complete.
-			 * @details Joins the last thread (if async mode) to ensure pipeline completion and clear threads for next run
+			 * @brief Wait for every run started so far to complete.
 			 */
 			void 													WaitForCompletion() const noexcept;
 	};
@@ -0,0 +1,280 @@
+#include <StormByte/buffer/priority_fifo.hxx>
+
+#include <algorithm>
+#include <sstream>
+
+using namespace StormByte::Buffer;
+
+namespace {
+	std::vector<std::size_t> NormalizeWeights(const std::vector<std::size_t>& weights) {
+		std::vector<std::size_t> result;
+		for (const std::size_t& weight: weights)
+			result.push_back(std::max<std::size_t>(weight, 1));
+		if (result.empty())
+			result.push_back(1);
+		return result;
+	}
+}
+
+PriorityFIFO::PriorityFIFO(const std::size_t& lanes):
+	SharedFIFO(), m_lanes(std::max<std::size_t>(lanes, 1)) {}
+
+PriorityFIFO::PriorityFIFO(const std::vector<std::size_t>& weights):
+	SharedFIFO(), m_lanes(std::max<std::size_t>(weights.size(), 1)), m_weights(NormalizeWeights(weights)), m_credits(m_weights) {}
+
+std::size_t PriorityFIFO::AvailableBytes() const noexcept {
+	return m_available.load(std::memory_order_acquire);
+}
+
+void PriorityFIFO::Clean() noexcept {}
+
+void PriorityFIFO::Clear() noexcept {
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		for (ChunkQueue& lane: m_lanes)
+			lane.Clear();
+		m_partial = NoLane;
+		Update();
+	}
+	Signal();
+}
+
+void PriorityFIFO::Close() noexcept {
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		m_closed.store(true, std::memory_order_release);
+	}
+	m_cv.notify_all();
+	Signal();
+}
+
+bool PriorityFIFO::Drop(const std::size_t& count) noexcept {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	if (count != 0 && count > m_available.load(std::memory_order_relaxed))
+		WaitReadable(count, lock);
+
+	const std::size_t avail = m_available.load(std::memory_order_relaxed);
+	if (m_error || avail == 0 || count > avail)
+		return false;
+	if (count > 0) {
+		DataType discarded;
+		Walk(count, discarded, true);
+	}
+	return true;
+}
+
+bool PriorityFIFO::Empty() const noexcept {
+	return Size() == 0;
+}
+
+bool PriorityFIFO::EoF() const noexcept {
+	if (m_error.load(std::memory_order_acquire))
+		return true;
+	return m_closed.load(std::memory_order_acquire) && AvailableBytes() == 0;
+}
+
+bool PriorityFIFO::ExtractMessage(DataType& outBuffer) noexcept {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	if (m_error)
+		return false;
+	WaitReadable(1, lock);
+	if (m_error || m_available.load(std::memory_order_relaxed) == 0)
+		return false;
+
+	outBuffer.clear();
+	Walk(0, outBuffer, true);
+	return true;
+}
+
+std::string PriorityFIFO::HexDump(const std::size_t& collumns, const std::size_t& byte_limit) const noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	const std::size_t avail = m_available.load(std::memory_order_relaxed);
+	const std::size_t count = byte_limit > 0 ? std::min(avail, byte_limit) : avail;
+
+	std::ostringstream oss;
+	oss << "Size: " << avail << " bytes\n";
+	oss << "Lanes: " << m_lanes.size() << '\n';
+	oss << "Status: " << (m_closed ? "closed" : "opened") << " and " << (m_error ? "error" : "ready");
+	oss << '\n';
+
+	if (count > 0) {
+		DataType data;
+		const_cast<PriorityFIFO*>(this)->Walk(count, data, false);
+		std::span<const std::byte> view(data.data(), data.size());
+		oss << FormatHexLines(view, 0, collumns == 0 ? 16 : collumns);
+	}
+	return oss.str();
+}
+
+std::size_t PriorityFIFO::LaneBytes(const std::size_t& lane) const noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	return lane < m_lanes.size() ? m_lanes[lane].Size() : 0;
+}
+
+bool PriorityFIFO::ReadMessage(DataType& outBuffer) noexcept {
+	return ExtractMessage(outBuffer);
+}
+
+void PriorityFIFO::Seek(const std::ptrdiff_t&, const Position&) const noexcept {}
+
+void PriorityFIFO::SetError() noexcept {
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		m_error.store(true, std::memory_order_release);
+	}
+	m_cv.notify_all();
+	Signal();
+}
+
+std::size_t PriorityFIFO::Size() const noexcept {
+	return m_available.load(std::memory_order_acquire);
+}
+
+bool PriorityFIFO::WriteLane(const std::size_t& lane, DataType&& data) noexcept {
+	if (lane >= m_lanes.size())
+		return false;
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		if (m_closed || m_error)
+			return false;
+		m_lanes[lane].Push(std::move(data));
+		Update();
+	}
+	m_cv.notify_all();
+	Signal();
+	return true;
+}
+
+std::size_t PriorityFIFO::Pick(std::vector<std::size_t>& credits, const std::vector<std::size_t>& position) const noexcept {
+	const std::size_t lanes = m_lanes.size();
+	if (m_weights.empty()) {
+		for (std::size_t lane = 0; lane < lanes; ++lane)
+			if (position[lane] < m_lanes[lane].End())
+				return lane;
+		return 0;
+	}
+	for (int round = 0; round < 2; ++round) {
+		for (std::size_t lane = 0; lane < lanes; ++lane) {
+			if (credits[lane] > 0 && position[lane] < m_lanes[lane].End()) {
+				--credits[lane];
+				return lane;
+			}
+		}
+		// Every lane with data used its turns: start a new round
+		credits = m_weights;
+	}
+	return 0;
+}
+
+bool PriorityFIFO::ReadInternal(const std::size_t& count, DataType& outBuffer, const Operation& flag) noexcept {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	std::size_t avail = m_available.load(std::memory_order_relaxed);
+	if (m_error || (m_closed && avail == 0))
+		return false;
+
+	const std::size_t real_count = count == 0 ? avail : count;
+	if (real_count > avail && !m_closed) {
+		WaitReadable(real_count, lock);
+		avail = m_available.load(std::memory_order_relaxed);
+	}
+	if (m_error || (avail == 0 && count == 0) || real_count > avail)
+		return false;
+
+	switch (flag) {
+		case Operation::Peek:
+			Walk(real_count, outBuffer, false);
+			return true;
+		case Operation::Read:
+		case Operation::Extract:
+			Walk(real_count, outBuffer, true);
+			return true;
+		default:
+			return false;
+	}
+}
+
+bool PriorityFIFO::ReadInternal(const std::size_t& count, WriteOnly& outBuffer, const Operation& flag) noexcept {
+	DataType data;
+	if (!ReadInternal(count, data, flag))
+		return false;
+	return outBuffer.Write(0, std::move(data));
+}
+
+void PriorityFIFO::Update() noexcept {
+	std::size_t total = 0;
+	for (const ChunkQueue& lane: m_lanes)
+		total += lane.Size();
+	m_available.store(total, std::memory_order_release);
+}
+
+void PriorityFIFO::WaitReadable(const std::size_t& n, std::unique_lock<std::mutex>& lock) const {
+	m_cv.wait(lock, [&] {
+		return m_closed || m_error || m_available.load(std::memory_order_relaxed) >= n;
+	});
+}
+
+void PriorityFIFO::Walk(std::size_t count, DataType& outBuffer, const bool& consume) noexcept {
+	// A count of 0 takes exactly the rest of the next write
+	const bool message = count == 0;
+	std::vector<std::size_t> credits = m_credits;
+	std::size_t partial = m_partial;
+	std::vector<std::size_t> position(m_lanes.size());
+	for (std::size_t lane = 0; lane < m_lanes.size(); ++lane)
+		position[lane] = m_lanes[lane].Begin();
+
+	do {
+		const std::size_t lane = partial != NoLane ? partial : Pick(credits, position);
+		ChunkQueue& queue = m_lanes[lane];
+		const std::size_t end = queue.ChunkEnd(position[lane]);
+		const std::size_t take = message ? end - position[lane] : std::min(count, end - position[lane]);
+		// A whole write leaves by move when nothing else was taken yet
+		if (consume && outBuffer.empty() && position[lane] == queue.Begin() && take == queue.FrontSize())
+			(void)queue.Pop(outBuffer);
+		else
+			(void)queue.Copy(position[lane], take, outBuffer);
+		position[lane] += take;
+		count -= message ? 0 : take;
+		partial = position[lane] == end ? NoLane : lane;
+	} while (!message && count > 0);
+
+	if (!consume)
+		return;
+	for (std::size_t lane = 0; lane < m_lanes.size(); ++lane)
+		m_lanes[lane].Release(position[lane]);
+	m_credits = std::move(credits);
+	m_partial = partial;
+	Update();
+}
+
+bool PriorityFIFO::WriteInternal(const std::size_t& count, const DataType& src) noexcept {
+	if (count > 0 && src.size() < count)
+		return false;
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		if (m_closed || m_error)
+			return false;
+		m_lanes.back().Push(src, count);
+		Update();
+	}
+	m_cv.notify_all();
+	Signal();
+	return true;
+}
+
+bool PriorityFIFO::WriteInternal(const std::size_t& count, DataType&& src) noexcept {
+	if (count > 0 && src.size() < count)
+		return false;
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		if (m_closed || m_error)
+			return false;
+		if (count == 0 || count == src.size())
+			m_lanes.back().Push(std::move(src));
+		else
+			m_lanes.back().Push(src, count);
+		Update();
+	}
+	m_cv.notify_all();
+	Signal();
+	return true;
+}
\ No newline at end of file
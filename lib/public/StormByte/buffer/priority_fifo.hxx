@@ -0,0 +1,266 @@
+#pragma once
+
+#include <StormByte/buffer/chunk_queue.hxx>
+#include <StormByte/buffer/shared_fifo.hxx>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class PriorityFIFO
+	 * @brief SharedFIFO with several priority lanes, so control data overtakes bulk data.
+	 *
+	 * @par Overview
+	 *  Lane 0 has the highest priority. @ref WriteLane() (Producer::WriteLane())
+	 *  appends to a given lane; plain writes go to the last, lowest-priority lane,
+	 *  so existing writers become bulk traffic. Every write is kept as one chunk,
+	 *  and readers take whole chunks from the lanes in priority order: bytes never
+	 *  interleave inside a write, and each lane stays in FIFO order.
+	 *
+	 * @par Policies
+	 *  - Strict (lane count constructor): the highest-priority lane with data is
+	 *    always served first; a busy control lane can starve bulk lanes.
+	 *  - Weighted (weights constructor): lanes take turns, lane @c i getting up to
+	 *    @c weights[i] writes per round in priority order, so every lane with data
+	 *    keeps making progress.
+	 *
+	 * @par Semantics
+	 *  Blocking, close and error behave as in @ref SharedFIFO. Differences:
+	 *  - the priority order has no stable position to come back to, so
+	 *    @ref Read() consumes like @ref Extract() and @ref Seek() does nothing;
+	 *    @ref Peek() copies the bytes the next read would return;
+	 *  - @ref ExtractMessage() and @ref ReadMessage() return the next write, by move;
+	 *  - @ref Data() is not available (lanes are not contiguous) and returns an
+	 *    empty buffer.
+	 *  Producer write combining merges writes of one lane only; leave it disabled
+	 *  when message boundaries matter.
+	 *
+	 * @par Thread safety
+	 *  All public member functions are thread-safe. Status queries only load atomics.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC PriorityFIFO final: public SharedFIFO {
+		public:
+			/**
+			 * @brief Construct with @p lanes lanes served in strict priority order.
+			 * @param lanes Number of lanes (0 behaves as 1).
+			 */
+			explicit PriorityFIFO(const std::size_t& lanes = 2);
+
+			/**
+			 * @brief Construct with one lane per weight, served by weighted round robin.
+			 * @param weights Writes each lane may hand out per round (0 behaves as 1).
+			 */
+			explicit PriorityFIFO(const std::vector<std::size_t>& weights);
+
+			/**
+			 * @brief Copy constructor deleted.
+			 */
+			PriorityFIFO(const PriorityFIFO&)						= delete;
+
+			/**
+			 * @brief Move constructor deleted.
+			 */
+			PriorityFIFO(PriorityFIFO&&)							= delete;
+
+			/**
+			 * @brief Destructor.
+			 */
+			~PriorityFIFO() noexcept override						= default;
+
+			/**
+			 * @brief Copy assignment deleted.
+			 */
+			PriorityFIFO& operator=(const PriorityFIFO&)			= delete;
+
+			/**
+			 * @brief Move assignment deleted.
+			 */
+			PriorityFIFO& operator=(PriorityFIFO&&)					= delete;
+
+			/**
+			 * @brief Get the number of bytes stored in every lane.
+			 * @return Readable bytes.
+			 */
+			std::size_t 											AvailableBytes() const noexcept override;
+
+			/**
+			 * @brief Nothing to release: reads already free what they return.
+			 */
+			void 													Clean() noexcept override;
+
+			/**
+			 * @brief Release the content of every lane.
+			 */
+			void 													Clear() noexcept override;
+
+			/**
+			 * @brief Close for further writes and wake every waiter.
+			 */
+			void 													Close() noexcept override;
+
+			/**
+			 * @brief Contiguous data is not available for a set of lanes.
+			 * @return An empty buffer.
+			 */
+			inline const DataType& 									Data() const noexcept override {
+				return m_buffer;
+			}
+
+			/**
+			 * @brief Discard the next @p count bytes in priority order, blocking like @ref Read().
+			 * @param count Number of bytes to discard.
+			 * @return false if not enough bytes became available, true otherwise.
+			 */
+			bool 													Drop(const std::size_t& count) noexcept override;
+
+			/**
+			 * @brief Check whether every lane is empty.
+			 * @return true if nothing is stored.
+			 */
+			bool 													Empty() const noexcept override;
+
+			/**
+			 * @brief Check for end of stream.
+			 * @return true if errored, or closed with no bytes left to read.
+			 */
+			bool 													EoF() const noexcept override;
+
+			/**
+			 * @brief Blocking destructive read of the next write in priority order.
+			 * @param outBuffer Replaced with the write; moved out unless partially read before.
+			 * @return false if nothing became available (closed or error), true otherwise.
+			 */
+			bool 													ExtractMessage(DataType& outBuffer) noexcept override;
+
+			/**
+			 * @brief Hex dump of the bytes in the order they would be read.
+			 * @param collumns Bytes per line (0 selects 16).
+			 * @param byte_limit Maximum bytes to dump (0 for all available).
+			 * @return Formatted dump.
+			 */
+			std::string 											HexDump(const std::size_t& collumns = 0, const std::size_t& byte_limit = 0) const noexcept override;
+
+			/**
+			 * @brief Get the number of bytes stored in one lane.
+			 * @param lane Lane index.
+			 * @return Bytes stored, 0 for an unknown lane.
+			 */
+			std::size_t 											LaneBytes(const std::size_t& lane) const noexcept;
+
+			/**
+			 * @brief Get the number of lanes.
+			 * @return Lane count.
+			 */
+			inline std::size_t 										Lanes() const noexcept {
+				return m_lanes.size();
+			}
+
+			/**
+			 * @brief Same as @ref ExtractMessage(): reads do not keep a position.
+			 * @param outBuffer Replaced with the write.
+			 * @return false if nothing became available (closed or error), true otherwise.
+			 */
+			bool 													ReadMessage(DataType& outBuffer) noexcept override;
+
+			/**
+			 * @brief Reads do not keep a position; does nothing.
+			 */
+			void 													Seek(const std::ptrdiff_t& offset, const Position& mode) const noexcept override;
+
+			/**
+			 * @brief Mark the buffer as errored and wake every waiter.
+			 */
+			void 													SetError() noexcept override;
+
+			/**
+			 * @brief Get the number of bytes stored in every lane.
+			 * @return Bytes written and not yet read.
+			 */
+			std::size_t 											Size() const noexcept override;
+
+			/**
+			 * @brief Append @p data to lane @p lane.
+			 * @param lane Lane index; 0 is the highest priority.
+			 * @param data Bytes to write, kept as one chunk (moved in).
+			 * @return false if closed, errored, or @p lane does not exist.
+			 */
+			bool 													WriteLane(const std::size_t& lane, DataType&& data) noexcept override;
+
+		protected:
+			/**
+			 * @brief Check whether @p lane has a higher priority than plain writes.
+			 * @param lane Lane index.
+			 * @return true for every existing lane but the last, lowest-priority one.
+			 */
+			inline bool 											Overtakes(const std::size_t& lane) const noexcept override {
+				return lane + 1 < m_lanes.size();
+			}
+
+		private:
+			static constexpr std::size_t NoLane = static_cast<std::size_t>(-1);	///< No lane selected.
+
+			std::vector<ChunkQueue> m_lanes;						///< Stored writes, one queue per lane.
+			const std::vector<std::size_t> m_weights;				///< Writes per round for each lane (empty: strict).
+			std::vector<std::size_t> m_credits;						///< Writes left in the current round for each lane.
+			std::size_t m_partial {NoLane};							///< Lane whose front write was partially read.
+			std::atomic<std::size_t> m_available {0};				///< Published byte count.
+
+			/**
+			 * @brief Pick the lane the next write is taken from.
+			 * @param credits Round-robin credits, updated.
+			 * @param position Read position in each lane.
+			 * @return Lane index; requires at least one lane with data.
+			 */
+			std::size_t 											Pick(std::vector<std::size_t>& credits, const std::vector<std::size_t>& position) const noexcept;
+
+			/**
+			 * @brief Blocking read.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													ReadInternal(const std::size_t& count, DataType& outBuffer, const Operation& flag) noexcept override;
+
+			/**
+			 * @brief Blocking read into a WriteOnly buffer.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													ReadInternal(const std::size_t& count, WriteOnly& outBuffer, const Operation& flag) noexcept override;
+
+			/**
+			 * @brief Publish the byte count for lock-free status queries. Requires @c m_mutex.
+			 */
+			void 													Update() noexcept;
+
+			/**
+			 * @brief Wait until @p n bytes are stored, or closed/errored.
+			 * @param n Number of bytes required.
+			 * @param lock Held lock on @c m_mutex.
+			 */
+			void 													WaitReadable(const std::size_t& n, std::unique_lock<std::mutex>& lock) const;
+
+			/**
+			 * @brief Take @p count bytes in priority order. Requires @c m_mutex and enough bytes.
+			 * @param count Number of bytes.
+			 * @param outBuffer Receives the bytes; a whole write into an empty buffer is moved.
+			 * @param consume false to copy without changing any state (peek).
+			 */
+			void 													Walk(std::size_t count, DataType& outBuffer, const bool& consume) noexcept;
+
+			/**
+			 * @brief Copy @p count bytes of @p src (0 for all) to the lowest-priority lane.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													WriteInternal(const std::size_t& count, const DataType& src) noexcept override;
+
+			/**
+			 * @brief Move @p src to the lowest-priority lane when written whole.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													WriteInternal(const std::size_t& count, DataType&& src) noexcept override;
+	};
+}
@@ -0,0 +1,84 @@
+#include <StormByte/buffer/producer.hxx>
+
+using namespace StormByte::Buffer;
+
+void Producer::DisableWriteCombining() noexcept {
+	(void)Flush();
+	m_combine_threshold = 0;
+	m_combine_delay = std::chrono::microseconds::zero();
+}
+
+void Producer::EnableWriteCombining(const std::size_t& threshold, const std::chrono::microseconds& max_delay) noexcept {
+	if (threshold == 0) {
+		DisableWriteCombining();
+		return;
+	}
+	m_combine_threshold = threshold;
+	m_combine_delay = max_delay;
+	m_pending.reserve(threshold);
+}
+
+bool Producer::Flush() noexcept {
+	if (m_pending.empty() || !m_buffer)
+		return true;
+	// The buffer copies the bytes into its own storage: written from here, the
+	// combining buffer keeps its allocation for the next batch
+	const bool written = m_buffer->Write(m_pending.size(), m_pending);
+	m_pending.clear();
+	return written;
+}
+
+WriteAwaitable Producer::WriteAsync(DataType&& data, std::shared_ptr<Executor> executor) noexcept {
+	if (m_pending.empty())
+		return { m_buffer, std::move(data), std::move(executor) };
+	// A separate Flush() could block: pending bytes go first in the same write
+	DataType bytes = std::move(m_pending);
+	m_pending.clear();
+	bytes.insert(bytes.end(), data.begin(), data.end());
+	return { m_buffer, std::move(bytes), std::move(executor) };
+}
+
+bool Producer::CombineWrite(const std::size_t& count, const DataType& data) noexcept {
+	if (count > data.size() || !m_buffer->IsWritable())
+		return false;
+	const std::size_t real_count = (count == 0) ? data.size() : count;
+
+	// Large writes with nothing pending gain nothing from being copied twice
+	if (m_pending.empty() && real_count >= m_combine_threshold)
+		return m_buffer->Write(real_count, data);
+
+	if (m_pending.empty()) {
+		m_pending_since = std::chrono::steady_clock::now();
+		// Given away by WriteAsync(): allocate once for the whole batch
+		if (m_pending.capacity() < m_combine_threshold)
+			m_pending.reserve(m_combine_threshold);
+	}
+	m_pending.insert(m_pending.end(), data.begin(), data.begin() + real_count);
+	return FlushIfDue();
+}
+
+bool Producer::CombineWrite(const std::size_t& count, DataType&& data) noexcept {
+	if (count > data.size() || !m_buffer->IsWritable())
+		return false;
+	const std::size_t real_count = (count == 0) ? data.size() : count;
+
+	if (m_pending.empty() && real_count >= m_combine_threshold)
+		return m_buffer->Write(real_count, std::move(data));
+
+	if (m_pending.empty()) {
+		m_pending_since = std::chrono::steady_clock::now();
+		// Given away by WriteAsync(): allocate once for the whole batch
+		if (m_pending.capacity() < m_combine_threshold)
+			m_pending.reserve(m_combine_threshold);
+	}
+	m_pending.insert(m_pending.end(), data.begin(), data.begin() + real_count);
+	return FlushIfDue();
+}
+
+bool Producer::FlushIfDue() noexcept {
+	if (m_pending.size() >= m_combine_threshold)
+		return Flush();
+	if (m_combine_delay.count() > 0 && std::chrono::steady_clock::now() - m_pending_since >= m_combine_delay)
+		return Flush();
+	return true;
+}
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include <StormByte/buffer/consumer.hxx>
 
+#include <chrono>
+
 /**
  * @namespace Buffer
  * @brief Namespace for buffer-related components in the StormByte library.
@@ -23,6 +25,15 @@ namespace StormByte::Buffer {
 	 * @par Thread safety
 	 *  All write operations are thread-safe as they delegate to the underlying
 	 *  SharedFIFO which is fully thread-safe.
+	 *
+	 * @par Write combining
+	 *  @ref EnableWriteCombining() turns on an opt-in coalescing buffer that
+	 *  lives in this Producer instance (copies of a Producer each get their own,
+	 *  empty one). Small writes are appended to it and handed to the SharedFIFO
+	 *  in one locked write when the byte threshold is reached, when the time
+	 *  budget has elapsed at the next write, on @ref Flush(), on @ref Close() or
+	 *  when the Producer is destroyed. A single Producer instance with write
+	 *  combining enabled must therefore be used from one thread at a time.
 	 */
 	class STORMBYTE_BUFFER_PUBLIC Producer final: public WriteOnly {
 		public:
@@ -54,42 +65,64 @@ namespace StormByte::Buffer {
 			 * @details Copies the Producer instance, sharing the same underlying buffer.
 			 *          Both instances will write to the same SharedFIFO.
 			 */
-			inline Producer(const Producer& other) noexcept {
-				m_buffer = other.m_buffer;
-			}
+			inline Producer(const Producer& other) noexcept:
+			m_buffer(other.m_buffer),
+			m_combine_threshold(other.m_combine_threshold),
+			m_combine_delay(other.m_combine_delay) {}
 
 			/**
 			 * @brief Move constructor.
 			 * @param other Source Producer to move from.
 			 * @details Transfers ownership of the buffer from the moved-from Producer.
 			 */
-			inline Producer(Producer&& other) noexcept {
-				m_buffer = std::move(other.m_buffer);
+			inline Producer(Producer&& other) noexcept:
+			m_buffer(std::move(other.m_buffer)),
+			m_pending(std::move(other.m_pending)),
+			m_combine_threshold(other.m_combine_threshold),
+			m_combine_delay(other.m_combine_delay),
+			m_pending_since(other.m_pending_since) {
+				other.m_pending.clear();
 			}
 
 			/**
 			 * @brief Destructor.
+			 * @details Flushes any bytes still pending in the write-combining buffer.
 			 */
-			~Producer() noexcept										= default;
+			inline ~Producer() noexcept {
+				(void)Flush();
+			}
 
 			/**
 			 * @brief Copy assignment operator.
 			 * @param other Source Producer to copy from.
 			 * @return Reference to this Producer.
+			 * @details Pending combined bytes are flushed to the current buffer first.
 			 */
 			inline Producer& operator=(const Producer& other) noexcept {
-				if (this != &other)
+				if (this != &other) {
+					(void)Flush();
 					m_buffer = other.m_buffer;
+					m_combine_threshold = other.m_combine_threshold;
+					m_combine_delay = other.m_combine_delay;
+				}
 				return *this;
 			}
 
 			/**
 			 * @brief Move assignment operator.
 			 * @return Reference to this Producer.
+			 * @details Pending combined bytes are flushed to the current buffer first.
 			 */
 			inline Producer& operator=(Producer&& other) noexcept {
-				if (this != &other)
+				if (this != &other) {
+					(void)Flush();
 					m_buffer = std::move(other.m_buffer);
+					m_pending = std::move(other.m_pending);
+					other.m_pending.clear();
+					m_combine_threshold = other.m_combine_threshold;
+					m_combine_delay = other.m_combine_delay;
+					m_pending_since = other.m_pending_since;
+				}
 				return *this;
 			}
 
@@ -109,30 +142,153 @@ namespace StormByte::Buffer {
 				return !(*this == other);
 			}
 
+			/**
+			 * @brief Clear the writable descriptor, setting it again if still writable.
+			 * @see WritableDescriptor(), SharedFIFO::AcknowledgeWritable()
+			 */
+			inline void 												AcknowledgeWritable() const noexcept {
+				m_buffer->AcknowledgeWritable();
+			}
+
 			/**
 			 * @brief Thread-safe close for further writes.
-			 * @details Marks buffer as closed, notifies all waiting threads. Subsequent writes
-			 *          are ignored. The buffer remains readable until all data is consumed.
+			 * @details Flushes pending combined bytes, then marks buffer as closed and
+			 *          notifies all waiting threads. Subsequent writes are ignored.
+			 *          The buffer remains readable until all data is consumed.
 			 * @see FIFO::Close(), IsWritable()
 			 */
 			inline void 												Close() noexcept {
+				(void)Flush();
 				m_buffer->Close();
 			}
 
+			/**
+			 * @brief Disable write combining.
+			 * @details Flushes any pending bytes; subsequent writes go straight to the
+			 *          shared buffer.
+			 * @see EnableWriteCombining()
+			 */
+			void 														DisableWriteCombining() noexcept;
+
+			/**
+			 * @brief Start counting traffic and blocked time on the shared buffer.
+			 * @see SharedFIFO::EnableStatistics(), Statistics()
+			 */
+			inline void 												EnableStatistics() const noexcept {
+				m_buffer->EnableStatistics();
+			}
+
+			/**
+			 * @brief Record the shared buffer's events to @p tracer.
+			 * @param tracer Tracer receiving the events.
+			 * @param id Buffer id the events carry.
+			 * @return false if the buffer already has a tracer or @p tracer is null.
+			 * @see SharedFIFO::EnableTracing()
+			 */
+			inline bool 												EnableTracing(std::shared_ptr<Tracer> tracer, const std::uint32_t& id) const noexcept {
+				return m_buffer->EnableTracing(std::move(tracer), id);
+			}
+
+			/**
+			 * @brief Enable write combining for this Producer instance.
+			 * @param threshold Number of pending bytes that triggers a flush. A value of
+			 *        zero disables write combining.
+			 * @param max_delay Maximum age of the oldest pending byte. When a write finds
+			 *        pending data older than this it flushes. Zero disables the time budget.
+			 * @details Writes are appended to a buffer local to this instance and reach
+			 *          the shared FIFO in a single locked write, reducing lock acquisitions
+			 *          and consumer wakeups for streams of small writes. Writes that alone
+			 *          reach the threshold bypass the buffer when nothing is pending.
+			 * @note The time budget is evaluated on writes; there is no background timer,
+			 *       so call @ref Flush() when the stream goes idle.
+			 * @see Flush(), DisableWriteCombining()
+			 */
+			void 														EnableWriteCombining(const std::size_t& threshold, const std::chrono::microseconds& max_delay = std::chrono::microseconds::zero()) noexcept;
+
+			/**
+			 * @brief Flush pending combined bytes to the shared buffer.
+			 * @return true if nothing was pending or the write succeeded, false otherwise.
+			 */
+			bool 														Flush() noexcept;
+
+			/**
+			 * @brief Check whether the buffer is in the error state.
+			 * @return true once the buffer, or a reader of it, set the error.
+			 * @see SharedFIFO::HasError()
+			 */
+			inline bool 												HasError() const noexcept {
+				return m_buffer->HasError();
+			}
+
 			inline bool 												IsWritable() const noexcept override {
 				return m_buffer->IsWritable();
 			}
 
+			/**
+			 * @brief Call @p callback once the buffer enters the error state.
+			 * @param callback Callback to run once.
+			 * @param executor Executor to post the callback to (null: run it in the signalling thread).
+			 * @return Callback id for @ref RemoveCallback().
+			 * @see SharedFIFO::OnError()
+			 */
+			inline std::size_t 											OnError(SharedFIFO::Callback callback, std::shared_ptr<Executor> executor = nullptr) const noexcept {
+				return m_buffer->OnError(std::move(callback), std::move(executor));
+			}
+
+			/**
+			 * @brief Call @p callback when a write of @p bytes would not wait.
+			 * @param bytes Size of the intended write.
+			 * @param callback Callback to run.
+			 * @param persistent Keep the callback armed after it fired.
+			 * @param executor Executor to post the callback to (null: run it in the consuming thread).
+			 * @return Callback id for @ref RemoveCallback().
+			 * @details Only a bounded SharedFIFO makes writes wait.
+			 * @see SharedFIFO::OnWritable()
+			 */
+			inline std::size_t 											OnWritable(const std::size_t& bytes, SharedFIFO::Callback callback, const bool& persistent = false, std::shared_ptr<Executor> executor = nullptr) const noexcept {
+				return m_buffer->OnWritable(bytes, std::move(callback), persistent, std::move(executor));
+			}
+
+			/**
+			 * @brief Gets the number of bytes pending in the write-combining buffer.
+			 * @return Number of bytes written but not yet flushed to the shared buffer.
+			 */
+			inline std::size_t 											PendingBytes() const noexcept {
+				return m_pending.size();
+			}
+
+			/**
+			 * @brief Unregister a readiness callback.
+			 * @param id Id returned when registering.
+			 * @return false if the id is unknown (already fired one-shot or removed).
+			 * @see SharedFIFO::RemoveCallback()
+			 */
+			inline bool 												RemoveCallback(const std::size_t& id) const noexcept {
+				return m_buffer->RemoveCallback(id);
+			}
+
 			/**
 			 * @brief Thread-safe error state setting.
-			 * @details Marks buffer as erroneous (unreadable and unwritable), notifies all
-			 *          waiting threads. Subsequent writes are ignored and reads will fail.
+			 * @details Discards pending combined bytes, then marks buffer as erroneous
+			 *          (unreadable and unwritable) and notifies all waiting threads.
+			 *          Subsequent writes are ignored and reads will fail.
 			 * @see FIFO::SetError(), IsReadable(), IsWritable()
 			 */
 			inline void 												SetError() noexcept {
+				m_pending.clear();
 				m_buffer->SetError();
 			}
 
+			/**
+			 * @brief Read the shared buffer's counters.
+			 * @return Counters; all zero until statistics are enabled.
+			 * @details Bytes still pending in the write-combining buffer are not counted.
+			 * @see SharedFIFO::Statistics()
+			 */
+			inline SharedFIFO::Counters 								Statistics() const noexcept {
+				return m_buffer->Statistics();
+			}
+
 			/**
 			 * @brief Write bytes from a vector to the buffer.
 			 * @param count Number of bytes to write.
@@ -143,7 +299,9 @@ namespace StormByte::Buffer {
 			 * @see IsClosed()
 			 */
 			inline bool 												Write(const std::size_t& count, const DataType& data) noexcept override {
-				return m_buffer->Write(count, data);
+				if (m_combine_threshold == 0)
+					return m_buffer->Write(count, data);
+				return CombineWrite(count, data);
 			}
 
 			/**
@@ -168,7 +326,9 @@ namespace StormByte::Buffer {
 			 * @see IsClosed()
 			 */
 			inline bool 												Write(const std::size_t& count, DataType&& data) noexcept override {
-				return m_buffer->Write(count, std::move(data));
+				if (m_combine_threshold == 0)
+					return m_buffer->Write(count, std::move(data));
+				return CombineWrite(count, std::move(data));
 			}
 
 			/**
@@ -193,7 +353,12 @@ namespace StormByte::Buffer {
 			 * @see IsClosed()
 			 */
 			inline bool 												Write(const std::size_t& count, const ReadOnly& data) noexcept override {
-				return m_buffer->Write(count, data);
+				if (m_combine_threshold == 0)
+					return m_buffer->Write(count, data);
+				DataType bytes;
+				if (!data.Read(count, bytes))
+					return false;
+				return CombineWrite(bytes.size(), std::move(bytes));
 			}
 
 			/**
@@ -206,24 +371,143 @@ namespace StormByte::Buffer {
 			 * @see IsClosed()
 			 */
 			inline bool 												Write(const std::size_t& count, ReadOnly&& data) noexcept override {
-				return m_buffer->Write(count, std::move(data));
+				if (m_combine_threshold == 0)
+					return m_buffer->Write(count, std::move(data));
+				DataType bytes;
+				if (!data.Extract(count, bytes))
+					return false;
+				return CombineWrite(bytes.size(), std::move(bytes));
 			}
 
 			/** Expose the rest of overloads */
 			using WriteOnly::Write;
-			
+
+			/**
+			 * @brief Descriptor that polls readable while a write would not wait.
+			 * @return File descriptor for poll/epoll, or -1 if unsupported on this platform.
+			 * @details Only a bounded SharedFIFO is ever not writable. Owned by the
+			 *          buffer; do not close it.
+			 * @see AcknowledgeWritable(), SharedFIFO::WritableDescriptor()
+			 */
+			inline int 													WritableDescriptor() const noexcept {
+				return m_buffer->WritableDescriptor();
+			}
+
+			/**
+			 * @brief Asynchronous write that suspends instead of blocking.
+			 * @param data Bytes to write.
+			 * @param executor Executor resuming the coroutine; null resumes in the consuming thread.
+			 * @return Awaitable yielding the bool @ref Write() would return.
+			 * @details Only a SharedFIFO in bounded mode makes writes wait; the coroutine
+			 *          is resumed once a consumer has freed enough room. Pending
+			 *          write-combined bytes are sent first, as part of the same write.
+			 * @see SharedFIFO::Limit(), Consumer::ReadAsync()
+			 */
+			WriteAwaitable 												WriteAsync(DataType&& data, std::shared_ptr<Executor> executor = nullptr) noexcept;
+
+			/**
+			 * @brief Asynchronous write of a copy of @p data.
+			 * @param data Bytes to write.
+			 * @param executor Executor resuming the coroutine; null resumes in the consuming thread.
+			 * @return Awaitable yielding the bool @ref Write() would return.
+			 */
+			inline WriteAwaitable 										WriteAsync(const DataType& data, std::shared_ptr<Executor> executor = nullptr) noexcept {
+				return WriteAsync(DataType(data), std::move(executor));
+			}
+
+			/**
+			 * @brief Write @p data to a priority lane of a @ref PriorityFIFO.
+			 * @param lane Lane index; 0 is the highest priority.
+			 * @param data Bytes to write, moved in.
+			 * @return bool indicating success or failure.
+			 * @details A lane of higher priority than plain writes bypasses write
+			 *          combining, so control data is not held back behind pending
+			 *          bulk bytes. Pending bytes are flushed first when @p lane is the
+			 *          one plain writes go to, and always on other buffers, which
+			 *          have a single lane and ignore @p lane.
+			 * @see PriorityFIFO::WriteLane()
+			 */
+			inline bool 												WriteLane(const std::size_t& lane, DataType&& data) noexcept {
+				if (!m_buffer->Overtakes(lane) && !Flush())
+					return false;
+				return m_buffer->WriteLane(lane, std::move(data));
+			}
+
+			/**
+			 * @brief Write a copy of @p data to a priority lane of a @ref PriorityFIFO.
+			 * @param lane Lane index; 0 is the highest priority.
+			 * @param data Bytes to write.
+			 * @return bool indicating success or failure.
+			 */
+			inline bool 												WriteLane(const std::size_t& lane, const DataType& data) noexcept {
+				return WriteLane(lane, DataType(data));
+			}
+
+			/**
+			 * @brief Write a numbered block to a @ref ReorderFIFO.
+			 * @param sequence Position of the block in the stream.
+			 * @param data Bytes of the block, moved in.
+			 * @return false if rejected (not a ReorderFIFO, duplicate or stale sequence, closed or error).
+			 * @details Bypasses write combining: blocks keep their own boundaries.
+			 *          Blocks until @p sequence fits the reorder window.
+			 * @see ReorderFIFO::WriteSequence()
+			 */
+			inline bool 												WriteSequence(const std::uint64_t& sequence, DataType&& data) noexcept {
+				return m_buffer->WriteSequence(sequence, std::move(data));
+			}
+
+			/**
+			 * @brief Write a copy of a numbered block to a @ref ReorderFIFO.
+			 * @param sequence Position of the block in the stream.
+			 * @param data Bytes of the block.
+			 * @return false if rejected (not a ReorderFIFO, duplicate or stale sequence, closed or error).
+			 */
+			inline bool 												WriteSequence(const std::uint64_t& sequence, const DataType& data) noexcept {
+				return m_buffer->WriteSequence(sequence, DataType(data));
+			}
+
 			/**
 			 * @brief Create a Consumer for reading from this Producer's buffer.
 			 * @return A Consumer instance sharing the underlying buffer.
 			 * @details Enables producer-consumer pattern. Consumer has read-only access
-			 *          to the same SharedFIFO buffer this Producer writes to.
+			 *          to the same SharedFIFO buffer this Producer writes to. For a
+			 *          @ref BroadcastFIFO every call returns a Consumer with its own
+			 *          read cursor over the shared data.
 			 * @see Consumer
 			 */
 			inline class Consumer										Consumer() {
-				return { m_buffer };
+				return { m_buffer->ConsumerView(m_buffer) };
 			}
 			
 		protected:
 			std::shared_ptr<SharedFIFO> m_buffer;
+
+		private:
+			DataType m_pending;											///< Write-combining buffer local to this instance.
+			std::size_t m_combine_threshold {0};						///< Flush threshold in bytes (0: write combining disabled).
+			std::chrono::microseconds m_combine_delay {0};				///< Maximum age of pending bytes (0: no time budget).
+			std::chrono::steady_clock::time_point m_pending_since;		///< Time the oldest pending byte was written.
+
+			/**
+			 * @brief Append bytes to the write-combining buffer, flushing when due.
+			 * @param count Number of bytes to write; 0 writes all of @p data.
+			 * @param data Source bytes.
+			 * @return bool indicating success or failure.
+			 */
+			bool 														CombineWrite(const std::size_t& count, const DataType& data) noexcept;
+
+			/**
+			 * @brief Append bytes to the write-combining buffer, flushing when due (move version).
+			 * @param count Number of bytes to write; 0 writes all of @p data.
+			 * @param data Source bytes.
+			 * @return bool indicating success or failure.
+			 */
+			bool 														CombineWrite(const std::size_t& count, DataType&& data) noexcept;
+
+			/**
+			 * @brief Flush when the threshold or the time budget has been reached.
+			 * @return true if nothing was due or the flush succeeded, false otherwise.
+			 */
+			bool 														FlushIfDue() noexcept;
 	};
 }
@@ -0,0 +1,74 @@
+#include <StormByte/buffer/reorder_fifo.hxx>
+
+#include <algorithm>
+
+using namespace StormByte::Buffer;
+
+ReorderFIFO::ReorderFIFO(const std::size_t& window, const std::uint64_t& first):
+	MessageFIFO(), m_slots(std::max<std::size_t>(window, 1)), m_filled(m_slots.size(), false), m_next(first) {}
+
+std::uint64_t ReorderFIFO::NextSequence() const noexcept {
+	return m_next.load(std::memory_order_acquire);
+}
+
+std::size_t ReorderFIFO::Parked() const noexcept {
+	return m_parked.load(std::memory_order_acquire);
+}
+
+bool ReorderFIFO::WriteSequence(const std::uint64_t& sequence, DataType&& data) noexcept {
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		const std::size_t window = m_slots.size();
+		// Backpressure: a block too far ahead waits for the gap to be filled
+		const auto room = [&] {
+			return m_closed || m_error || sequence - m_next.load(std::memory_order_relaxed) < window || sequence < m_next.load(std::memory_order_relaxed);
+		};
+		if (!room()) {
+			const auto start = StartWait();
+			m_cv.wait(lock, room);
+			CountWait(start, true);
+		}
+		std::uint64_t next = m_next.load(std::memory_order_relaxed);
+		if (m_closed || m_error || sequence < next)
+			return false;
+
+		const std::size_t slot = sequence % window;
+		if (sequence != next) {
+			if (m_filled[slot])
+				return false;
+			m_slots[slot] = std::move(data);
+			m_filled[slot] = true;
+			m_parked.store(m_parked.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+			return true;
+		}
+
+		// In order: append it and every parked block that now follows, by move
+		Append(std::move(data));
+		for (std::size_t index = ++next % window; m_filled[index]; index = ++next % window) {
+			Append(std::move(m_slots[index]));
+			m_slots[index] = DataType();
+			m_filled[index] = false;
+			m_parked.store(m_parked.load(std::memory_order_relaxed) - 1, std::memory_order_release);
+		}
+		m_next.store(next, std::memory_order_release);
+	}
+	m_cv.notify_all();
+	Signal();
+	return true;
+}
+
+bool ReorderFIFO::WriteInternal(const std::size_t&, const DataType&) noexcept {
+	return false;
+}
+
+bool ReorderFIFO::WriteInternal(const std::size_t&, DataType&&) noexcept {
+	return false;
+}
+
+bool ReorderFIFO::WriteInternal(const std::size_t&, const ReadOnly&) noexcept {
+	return false;
+}
+
+bool ReorderFIFO::WriteInternal(const std::size_t&, ReadOnly&&) noexcept {
+	return false;
+}
\ No newline at end of file
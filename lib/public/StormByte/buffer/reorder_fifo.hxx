@@ -0,0 +1,133 @@
+#pragma once
+
+#include <StormByte/buffer/message_fifo.hxx>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class ReorderFIFO
+	 * @brief MessageFIFO that reassembles numbered blocks written out of order.
+	 *
+	 * @par Overview
+	 *  Parallel workers write their results with @ref WriteSequence() (through
+	 *  Producer::WriteSequence()), tagged with the position of the block in the
+	 *  stream. Consumers read the blocks strictly in sequence order: a block is
+	 *  readable once every block before it has been written. Each block is one
+	 *  message, so Consumer::ExtractMessage() hands it out by move and a
+	 *  contiguous run is passed on without copying any byte.
+	 *
+	 * @par Reorder window
+	 *  Blocks that arrive early are parked in a ring of @ref Window() slots. A
+	 *  write whose sequence is a full window or more ahead of the next expected
+	 *  one blocks until the gap is filled, so a stalled block holds back the
+	 *  fast workers instead of letting them buffer without bound.
+	 *
+	 * @par Semantics
+	 *  Reads, close and error behave as in @ref MessageFIFO. Differences:
+	 *  - only sequenced writes are accepted; plain Write() calls return false;
+	 *  - a sequence already written or already passed is rejected;
+	 *  - blocks parked behind a gap when the buffer is closed are never readable.
+	 *
+	 * @par Thread safety
+	 *  All public member functions are thread-safe.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC ReorderFIFO final: public MessageFIFO {
+		public:
+			/**
+			 * @brief Construct an empty ReorderFIFO.
+			 * @param window Number of blocks that may be parked ahead of a gap (0 behaves as 1).
+			 * @param first Sequence number of the first block.
+			 */
+			explicit ReorderFIFO(const std::size_t& window = 1024, const std::uint64_t& first = 0);
+
+			/**
+			 * @brief Copy constructor deleted.
+			 */
+			ReorderFIFO(const ReorderFIFO&)							= delete;
+
+			/**
+			 * @brief Move constructor deleted.
+			 */
+			ReorderFIFO(ReorderFIFO&&)								= delete;
+
+			/**
+			 * @brief Destructor.
+			 */
+			~ReorderFIFO() noexcept override						= default;
+
+			/**
+			 * @brief Copy assignment deleted.
+			 */
+			ReorderFIFO& operator=(const ReorderFIFO&)				= delete;
+
+			/**
+			 * @brief Move assignment deleted.
+			 */
+			ReorderFIFO& operator=(ReorderFIFO&&)					= delete;
+
+			/**
+			 * @brief Sequence number of the next block to become readable.
+			 * @return First sequence not written yet in order.
+			 */
+			std::uint64_t 											NextSequence() const noexcept;
+
+			/**
+			 * @brief Number of blocks parked behind a gap.
+			 * @return Blocks written early and not readable yet.
+			 */
+			std::size_t 											Parked() const noexcept;
+
+			/**
+			 * @brief Size of the reorder window.
+			 * @return Maximum number of parked blocks.
+			 */
+			inline std::size_t 										Window() const noexcept {
+				return m_slots.size();
+			}
+
+			/**
+			 * @brief Write block @p sequence, blocking while it is beyond the window.
+			 * @param sequence Position of the block in the stream.
+			 * @param data Bytes of the block, moved in.
+			 * @return false if closed, errored, or @p sequence was already written or passed.
+			 */
+			bool 													WriteSequence(const std::uint64_t& sequence, DataType&& data) noexcept override;
+
+		private:
+			std::vector<DataType> m_slots;							///< Parked blocks, by sequence modulo window.
+			std::vector<bool> m_filled;								///< Whether each slot holds a block.
+			std::atomic<std::uint64_t> m_next;						///< Next sequence to append; written under @c m_mutex.
+			std::atomic<std::size_t> m_parked {0};					///< Parked blocks; written under @c m_mutex.
+
+			/**
+			 * @brief Plain writes are rejected.
+			 * @return false.
+			 */
+			bool 													WriteInternal(const std::size_t& count, const DataType& src) noexcept override;
+
+			/**
+			 * @brief Plain writes are rejected.
+			 * @return false.
+			 */
+			bool 													WriteInternal(const std::size_t& count, DataType&& src) noexcept override;
+
+			/**
+			 * @brief Plain writes are rejected, leaving @p src untouched.
+			 * @return false.
+			 */
+			bool 													WriteInternal(const std::size_t& count, const ReadOnly& src) noexcept override;
+
+			/**
+			 * @brief Plain writes are rejected, leaving @p src untouched.
+			 * @return false.
+			 */
+			bool 													WriteInternal(const std::size_t& count, ReadOnly&& src) noexcept override;
+	};
+}
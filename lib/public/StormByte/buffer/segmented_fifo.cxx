@@ -0,0 +1,280 @@
+#include <StormByte/buffer/segmented_fifo.hxx>
+
+#include <algorithm>
+#include <sstream>
+
+using namespace StormByte::Buffer;
+
+SegmentedFIFO::SegmentedFIFO() noexcept: SharedFIFO(), m_head(new Segment), m_cursor(m_head), m_tail(m_head) {}
+
+SegmentedFIFO::~SegmentedFIFO() noexcept {
+	while (m_head) {
+		Segment* next = m_head->next.load(std::memory_order_relaxed);
+		delete m_head;
+		m_head = next;
+	}
+}
+
+std::size_t SegmentedFIFO::AvailableBytes() const noexcept {
+	// Read position first: it never passes the end loaded afterwards
+	const std::size_t read = m_read.load(std::memory_order_acquire);
+	return m_end.load(std::memory_order_acquire) - read;
+}
+
+void SegmentedFIFO::Clean() noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	Release();
+}
+
+void SegmentedFIFO::Clear() noexcept {
+	{
+		std::scoped_lock<std::mutex, std::mutex> lock(m_mutex, m_tail_mutex);
+		// Keep the tail segment as the new, empty head
+		while (m_head != m_tail) {
+			Segment* next = m_head->next.load(std::memory_order_relaxed);
+			delete m_head;
+			m_head = next;
+		}
+		DataType().swap(m_tail->data);
+		m_head_skip = 0;
+		m_cursor = m_tail;
+		m_cursor_offset = 0;
+		const std::size_t end = m_end.load(std::memory_order_relaxed);
+		m_begin.store(end, std::memory_order_release);
+		m_read.store(end, std::memory_order_release);
+	}
+	m_cv.notify_all();
+	Signal();
+}
+
+void SegmentedFIFO::Close() noexcept {
+	{
+		std::scoped_lock<std::mutex, std::mutex> lock(m_mutex, m_tail_mutex);
+		m_closed.store(true, std::memory_order_release);
+	}
+	m_cv.notify_all();
+	Signal();
+}
+
+bool SegmentedFIFO::Drop(const std::size_t& count) noexcept {
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		if (count != 0 && count > AvailableBytes())
+			WaitReadable(count, lock);
+
+		const std::size_t avail = AvailableBytes();
+		if (avail == 0 || count > avail)
+			return false;
+		MoveCursor(m_read.load(std::memory_order_relaxed) + count);
+		Release();
+	}
+	m_cv.notify_all();
+	return true;
+}
+
+bool SegmentedFIFO::Empty() const noexcept {
+	return Size() == 0;
+}
+
+bool SegmentedFIFO::EoF() const noexcept {
+	if (m_error.load(std::memory_order_acquire))
+		return true;
+	return m_closed.load(std::memory_order_acquire) && AvailableBytes() == 0;
+}
+
+std::string SegmentedFIFO::HexDump(const std::size_t& collumns, const std::size_t& byte_limit) const noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	const std::size_t begin = m_begin.load(std::memory_order_relaxed);
+	const std::size_t read = m_read.load(std::memory_order_relaxed);
+	const std::size_t avail = AvailableBytes();
+	const std::size_t count = byte_limit > 0 ? std::min(avail, byte_limit) : avail;
+
+	std::ostringstream oss;
+	oss << "Size: " << m_end.load(std::memory_order_relaxed) - begin << " bytes\n";
+	oss << "Read Position: " << read - begin << '\n';
+	oss << "Status: " << (m_closed ? "closed" : "opened") << " and " << (m_error ? "error" : "ready");
+	oss << '\n';
+
+	if (count > 0) {
+		DataType data;
+		CopyOut(count, data, false);
+		std::span<const std::byte> view(data.data(), data.size());
+		oss << FormatHexLines(view, read - begin, collumns == 0 ? 16 : collumns);
+	}
+	return oss.str();
+}
+
+void SegmentedFIFO::Seek(const std::ptrdiff_t& offset, const Position& mode) const noexcept {
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		const std::ptrdiff_t begin = static_cast<std::ptrdiff_t>(m_begin.load(std::memory_order_relaxed));
+		const std::ptrdiff_t end = static_cast<std::ptrdiff_t>(m_end.load(std::memory_order_acquire));
+		const std::ptrdiff_t base = mode == Position::Absolute ? begin : static_cast<std::ptrdiff_t>(m_read.load(std::memory_order_relaxed));
+		MoveCursor(static_cast<std::size_t>(std::clamp(base + offset, begin, end)));
+	}
+	m_cv.notify_all();
+	Signal();
+}
+
+void SegmentedFIFO::SetError() noexcept {
+	{
+		std::scoped_lock<std::mutex, std::mutex> lock(m_mutex, m_tail_mutex);
+		m_error.store(true, std::memory_order_release);
+	}
+	m_cv.notify_all();
+	Signal();
+}
+
+std::size_t SegmentedFIFO::Size() const noexcept {
+	const std::size_t begin = m_begin.load(std::memory_order_acquire);
+	return m_end.load(std::memory_order_acquire) - begin;
+}
+
+bool SegmentedFIFO::Append(DataType&& data) noexcept {
+	if (data.empty())
+		return IsWritable();
+
+	const std::size_t size = data.size();
+	Segment* segment = new Segment;
+	segment->data = std::move(data);
+	{
+		std::scoped_lock<std::mutex> lock(m_tail_mutex);
+		if (m_closed || m_error) {
+			delete segment;
+			return false;
+		}
+		m_tail->next.store(segment, std::memory_order_release);
+		m_tail = segment;
+		m_end.fetch_add(size, std::memory_order_seq_cst);
+	}
+	// A reader registers in m_waiters before checking m_end under the head
+	// lock, so either it sees the new end or we see it waiting. Taking the
+	// head lock then guarantees it is already blocked on m_cv.
+	if (m_waiters.load(std::memory_order_seq_cst) > 0) {
+		{ std::scoped_lock<std::mutex> lock(m_mutex); }
+		m_cv.notify_all();
+	}
+	Signal();
+	return true;
+}
+
+void SegmentedFIFO::CopyOut(const std::size_t& count, DataType& out, const bool& advance) const noexcept {
+	Segment* segment = m_cursor;
+	std::size_t offset = m_cursor_offset;
+	std::size_t remaining = count;
+
+	out.reserve(out.size() + count);
+	while (remaining > 0) {
+		if (offset == segment->data.size()) {
+			segment = segment->next.load(std::memory_order_acquire);
+			offset = 0;
+			continue;
+		}
+		const std::size_t take = std::min(remaining, segment->data.size() - offset);
+		const auto start = segment->data.begin() + static_cast<std::ptrdiff_t>(offset);
+		out.insert(out.end(), start, start + static_cast<std::ptrdiff_t>(take));
+		offset += take;
+		remaining -= take;
+	}
+
+	if (advance) {
+		m_cursor = segment;
+		m_cursor_offset = offset;
+		m_read.store(m_read.load(std::memory_order_relaxed) + count, std::memory_order_release);
+	}
+}
+
+void SegmentedFIFO::MoveCursor(const std::size_t& position) const noexcept {
+	const std::size_t read = m_read.load(std::memory_order_relaxed);
+	Segment* segment;
+	std::size_t offset;
+	if (position >= read) {
+		segment = m_cursor;
+		offset = m_cursor_offset + (position - read);
+	}
+	else {
+		segment = m_head;
+		offset = m_head_skip + (position - m_begin.load(std::memory_order_relaxed));
+	}
+	while (offset > segment->data.size()) {
+		offset -= segment->data.size();
+		segment = segment->next.load(std::memory_order_acquire);
+	}
+	m_cursor = segment;
+	m_cursor_offset = offset;
+	m_read.store(position, std::memory_order_release);
+}
+
+bool SegmentedFIFO::ReadInternal(const std::size_t& count, DataType& outBuffer, const Operation& flag) noexcept {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	std::size_t avail = AvailableBytes();
+	if (m_error || (m_closed && avail == 0))
+		return false;
+
+	const std::size_t real_count = count == 0 ? avail : count;
+	if (real_count > avail && !m_closed) {
+		WaitReadable(real_count, lock);
+		avail = AvailableBytes();
+	}
+	if (m_error || (avail == 0 && count == 0) || real_count > avail)
+		return false;
+
+	// Producers only need the tail lock, so they keep appending during the copy
+	CopyOut(real_count, outBuffer, flag != Operation::Peek);
+	if (flag == Operation::Extract)
+		Release();
+	return true;
+}
+
+bool SegmentedFIFO::ReadInternal(const std::size_t& count, WriteOnly& outBuffer, const Operation& flag) noexcept {
+	DataType data;
+	if (!ReadInternal(count, data, flag))
+		return false;
+	return outBuffer.Write(0, std::move(data));
+}
+
+void SegmentedFIFO::Release() noexcept {
+	// Every segment before the cursor has a successor, so it is never the tail
+	while (m_head != m_cursor) {
+		Segment* next = m_head->next.load(std::memory_order_acquire);
+		delete m_head;
+		m_head = next;
+	}
+	m_head_skip = m_cursor_offset;
+	if (m_cursor_offset > 0 && m_cursor_offset == m_cursor->data.size()) {
+		// Fully read segment that may still be the tail: keep the node, free its bytes
+		DataType().swap(m_cursor->data);
+		m_head_skip = 0;
+		m_cursor_offset = 0;
+	}
+	m_begin.store(m_read.load(std::memory_order_relaxed), std::memory_order_release);
+}
+
+void SegmentedFIFO::WaitReadable(const std::size_t& n, std::unique_lock<std::mutex>& lock) const {
+	if (n == 0) return;
+	m_waiters.fetch_add(1, std::memory_order_seq_cst);
+	m_cv.wait(lock, [&] {
+		if (m_closed || m_error) return true;
+		const std::size_t read = m_read.load(std::memory_order_relaxed);
+		return m_end.load(std::memory_order_seq_cst) - read >= n;
+	});
+	m_waiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool SegmentedFIFO::WriteInternal(const std::size_t& count, const DataType& src) noexcept {
+	if (count > 0 && src.size() < count)
+		return false;
+	if (!IsWritable())
+		return false;
+	const std::size_t real_count = (count == 0) ? src.size() : count;
+	// Copy before taking any lock
+	return Append(DataType(src.begin(), src.begin() + static_cast<std::ptrdiff_t>(real_count)));
+}
+
+bool SegmentedFIFO::WriteInternal(const std::size_t& count, DataType&& src) noexcept {
+	if (count > 0 && src.size() < count)
+		return false;
+	if (count != 0 && count < src.size())
+		return Append(DataType(std::make_move_iterator(src.begin()), std::make_move_iterator(src.begin() + static_cast<std::ptrdiff_t>(count))));
+	return Append(std::move(src));
+}
\ No newline at end of file
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <StormByte/buffer/shared_fifo.hxx>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class SegmentedFIFO
+	 * @brief SharedFIFO with separate head and tail locks.
+	 *
+	 * @par Overview
+	 *  A regular @ref SharedFIFO serializes appends and reads on one mutex, so a
+	 *  consumer copying out a large read stalls every producer. SegmentedFIFO
+	 *  stores each write as its own segment in a singly linked list and guards
+	 *  the two ends independently:
+	 *  - the **tail lock** only covers linking a new segment, so the bytes of a
+	 *    write are copied (or moved) into their segment before any lock is taken;
+	 *  - the **head lock** (the inherited @c m_mutex) covers the read position and
+	 *    segment release, so reads copy out of published segments while producers
+	 *    keep appending.
+	 *  A segment is published to readers by advancing an atomic stream end after
+	 *  it has been linked, and the last linked segment is never released, so the
+	 *  two sides never touch the same node concurrently.
+	 *
+	 * @par Semantics
+	 *  Blocking, close and error behave as in @ref SharedFIFO and the object is
+	 *  used the same way, typically through @c Producer(std::make_shared<SegmentedFIFO>()).
+	 *  Positions are relative to the oldest retained byte, as in a @ref FIFO after
+	 *  @ref Clean(). Differences:
+	 *  - @ref Extract() releases every byte up to the new read position, including
+	 *    bytes previously passed by @ref Read();
+	 *  - @ref Data() is not available (segments are not contiguous) and returns an
+	 *    empty buffer; use @ref Peek() instead.
+	 *
+	 * @par Thread safety
+	 *  All public member functions are thread-safe. Status queries only load atomics.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC SegmentedFIFO final: public SharedFIFO {
+		public:
+			/**
+			 * @brief Construct an empty SegmentedFIFO.
+			 */
+			SegmentedFIFO() noexcept;
+
+			/**
+			 * @brief Copy constructor deleted.
+			 */
+			SegmentedFIFO(const SegmentedFIFO&)						= delete;
+
+			/**
+			 * @brief Move constructor deleted.
+			 */
+			SegmentedFIFO(SegmentedFIFO&&)							= delete;
+
+			/**
+			 * @brief Destructor; frees every segment.
+			 */
+			~SegmentedFIFO() noexcept override;
+
+			/**
+			 * @brief Copy assignment deleted.
+			 */
+			SegmentedFIFO& operator=(const SegmentedFIFO&)			= delete;
+
+			/**
+			 * @brief Move assignment deleted.
+			 */
+			SegmentedFIFO& operator=(SegmentedFIFO&&)				= delete;
+
+			/**
+			 * @brief Get the number of bytes available for reading.
+			 * @return Bytes between the read position and the end of the stream.
+			 */
+			std::size_t 											AvailableBytes() const noexcept override;
+
+			/**
+			 * @brief Release every byte before the read position.
+			 */
+			void 													Clean() noexcept override;
+
+			/**
+			 * @brief Release all bytes and reset the read position. Takes both locks.
+			 */
+			void 													Clear() noexcept override;
+
+			/**
+			 * @brief Close for further writes. Takes both locks so no write lands after it returns.
+			 */
+			void 													Close() noexcept override;
+
+			/**
+			 * @brief Contiguous data is not available for a segmented buffer.
+			 * @return An empty buffer.
+			 */
+			inline const DataType& 									Data() const noexcept override {
+				return m_buffer;
+			}
+
+			/**
+			 * @brief Skip and release @p count bytes, blocking like @ref Read().
+			 * @param count Number of bytes to drop.
+			 * @return false if not enough bytes became available, true otherwise.
+			 */
+			bool 													Drop(const std::size_t& count) noexcept override;
+
+			/**
+			 * @brief Check whether no bytes are retained.
+			 * @return true if the buffer holds no bytes.
+			 */
+			bool 													Empty() const noexcept override;
+
+			/**
+			 * @brief Check for end of stream.
+			 * @return true if errored, or closed with no bytes left to read.
+			 */
+			bool 													EoF() const noexcept override;
+
+			/**
+			 * @brief Hex dump from the read position.
+			 * @param collumns Bytes per line (0 selects 16).
+			 * @param byte_limit Maximum bytes to dump (0 for all available).
+			 * @return Formatted dump.
+			 */
+			std::string 											HexDump(const std::size_t& collumns = 0, const std::size_t& byte_limit = 0) const noexcept override;
+
+			/**
+			 * @brief Move the read position within the retained bytes.
+			 * @param offset Offset to apply.
+			 * @param mode Absolute (from the oldest retained byte) or relative.
+			 */
+			void 													Seek(const std::ptrdiff_t& offset, const Position& mode) const noexcept override;
+
+			/**
+			 * @brief Mark the buffer as errored. Takes both locks so no write lands after it returns.
+			 */
+			void 													SetError() noexcept override;
+
+			/**
+			 * @brief Get the number of retained bytes.
+			 * @return Bytes written and not yet released.
+			 */
+			std::size_t 											Size() const noexcept override;
+
+		private:
+			/**
+			 * @brief One write worth of bytes.
+			 * @details @c data is immutable once the segment is linked.
+			 */
+			struct Segment {
+				DataType data;										///< Segment bytes.
+				std::atomic<Segment*> next {nullptr};				///< Next segment, set under the tail lock.
+			};
+
+			Segment* m_head;										///< Oldest retained segment (head lock).
+			std::size_t m_head_skip {0};							///< Bytes of @c m_head already released (head lock).
+			mutable Segment* m_cursor;								///< Segment holding the read position (head lock).
+			mutable std::size_t m_cursor_offset {0};				///< Read offset inside @c m_cursor (head lock).
+			std::atomic<std::size_t> m_begin {0};					///< Absolute offset of the oldest retained byte.
+			mutable std::atomic<std::size_t> m_read {0};			///< Absolute read position.
+			mutable std::atomic<std::size_t> m_waiters {0};			///< Readers blocked in @ref WaitReadable().
+
+			mutable std::mutex m_tail_mutex;						///< Tail lock.
+			Segment* m_tail;										///< Last linked segment (tail lock).
+			std::atomic<std::size_t> m_end {0};						///< Absolute end of the stream.
+
+			/**
+			 * @brief Link a segment at the tail and wake readers.
+			 * @param data Segment bytes; empty writes succeed without linking.
+			 * @return false if closed or errored, true otherwise.
+			 */
+			bool 													Append(DataType&& data) noexcept;
+
+			/**
+			 * @brief Copy bytes starting at the read position. Requires the head lock.
+			 * @param count Number of bytes to copy; must be available.
+			 * @param out Vector the bytes are appended to.
+			 * @param advance Whether to move the read position past the copied bytes.
+			 */
+			void 													CopyOut(const std::size_t& count, DataType& out, const bool& advance) const noexcept;
+
+			/**
+			 * @brief Move the read position to an absolute offset. Requires the head lock.
+			 * @param position Absolute offset within the retained bytes.
+			 */
+			void 													MoveCursor(const std::size_t& position) const noexcept;
+
+			/**
+			 * @brief Blocking read from the read position.
+			 * @param count Number of bytes to read (0 for all available).
+			 * @param outBuffer Vector the bytes are appended to.
+			 * @param flag Read, Peek or Extract.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													ReadInternal(const std::size_t& count, DataType& outBuffer, const Operation& flag) noexcept override;
+
+			/**
+			 * @brief Blocking read from the read position into a WriteOnly buffer.
+			 * @param count Number of bytes to read (0 for all available).
+			 * @param outBuffer Destination buffer.
+			 * @param flag Read, Peek or Extract.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													ReadInternal(const std::size_t& count, WriteOnly& outBuffer, const Operation& flag) noexcept override;
+
+			/**
+			 * @brief Release every byte before the read position. Requires the head lock.
+			 */
+			void 													Release() noexcept;
+
+			/**
+			 * @brief Wait until @p n bytes are readable, or closed/errored. Requires the head lock.
+			 * @param n Number of bytes required.
+			 * @param lock Held head lock.
+			 */
+			void 													WaitReadable(const std::size_t& n, std::unique_lock<std::mutex>& lock) const;
+
+			/**
+			 * @brief Append a copy of @p count bytes of @p src (0 for all).
+			 * @return bool indicating success or failure.
+			 */
+			bool 													WriteInternal(const std::size_t& count, const DataType& src) noexcept override;
+
+			/**
+			 * @brief Append @p src, moving it when the whole vector is written.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													WriteInternal(const std::size_t& count, DataType&& src) noexcept override;
+	};
+}
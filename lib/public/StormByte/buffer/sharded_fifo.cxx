@@ -0,0 +1,298 @@
+#include <StormByte/buffer/sharded_fifo.hxx>
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+using namespace StormByte::Buffer;
+
+namespace {
+	constexpr std::size_t None = static_cast<std::size_t>(-1);
+
+	std::size_t ShardCount(const std::size_t& shards) noexcept {
+		if (shards > 0)
+			return shards;
+		return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+	}
+
+	std::atomic<std::uint64_t> g_next_fifo {0};
+	std::atomic<std::uint64_t> g_next_writer {0};
+
+	// Unlike std::thread::id, never reused by a later thread
+	std::uint64_t WriterId() noexcept {
+		thread_local const std::uint64_t id = ++g_next_writer;
+		return id;
+	}
+}
+
+ShardedFIFO::ShardedFIFO(const std::size_t& shards, const ShardOrder& order) noexcept:
+SharedFIFO(), m_shards(new Shard[ShardCount(shards)]), m_shard_count(ShardCount(shards)), m_order(order),
+m_id(++g_next_fifo), m_collected(m_shard_count), m_current(None) {}
+
+ShardedFIFO::~ShardedFIFO() noexcept = default;
+
+std::size_t ShardedFIFO::AvailableBytes() const noexcept {
+	// Consumed first: it never passes the written total loaded afterwards
+	const std::size_t consumed = m_consumed.load(std::memory_order_acquire);
+	std::size_t written = 0;
+	for (std::size_t i = 0; i < m_shard_count; ++i)
+		written += m_shards[i].written.load(std::memory_order_seq_cst);
+	return written - consumed;
+}
+
+void ShardedFIFO::Clean() noexcept {}
+
+void ShardedFIFO::Clear() noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	Take(AvailableBytes(), nullptr, true);
+}
+
+void ShardedFIFO::Close() noexcept {
+	Shutdown();
+	m_closed.store(true, std::memory_order_seq_cst);
+	{ std::scoped_lock<std::mutex> lock(m_mutex); }
+	m_cv.notify_all();
+	Signal();
+}
+
+bool ShardedFIFO::Drop(const std::size_t& count) noexcept {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	if (count != 0 && count > AvailableBytes())
+		WaitReadable(count, lock);
+
+	const std::size_t avail = AvailableBytes();
+	if (m_error || avail == 0 || count > avail)
+		return false;
+	Take(count, nullptr, true);
+	return true;
+}
+
+bool ShardedFIFO::Empty() const noexcept {
+	return AvailableBytes() == 0;
+}
+
+bool ShardedFIFO::EoF() const noexcept {
+	if (m_error.load(std::memory_order_acquire))
+		return true;
+	return m_closed.load(std::memory_order_acquire) && AvailableBytes() == 0;
+}
+
+std::string ShardedFIFO::HexDump(const std::size_t& collumns, const std::size_t& byte_limit) const noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	const std::size_t avail = AvailableBytes();
+	const std::size_t count = byte_limit > 0 ? std::min(avail, byte_limit) : avail;
+	const std::size_t position = m_consumed.load(std::memory_order_relaxed);
+
+	std::ostringstream oss;
+	oss << "Size: " << avail << " bytes\n";
+	oss << "Read Position: " << position << '\n';
+	oss << "Status: " << (m_closed ? "closed" : "opened") << " and " << (m_error ? "error" : "ready");
+	oss << '\n';
+
+	if (count > 0) {
+		DataType data;
+		Take(count, &data, false);
+		std::span<const std::byte> view(data.data(), data.size());
+		oss << FormatHexLines(view, position, collumns == 0 ? 16 : collumns);
+	}
+	return oss.str();
+}
+
+void ShardedFIFO::Seek(const std::ptrdiff_t& offset, const Position&) const noexcept {
+	if (offset <= 0)
+		return;
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	Take(std::min(static_cast<std::size_t>(offset), AvailableBytes()), nullptr, true);
+}
+
+void ShardedFIFO::SetError() noexcept {
+	m_error.store(true, std::memory_order_seq_cst);
+	Shutdown();
+	{ std::scoped_lock<std::mutex> lock(m_mutex); }
+	m_cv.notify_all();
+	Signal();
+}
+
+std::size_t ShardedFIFO::Size() const noexcept {
+	return AvailableBytes();
+}
+
+void ShardedFIFO::Collect() const noexcept {
+	for (std::size_t i = 0; i < m_shard_count; ++i) {
+		Shard& shard = m_shards[i];
+		std::deque<Chunk> pending;
+		{
+			std::scoped_lock<std::mutex> lock(shard.mutex);
+			pending.swap(shard.chunks);
+		}
+		for (Chunk& chunk: pending) {
+			m_collected_bytes += chunk.data.size();
+			m_collected[i].push_back(std::move(chunk));
+		}
+	}
+}
+
+std::size_t ShardedFIFO::Pick(const std::vector<std::size_t>& taken, const std::size_t& next) const noexcept {
+	std::size_t picked = None;
+	for (std::size_t k = 0; k < m_shard_count; ++k) {
+		const std::size_t i = (next + k) % m_shard_count;
+		if (taken[i] >= m_collected[i].size())
+			continue;
+		if (m_order == ShardOrder::RoundRobin)
+			return i;
+		if (picked == None || m_collected[i][taken[i]].stamp < m_collected[picked][taken[picked]].stamp)
+			picked = i;
+	}
+	return picked;
+}
+
+bool ShardedFIFO::Push(DataType&& data) noexcept {
+	if (data.empty())
+		return IsWritable();
+
+	const std::size_t slot = Slot();
+	if (slot == m_shard_count)
+		return false;
+
+	const std::size_t size = data.size();
+	Shard& shard = m_shards[slot];
+	{
+		std::scoped_lock<std::mutex> lock(shard.mutex);
+		if (shard.closed)
+			return false;
+		shard.chunks.push_back({ std::move(data), std::chrono::steady_clock::now() });
+		shard.written.fetch_add(size, std::memory_order_seq_cst);
+	}
+	// A reader registers in m_waiters before summing the shards under the
+	// reader lock, so either it sees this write or we see it waiting. Taking
+	// the reader lock then guarantees it is already blocked on m_cv.
+	if (m_waiters.load(std::memory_order_seq_cst) > 0) {
+		{ std::scoped_lock<std::mutex> lock(m_mutex); }
+		m_cv.notify_all();
+	}
+	Signal();
+	return true;
+}
+
+bool ShardedFIFO::ReadInternal(const std::size_t& count, DataType& outBuffer, const Operation& flag) noexcept {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	std::size_t avail = AvailableBytes();
+	if (m_error || (m_closed && avail == 0))
+		return false;
+
+	const std::size_t real_count = count == 0 ? avail : count;
+	if (real_count > avail && !m_closed) {
+		WaitReadable(real_count, lock);
+		avail = AvailableBytes();
+	}
+	if (m_error || (avail == 0 && count == 0) || real_count > avail)
+		return false;
+
+	Take(real_count, &outBuffer, flag != Operation::Peek);
+	return true;
+}
+
+bool ShardedFIFO::ReadInternal(const std::size_t& count, WriteOnly& outBuffer, const Operation& flag) noexcept {
+	DataType data;
+	if (!ReadInternal(count, data, flag))
+		return false;
+	return outBuffer.Write(0, std::move(data));
+}
+
+void ShardedFIFO::Shutdown() noexcept {
+	for (std::size_t i = 0; i < m_shard_count; ++i) {
+		std::scoped_lock<std::mutex> lock(m_shards[i].mutex);
+		m_shards[i].closed = true;
+	}
+}
+
+std::size_t ShardedFIFO::Slot() noexcept {
+	// Last FIFO written by this thread; ids are never reused, so a stale entry cannot match
+	struct Cache {
+		std::uint64_t fifo {0};
+		std::size_t slot {0};
+	};
+	thread_local Cache cache;
+	if (cache.fifo == m_id)
+		return cache.slot;
+
+	std::scoped_lock<std::mutex> lock(m_slots_mutex);
+	try {
+		const auto it = m_slots.try_emplace(WriterId(), m_slots.size() % m_shard_count).first;
+		cache = { m_id, it->second };
+		return it->second;
+	}
+	catch (...) {
+		return m_shard_count;
+	}
+}
+
+void ShardedFIFO::Take(const std::size_t& count, DataType* out, const bool& consume) const noexcept {
+	if (count > m_collected_bytes)
+		Collect();
+
+	std::vector<std::size_t> taken(m_shard_count, 0);
+	std::size_t current = m_current;
+	std::size_t offset = m_offset;
+	std::size_t next = m_next;
+	std::size_t remaining = count;
+
+	if (out && (!out->empty() || offset != 0))
+		out->reserve(out->size() + count);
+	while (remaining > 0) {
+		if (current == None)
+			current = Pick(taken, next);
+		Chunk& chunk = m_collected[current][taken[current]];
+		const std::size_t size = chunk.data.size();
+		const std::size_t take = std::min(remaining, size - offset);
+		if (out) {
+			if (consume && offset == 0 && take == size && out->empty())
+				*out = std::move(chunk.data);
+			else
+				out->insert(out->end(), chunk.data.begin() + static_cast<std::ptrdiff_t>(offset), chunk.data.begin() + static_cast<std::ptrdiff_t>(offset + take));
+		}
+		offset += take;
+		remaining -= take;
+		if (offset == size) {
+			++taken[current];
+			next = (current + 1) % m_shard_count;
+			current = None;
+			offset = 0;
+		}
+	}
+
+	if (consume) {
+		for (std::size_t i = 0; i < m_shard_count; ++i)
+			m_collected[i].erase(m_collected[i].begin(), m_collected[i].begin() + static_cast<std::ptrdiff_t>(taken[i]));
+		m_collected_bytes -= count;
+		m_current = current;
+		m_offset = offset;
+		m_next = next;
+		m_consumed.fetch_add(count, std::memory_order_release);
+	}
+}
+
+void ShardedFIFO::WaitReadable(const std::size_t& n, std::unique_lock<std::mutex>& lock) const {
+	m_waiters.fetch_add(1, std::memory_order_seq_cst);
+	m_cv.wait(lock, [&] {
+		return m_closed || m_error || AvailableBytes() >= n;
+	});
+	m_waiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool ShardedFIFO::WriteInternal(const std::size_t& count, const DataType& src) noexcept {
+	if (count > 0 && src.size() < count)
+		return false;
+	if (!IsWritable())
+		return false;
+	const std::size_t real_count = (count == 0) ? src.size() : count;
+	return Push(DataType(src.begin(), src.begin() + static_cast<std::ptrdiff_t>(real_count)));
+}
+
+bool ShardedFIFO::WriteInternal(const std::size_t& count, DataType&& src) noexcept {
+	if (count > 0 && src.size() < count)
+		return false;
+	if (count != 0 && count < src.size())
+		return Push(DataType(std::make_move_iterator(src.begin()), std::make_move_iterator(src.begin() + static_cast<std::ptrdiff_t>(count))));
+	return Push(std::move(src));
+}
\ No newline at end of file
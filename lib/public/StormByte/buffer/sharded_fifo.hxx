@@ -0,0 +1,287 @@
+#pragma once
+
+#include <StormByte/buffer/shared_fifo.hxx>
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class ShardedFIFO
+	 * @brief SharedFIFO split in per-writer-thread shards for high fan-in.
+	 *
+	 * @par Overview
+	 *  Every writer thread is bound to one of @c shards independent queues, each
+	 *  with its own lock and cache line, so writers on different shards never
+	 *  contend. Threads are assigned shards round-robin on their first write to
+	 *  this FIFO; with at least as many shards as writer threads no two writers
+	 *  share one.
+	 *  Each write is stored as one chunk and is never split or interleaved.
+	 *
+	 * @par Reading
+	 *  The reader merges the shards into one byte stream, draining them in the
+	 *  configured @ref ShardOrder. Shards are only locked to take their pending
+	 *  chunks in one batch when the reader runs out of collected bytes. Use it
+	 *  like any other SharedFIFO through a Producer and its Consumer, which can
+	 *  be passed to Pipeline::Process() as the input of the first stage.
+	 *  This buffer is a queue: @ref Read() and @ref Extract() both consume
+	 *  bytes, @ref Peek() does not, and @ref Seek() can only skip forward.
+	 *
+	 * @par Ordering
+	 *  Bytes of one writer thread are always read in the order written.
+	 *  @ref ShardOrder::Timestamp orders writes of different threads by the time
+	 *  they were made, among the writes already published when they are read.
+	 *
+	 * @par Usage
+	 * @code{.cpp}
+	 * Producer producer(std::make_shared<ShardedFIFO>(8, ShardOrder::Timestamp));
+	 * // Copies of producer written from 8 threads never share a lock
+	 * Consumer result = pipeline.Process(producer.Consumer(), ExecutionMode::Async, log);
+	 * @endcode
+	 *
+	 * @par Thread safety
+	 *  All public member functions are thread-safe. Readers serialize on the
+	 *  inherited mutex; status queries only load atomics.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC ShardedFIFO final: public SharedFIFO {
+		public:
+			/**
+			 * @brief Construct a ShardedFIFO.
+			 * @param shards Number of shards; 0 selects one per hardware thread.
+			 * @param order Order in which the reader drains the shards.
+			 */
+			ShardedFIFO(const std::size_t& shards = 0, const ShardOrder& order = ShardOrder::RoundRobin) noexcept;
+
+			/**
+			 * @brief Copy constructor deleted.
+			 */
+			ShardedFIFO(const ShardedFIFO&)							= delete;
+
+			/**
+			 * @brief Move constructor deleted.
+			 */
+			ShardedFIFO(ShardedFIFO&&)								= delete;
+
+			/**
+			 * @brief Destructor.
+			 */
+			~ShardedFIFO() noexcept override;
+
+			/**
+			 * @brief Copy assignment deleted.
+			 */
+			ShardedFIFO& operator=(const ShardedFIFO&)				= delete;
+
+			/**
+			 * @brief Move assignment deleted.
+			 */
+			ShardedFIFO& operator=(ShardedFIFO&&)					= delete;
+
+			/**
+			 * @brief Get the number of written bytes not yet consumed.
+			 * @return Readable bytes across all shards.
+			 */
+			std::size_t 											AvailableBytes() const noexcept override;
+
+			/**
+			 * @brief No-op: consumed bytes are released immediately.
+			 */
+			void 													Clean() noexcept override;
+
+			/**
+			 * @brief Consume every written byte.
+			 */
+			void 													Clear() noexcept override;
+
+			/**
+			 * @brief Close for further writes.
+			 * @details Every write that returned true is readable before @ref EoF().
+			 */
+			void 													Close() noexcept override;
+
+			/**
+			 * @brief Contiguous data is not available for a sharded buffer.
+			 * @return An empty buffer.
+			 */
+			inline const DataType& 									Data() const noexcept override {
+				return m_buffer;
+			}
+
+			/**
+			 * @brief Skip @p count bytes, blocking like @ref Read().
+			 * @param count Number of bytes to skip.
+			 * @return false if not enough bytes became available, true otherwise.
+			 */
+			bool 													Drop(const std::size_t& count) noexcept override;
+
+			/**
+			 * @brief Check whether no bytes are buffered.
+			 * @return true if nothing is readable.
+			 */
+			bool 													Empty() const noexcept override;
+
+			/**
+			 * @brief Check for end of stream.
+			 * @return true if errored, or closed with no bytes left to read.
+			 */
+			bool 													EoF() const noexcept override;
+
+			/**
+			 * @brief Hex dump of the readable bytes, in read order.
+			 * @param collumns Bytes per line (0 selects 16).
+			 * @param byte_limit Maximum bytes to dump (0 for all available).
+			 * @return Formatted dump.
+			 */
+			std::string 											HexDump(const std::size_t& collumns = 0, const std::size_t& byte_limit = 0) const noexcept override;
+
+			/**
+			 * @brief Order in which shards are drained.
+			 * @return Configured shard order.
+			 */
+			inline const ShardOrder& 								Order() const noexcept {
+				return m_order;
+			}
+
+			/**
+			 * @brief Skip forward; consumed bytes cannot be revisited.
+			 * @param offset Bytes to skip (negative offsets are ignored).
+			 * @param mode Both modes skip from the current read position.
+			 */
+			void 													Seek(const std::ptrdiff_t& offset, const Position& mode) const noexcept override;
+
+			/**
+			 * @brief Mark the buffer as errored and wake every waiter.
+			 */
+			void 													SetError() noexcept override;
+
+			/**
+			 * @brief Number of shards.
+			 * @return Number of independent writer queues.
+			 */
+			inline std::size_t 										Shards() const noexcept {
+				return m_shard_count;
+			}
+
+			/**
+			 * @brief Get the number of buffered bytes.
+			 * @return Same as @ref AvailableBytes().
+			 */
+			std::size_t 											Size() const noexcept override;
+
+		private:
+			/**
+			 * @brief One write, as stored in a shard.
+			 */
+			struct Chunk {
+				DataType data;										///< Written bytes.
+				std::chrono::steady_clock::time_point stamp;		///< Time of the write.
+			};
+
+			/**
+			 * @brief One writer queue, on its own cache line.
+			 */
+			struct alignas(64) Shard {
+				std::mutex mutex;									///< Guards @c chunks and @c closed.
+				std::deque<Chunk> chunks;							///< Written chunks not yet collected.
+				bool closed {false};								///< Set once the FIFO is closed or errored.
+				std::atomic<std::size_t> written {0};				///< Bytes ever written to this shard.
+			};
+
+			std::unique_ptr<Shard[]> m_shards;						///< Writer queues.
+			const std::size_t m_shard_count;						///< Number of shards.
+			const ShardOrder m_order;								///< Drain order.
+			const std::uint64_t m_id;								///< Process-unique id, keys the per-thread cache.
+			std::mutex m_slots_mutex;								///< Guards @c m_slots.
+			std::unordered_map<std::uint64_t, std::size_t> m_slots;	///< Shard of each writer thread, by first write.
+
+			mutable std::vector<std::deque<Chunk>> m_collected;		///< Chunks taken from each shard (reader lock).
+			mutable std::size_t m_collected_bytes {0};				///< Unconsumed bytes in @c m_collected (reader lock).
+			mutable std::size_t m_current;							///< Shard of the partially read chunk, or none (reader lock).
+			mutable std::size_t m_offset {0};						///< Bytes consumed from that chunk (reader lock).
+			mutable std::size_t m_next {0};							///< Next shard in round-robin order (reader lock).
+			mutable std::atomic<std::size_t> m_consumed {0};		///< Bytes consumed.
+			mutable std::atomic<std::size_t> m_waiters {0};			///< Readers waiting for data.
+
+			/**
+			 * @brief Move every shard's pending chunks to the reader side. Requires the reader lock.
+			 */
+			void 													Collect() const noexcept;
+
+			/**
+			 * @brief Shard holding the next chunk to read. Requires the reader lock.
+			 * @param taken Chunks already taken from each collected queue.
+			 * @param next Round-robin starting shard.
+			 * @return Shard index; the caller guarantees one has data.
+			 */
+			std::size_t 											Pick(const std::vector<std::size_t>& taken, const std::size_t& next) const noexcept;
+
+			/**
+			 * @brief Append one write to the calling thread's shard and wake readers.
+			 * @param data Bytes of one write.
+			 * @return false if closed or errored.
+			 */
+			bool 													Push(DataType&& data) noexcept;
+
+			/**
+			 * @brief Blocking read.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													ReadInternal(const std::size_t& count, DataType& outBuffer, const Operation& flag) noexcept override;
+
+			/**
+			 * @brief Blocking read into a WriteOnly buffer.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													ReadInternal(const std::size_t& count, WriteOnly& outBuffer, const Operation& flag) noexcept override;
+
+			/**
+			 * @brief Stop every shard from accepting writes and wake all waiters.
+			 */
+			void 													Shutdown() noexcept;
+
+			/**
+			 * @brief Shard of the calling thread, assigning the next one on its first write.
+			 * @return Shard index, or the number of shards if it could not be registered.
+			 */
+			std::size_t 											Slot() noexcept;
+
+			/**
+			 * @brief Copy or move @p count readable bytes out in drain order. Requires the reader lock.
+			 * @param count Number of bytes; must be readable.
+			 * @param out Vector the bytes are appended to (may be null to skip).
+			 * @param consume Whether to consume the bytes.
+			 */
+			void 													Take(const std::size_t& count, DataType* out, const bool& consume) const noexcept;
+
+			/**
+			 * @brief Wait until @p n bytes are readable, or closed/errored.
+			 * @param n Number of bytes required.
+			 * @param lock Held reader lock.
+			 */
+			void 													WaitReadable(const std::size_t& n, std::unique_lock<std::mutex>& lock) const;
+
+			/**
+			 * @brief Copy @p count bytes of @p src (0 for all) into a new write.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													WriteInternal(const std::size_t& count, const DataType& src) noexcept override;
+
+			/**
+			 * @brief Move @p src into a new write when it is written whole.
+			 * @return bool indicating success or failure.
+			 */
+			bool 													WriteInternal(const std::size_t& count, DataType&& src) noexcept override;
+	};
+}
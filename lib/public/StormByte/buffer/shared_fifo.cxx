@@ -1,6 +1,7 @@
 #include <StormByte/buffer/shared_fifo.hxx>
 #include <StormByte/string.hxx>
 
+#include <algorithm>
 #include <sstream>
 #include <iomanip>
 #include <cctype>
@@ -9,12 +10,106 @@
 
 using namespace StormByte::Buffer;
 
+/**
+ * @brief Counters of a SharedFIFO with statistics enabled.
+ */
+struct SharedFIFO::Meter {
+	std::atomic<std::size_t> bytes_read {0};
+	std::atomic<std::size_t> bytes_written {0};
+	std::atomic<std::size_t> peak_bytes {0};
+	std::atomic<std::int64_t> read_wait {0};			///< Nanoseconds.
+	std::atomic<std::int64_t> write_wait {0};			///< Nanoseconds.
+};
+
+/**
+ * @brief Readiness callback registered on a SharedFIFO.
+ *
+ * Owned by the buffer's subscription map; while being dispatched it keeps
+ * itself alive through @c m_self, so removing it concurrently is safe.
+ */
+class SharedFIFO::Subscription final: public SharedFIFO::Waiter, public std::enable_shared_from_this<Subscription> {
+	friend class SharedFIFO;
+
+	public:
+		enum class Event {
+			Readable,
+			Writable,
+			Closed,
+			Error
+		};
+
+		Subscription(const SharedFIFO& fifo, const Event& event, const std::size_t& bytes, Callback callback,
+			const bool& persistent, std::shared_ptr<Executor> executor) noexcept:
+		m_fifo(fifo), m_event(event), m_bytes(std::max<std::size_t>(bytes, 1)), m_callback(std::move(callback)),
+		m_persistent(persistent && (event == Event::Readable || event == Event::Writable)), m_executor(std::move(executor)) {}
+
+		void Collected() noexcept override {
+			m_self = shared_from_this();
+		}
+
+		bool Ready() const noexcept override {
+			const bool closed = m_fifo.m_closed.load(std::memory_order_acquire);
+			const bool error = m_fifo.m_error.load(std::memory_order_acquire);
+			switch (m_event) {
+				case Event::Readable:
+					return closed || error || m_fifo.AvailableBytes() >= m_bytes;
+				case Event::Writable:
+					return closed || error || m_fifo.Admits(m_bytes);
+				case Event::Closed:
+					return closed;
+				case Event::Error:
+					return error;
+			}
+			return false;
+		}
+
+		void Wake() noexcept override {
+			std::shared_ptr<Subscription> self = std::move(m_self);
+			if (!m_fifo.Rearm(*this))
+				return;
+			// Runs never overlap: a change during a run (even one made by the
+			// callback itself) makes the running invocation go once more
+			if (m_runs.fetch_add(1, std::memory_order_acq_rel) != 0)
+				return;
+			if (m_executor) {
+				try {
+					m_executor->Post([self]() { self->Run(); });
+					return;
+				}
+				catch (...) {
+					// Could not schedule: run in the signalling thread instead
+				}
+			}
+			Run();
+		}
+
+	private:
+		const SharedFIFO& m_fifo;									///< Buffer observed; alive while it signals.
+		const Event m_event;										///< Awaited event.
+		const std::size_t m_bytes;									///< Bytes for Readable/Writable.
+		const Callback m_callback;									///< User callback.
+		const bool m_persistent;									///< Re-armed after firing.
+		const std::shared_ptr<Executor> m_executor;					///< Executor running the callback (null: inline).
+		std::size_t m_id {0};										///< Id in the subscription map.
+		std::shared_ptr<Subscription> m_self;						///< Keeps a collected subscription alive until woken.
+		std::atomic<std::size_t> m_runs {0};						///< Requested runs not yet completed.
+
+		void Run() noexcept {
+			std::size_t runs = 1;
+			do {
+				m_callback();
+				runs = m_runs.fetch_sub(runs, std::memory_order_acq_rel) - runs;
+			} while (runs != 0);
+		}
+};
+
 SharedFIFO& SharedFIFO::operator=(const FIFO& other) {
 	std::unique_lock<std::mutex> lock(m_mutex);
 
 	FIFO::operator=(other);
-	m_closed = false;
-	m_error = false;
+	m_closed.store(false, std::memory_order_release);
+	m_error.store(false, std::memory_order_release);
+	Publish();
 
 	m_cv.notify_all();
 
@@ -25,8 +120,9 @@ SharedFIFO& SharedFIFO::operator=(FIFO&& other) noexcept {
 	std::scoped_lock<std::mutex> lock(m_mutex);
 
 	FIFO::operator=(std::move(other));
-	m_closed = false;
-	m_error = false;
+	m_closed.store(false, std::memory_order_release);
+	m_error.store(false, std::memory_order_release);
+	Publish();
 
 	m_cv.notify_all();
 
@@ -38,30 +134,58 @@ bool SharedFIFO::operator==(const SharedFIFO& other) const noexcept {
 	return static_cast<const FIFO&>(*this) == static_cast<const FIFO&>(other);
 }
 
+void SharedFIFO::AcknowledgeReadable() const noexcept {
+	if (ReadableDescriptor() == -1)
+		return;
+	m_readable_descriptor->Clear();
+	// A change after this check finds the persistent callback armed and sets it again
+	if (!IsWritable() || AvailableBytes() > 0)
+		m_readable_descriptor->Set();
+}
+
+void SharedFIFO::AcknowledgeWritable() const noexcept {
+	if (WritableDescriptor() == -1)
+		return;
+	m_writable_descriptor->Clear();
+	if (!IsWritable() || Admits(1))
+		m_writable_descriptor->Set();
+}
+
 std::size_t SharedFIFO::AvailableBytes() const noexcept {
-	std::scoped_lock<std::mutex> lock(m_mutex);
-	return FIFO::AvailableBytes();
+	std::size_t size, position;
+	Snapshot(size, position);
+	return position <= size ? size - position : 0;
 }
 
 void SharedFIFO::Clean() noexcept {
-	std::scoped_lock<std::mutex> lock(m_mutex);
-	FIFO::Clean();
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		FIFO::Clean();
+		Publish();
+	}
+	if (m_limit > 0)
+		m_cv.notify_all();
+	Signal();
 }
 
 void SharedFIFO::Clear() noexcept {
 	{
 		std::scoped_lock<std::mutex> lock(m_mutex);
 		FIFO::Clear();
+		Publish();
 	}
 	m_cv.notify_all();
+	Signal();
 }
 
 void SharedFIFO::Close() noexcept {
 	{
 		std::scoped_lock<std::mutex> lock(m_mutex);
-		m_closed = true;
+		m_closed.store(true, std::memory_order_release);
 	}
+	Trace(Tracer::Kind::Close);
 	m_cv.notify_all();
+	Signal();
 }
 
 bool SharedFIFO::Drop(const std::size_t& count) noexcept {
@@ -71,25 +195,67 @@ bool SharedFIFO::Drop(const std::size_t& count) noexcept {
 		if (count != 0 && count > FIFO::AvailableBytes())
 			Wait(count, lock);
 
+		const std::size_t avail = FIFO::AvailableBytes();
 		result = FIFO::Drop(count);
+		CountRead(avail - FIFO::AvailableBytes());
+		Publish();
 	}
 	m_cv.notify_all();
+	Signal();
 	return result;
 }
 
 bool SharedFIFO::Empty() const noexcept {
+	return m_size.load(std::memory_order_acquire) == 0;
+}
+
+void SharedFIFO::EnableStatistics() const noexcept {
+	if (m_meter.load(std::memory_order_acquire))
+		return;
 	std::scoped_lock<std::mutex> lock(m_mutex);
-	return FIFO::Empty();
+	if (m_meter_owner)
+		return;
+	try {
+		m_meter_owner = std::make_shared<Meter>();
+	}
+	catch (...) {
+		return;
+	}
+	m_meter_owner->peak_bytes.store(FIFO::AvailableBytes(), std::memory_order_relaxed);
+	m_meter.store(m_meter_owner.get(), std::memory_order_release);
 }
 
-bool SharedFIFO::EoF() const noexcept {
+bool SharedFIFO::EnableTracing(std::shared_ptr<Tracer> tracer, const std::uint32_t& id) const noexcept {
+	if (!tracer)
+		return false;
 	std::scoped_lock<std::mutex> lock(m_mutex);
-	return m_error || (m_closed && FIFO::AvailableBytes() == 0);
+	if (m_tracer_owner)
+		return false;
+	m_tracer_owner = std::move(tracer);
+	m_trace_id = id;
+	m_tracer.store(m_tracer_owner.get(), std::memory_order_release);
+	return true;
+}
+
+bool SharedFIFO::EoF() const noexcept {
+	if (m_error.load(std::memory_order_acquire))
+		return true;
+	// Closed is stored after the last write was published, so once it is
+	// observed the snapshot below already accounts for every written byte.
+	return m_closed.load(std::memory_order_acquire) && AvailableBytes() == 0;
+}
+
+bool SharedFIFO::ExtractMessage(DataType& outBuffer) noexcept {
+	outBuffer.clear();
+	// Virtual Extract so derived FIFOs without boundaries get the same behavior
+	if (!Extract(1, outBuffer))
+		return false;
+	(void)Extract(0, outBuffer);
+	return true;
 }
 
 bool SharedFIFO::HasError() const noexcept {
-	std::scoped_lock<std::mutex> lock(m_mutex);
-	return m_error;
+	return m_error.load(std::memory_order_acquire);
 }
 
 std::string SharedFIFO::HexDump(const std::size_t& collumns, const std::size_t& byte_limit) const noexcept {
@@ -98,23 +264,340 @@ std::string SharedFIFO::HexDump(const std::size_t& collumns, const std::size_t&
 	return FIFO::HexDump(collumns, byte_limit);
 }
 
+std::size_t SharedFIFO::OnClosed(Callback callback, std::shared_ptr<Executor> executor) const noexcept {
+	return Subscribe(std::make_shared<Subscription>(*this, Subscription::Event::Closed, 0, std::move(callback), false, std::move(executor)));
+}
+
+std::size_t SharedFIFO::OnError(Callback callback, std::shared_ptr<Executor> executor) const noexcept {
+	return Subscribe(std::make_shared<Subscription>(*this, Subscription::Event::Error, 0, std::move(callback), false, std::move(executor)));
+}
+
+std::size_t SharedFIFO::OnReadable(const std::size_t& min_bytes, Callback callback, const bool& persistent, std::shared_ptr<Executor> executor) const noexcept {
+	return Subscribe(std::make_shared<Subscription>(*this, Subscription::Event::Readable, min_bytes, std::move(callback), persistent, std::move(executor)));
+}
+
+std::size_t SharedFIFO::OnWritable(const std::size_t& bytes, Callback callback, const bool& persistent, std::shared_ptr<Executor> executor) const noexcept {
+	return Subscribe(std::make_shared<Subscription>(*this, Subscription::Event::Writable, bytes, std::move(callback), persistent, std::move(executor)));
+}
+
+bool SharedFIFO::ReadMessage(DataType& outBuffer) noexcept {
+	outBuffer.clear();
+	if (!Read(1, outBuffer))
+		return false;
+	(void)Read(0, outBuffer);
+	return true;
+}
+
+int SharedFIFO::ReadableDescriptor() const noexcept {
+	std::call_once(m_readable_once, [this]() {
+		auto descriptor = std::make_shared<EventDescriptor>();
+		m_readable_descriptor = descriptor;
+		if (descriptor->Handle() != -1)
+			(void)OnReadable(1, [descriptor]() { descriptor->Set(); }, true);
+	});
+	return m_readable_descriptor->Handle();
+}
+
+bool SharedFIFO::RemoveCallback(const std::size_t& id) const noexcept {
+	std::shared_ptr<Subscription> removed;	// Released after unlocking
+	std::scoped_lock<std::mutex> lock(m_async_mutex);
+	auto it = m_subscriptions.find(id);
+	if (it == m_subscriptions.end())
+		return false;
+	removed = std::move(it->second);
+	m_subscriptions.erase(it);
+	std::erase(m_async_waiters, removed.get());
+	m_async_count.store(m_async_waiters.size(), std::memory_order_relaxed);
+	return true;
+}
+
 void SharedFIFO::SetError() noexcept {
 	{
 		std::scoped_lock<std::mutex> lock(m_mutex);
-		m_error = true;
+		m_error.store(true, std::memory_order_release);
 	}
+	Trace(Tracer::Kind::Error);
 	m_cv.notify_all();
+	Signal();
 }
 
 
 void SharedFIFO::Seek(const std::ptrdiff_t& offset, const Position& mode) const noexcept {
-	std::scoped_lock<std::mutex> lock(m_mutex);
-	FIFO::Seek(offset, mode);
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		FIFO::Seek(offset, mode);
+		Publish();
+	}
+	// Skipping ahead leaves fewer unread bytes against the limit
+	if (m_limit > 0)
+		m_cv.notify_all();
+	Signal();
 }
 
 std::size_t SharedFIFO::Size() const noexcept {
+	return m_size.load(std::memory_order_acquire);
+}
+
+SharedFIFO::Counters SharedFIFO::Statistics() const noexcept {
+	Counters counters;
+	if (const Meter* meter = m_meter.load(std::memory_order_acquire)) {
+		counters.bytes_read = meter->bytes_read.load(std::memory_order_relaxed);
+		counters.bytes_written = meter->bytes_written.load(std::memory_order_relaxed);
+		counters.peak_bytes = meter->peak_bytes.load(std::memory_order_relaxed);
+		counters.read_wait = std::chrono::nanoseconds(meter->read_wait.load(std::memory_order_relaxed));
+		counters.write_wait = std::chrono::nanoseconds(meter->write_wait.load(std::memory_order_relaxed));
+	}
+	return counters;
+}
+
+int SharedFIFO::WritableDescriptor() const noexcept {
+	std::call_once(m_writable_once, [this]() {
+		auto descriptor = std::make_shared<EventDescriptor>();
+		m_writable_descriptor = descriptor;
+		if (descriptor->Handle() != -1)
+			(void)OnWritable(1, [descriptor]() { descriptor->Set(); }, true);
+	});
+	return m_writable_descriptor->Handle();
+}
+
+bool SharedFIFO::WriteLane(const std::size_t&, DataType&& data) noexcept {
+	const std::size_t count = data.size();
+	return Write(count, std::move(data));
+}
+
+bool SharedFIFO::WriteSequence(const std::uint64_t&, DataType&&) noexcept {
+	return false;
+}
+
+bool SharedFIFO::Admits(const std::size_t& n) const noexcept {
+	if (m_limit == 0)
+		return true;
+	const std::size_t unread = AvailableBytes();
+	return unread == 0 || unread + n <= m_limit || unread < m_demand.load(std::memory_order_acquire);
+}
+
+void SharedFIFO::AddDemand(const std::size_t& n) const noexcept {
+	if (m_limit == 0)
+		return;
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		++m_demanding;
+		m_demand.store(std::max(m_demand.load(std::memory_order_relaxed), n), std::memory_order_release);
+	}
+	// Writers held back by the limit may go on
+	m_cv.notify_all();
+	Signal();
+}
+
+bool SharedFIFO::AddWaiter(Waiter* waiter) const noexcept {
+	std::scoped_lock<std::mutex> lock(m_async_mutex);
+	m_async_waiters.push_back(waiter);
+	m_async_count.store(m_async_waiters.size(), std::memory_order_relaxed);
+	// Pairs with the fence in CollectReady(): either the state change that
+	// makes us ready is visible here, or the signaller sees us registered.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (waiter->Ready()) {
+		m_async_waiters.pop_back();
+		m_async_count.store(m_async_waiters.size(), std::memory_order_relaxed);
+		return false;
+	}
+	return true;
+}
+
+void SharedFIFO::CollectReady(std::vector<Waiter*>& ready) const noexcept {
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (m_async_count.load(std::memory_order_relaxed) == 0)
+		return;
+
+	std::scoped_lock<std::mutex> lock(m_async_mutex);
+	auto it = m_async_waiters.begin();
+	while (it != m_async_waiters.end()) {
+		if ((*it)->Ready()) {
+			(*it)->Collected();
+			ready.push_back(*it);
+			it = m_async_waiters.erase(it);
+		}
+		else
+			++it;
+	}
+	m_async_count.store(m_async_waiters.size(), std::memory_order_relaxed);
+}
+
+void SharedFIFO::CountRead(const std::size_t& bytes) const noexcept {
+	if (Meter* meter = m_meter.load(std::memory_order_acquire))
+		meter->bytes_read.fetch_add(bytes, std::memory_order_relaxed);
+	if (bytes > 0) {
+		if (Tracer* tracer = m_tracer.load(std::memory_order_acquire))
+			tracer->Record(Tracer::Kind::Read, m_trace_id, bytes);
+	}
+}
+
+void SharedFIFO::CountWait(const std::chrono::steady_clock::time_point& start, const bool& write) const noexcept {
+	// Enabled during the wait: its start is unknown
+	if (start == std::chrono::steady_clock::time_point())
+		return;
+	if (Meter* meter = m_meter.load(std::memory_order_acquire)) {
+		const std::int64_t waited = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+		(write ? meter->write_wait : meter->read_wait).fetch_add(waited, std::memory_order_relaxed);
+	}
+	if (Tracer* tracer = m_tracer.load(std::memory_order_acquire))
+		tracer->RecordSpan(write ? Tracer::Kind::WriteWait : Tracer::Kind::ReadWait, m_trace_id, start);
+}
+
+void SharedFIFO::CountWrite(const std::size_t& bytes, const std::size_t& available) const noexcept {
+	if (Meter* meter = m_meter.load(std::memory_order_acquire)) {
+		meter->bytes_written.fetch_add(bytes, std::memory_order_relaxed);
+		// Writers hold m_mutex: no concurrent update of the peak
+		if (available > meter->peak_bytes.load(std::memory_order_relaxed))
+			meter->peak_bytes.store(available, std::memory_order_relaxed);
+	}
+	if (bytes > 0) {
+		if (Tracer* tracer = m_tracer.load(std::memory_order_acquire))
+			tracer->Record(Tracer::Kind::Write, m_trace_id, bytes);
+	}
+}
+
+void SharedFIFO::RemoveDemand() const noexcept {
+	if (m_limit == 0)
+		return;
 	std::scoped_lock<std::mutex> lock(m_mutex);
-	return FIFO::Size();
+	// The largest demand stands until the last waiting reader is gone
+	if (--m_demanding == 0)
+		m_demand.store(0, std::memory_order_release);
+}
+
+void SharedFIFO::RemoveWaiter(Waiter* waiter) const noexcept {
+	std::scoped_lock<std::mutex> lock(m_async_mutex);
+	std::erase(m_async_waiters, waiter);
+	m_async_count.store(m_async_waiters.size(), std::memory_order_relaxed);
+}
+
+void SharedFIFO::Signal() const noexcept {
+	std::vector<Waiter*> ready;
+	CollectReady(ready);
+	for (Waiter* waiter: ready)
+		waiter->Wake();
+}
+
+std::chrono::steady_clock::time_point SharedFIFO::StartWait() const noexcept {
+	if (m_meter.load(std::memory_order_acquire) || m_tracer.load(std::memory_order_acquire))
+		return std::chrono::steady_clock::now();
+	return {};
+}
+
+void SharedFIFO::Trace(const Tracer::Kind& kind) const noexcept {
+	if (Tracer* tracer = m_tracer.load(std::memory_order_acquire))
+		tracer->Record(kind, m_trace_id);
+}
+
+SharedFIFO::WriteStatus SharedFIFO::TryWrite(DataType& data) noexcept {
+	// Only a plain SharedFIFO can be bounded; derived FIFOs keep their own write path
+	if (m_limit == 0)
+		return Write(0, std::move(data)) ? WriteStatus::Written : WriteStatus::Rejected;
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		if (m_closed || m_error)
+			return WriteStatus::Rejected;
+		if (!HasRoom(data.size()))
+			return WriteStatus::Full;
+		const std::size_t avail = FIFO::AvailableBytes();
+		(void)FIFO::WriteInternal(0, std::move(data));
+		CountWrite(FIFO::AvailableBytes() - avail, FIFO::AvailableBytes());
+		Publish();
+	}
+	m_cv.notify_all();
+	Signal();
+	return WriteStatus::Written;
+}
+
+bool SharedFIFO::Rearm(Subscription& subscription) const noexcept {
+	std::scoped_lock<std::mutex> lock(m_async_mutex);
+	auto it = m_subscriptions.find(subscription.m_id);
+	if (it == m_subscriptions.end())
+		return false;
+	// Persistent callbacks fire again on the next change that finds them ready
+	if (subscription.m_persistent) {
+		m_async_waiters.push_back(&subscription);
+		m_async_count.store(m_async_waiters.size(), std::memory_order_relaxed);
+	}
+	else
+		m_subscriptions.erase(it);
+	return true;
+}
+
+bool SharedFIFO::Recycle(const std::size_t& max_capacity, std::size_t& grown) noexcept {
+	std::scoped_lock<std::mutex, std::mutex> lock(m_mutex, m_async_mutex);
+	// A once_flag cannot be re-armed, so a descriptor would never come back
+	if (m_readable_descriptor || m_writable_descriptor)
+		return false;
+	grown = m_buffer.capacity();
+	FIFO::Clear();
+	if (grown > max_capacity)
+		DataType().swap(m_buffer);
+	m_closed.store(false, std::memory_order_release);
+	m_error.store(false, std::memory_order_release);
+	m_error_message.clear();
+	m_async_waiters.clear();
+	m_async_count.store(0, std::memory_order_relaxed);
+	m_demanding = 0;
+	m_demand.store(0, std::memory_order_release);
+	m_subscriptions.clear();
+	m_meter.store(nullptr, std::memory_order_release);
+	m_meter_owner.reset();
+	m_tracer.store(nullptr, std::memory_order_release);
+	m_tracer_owner.reset();
+	m_trace_id = 0;
+	Publish();
+	return true;
+}
+
+std::size_t SharedFIFO::Subscribe(std::shared_ptr<Subscription> subscription) const noexcept {
+	std::size_t id;
+	{
+		std::scoped_lock<std::mutex> lock(m_async_mutex);
+		id = ++m_next_subscription;
+		subscription->m_id = id;
+		m_subscriptions.emplace(id, subscription);
+	}
+	if (!AddWaiter(subscription.get())) {
+		// Already ready: fire from the registering thread
+		{
+			std::scoped_lock<std::mutex> lock(m_async_mutex);
+			subscription->Collected();
+		}
+		subscription->Wake();
+	}
+	return id;
+}
+
+void SharedFIFO::Publish() const noexcept {
+	// Single writer (m_mutex is held): bump the sequence to odd, store the
+	// pair, then bump back to even so Snapshot() can detect torn reads.
+	const std::size_t seq = m_sequence.load(std::memory_order_relaxed);
+	m_sequence.store(seq + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	m_size.store(m_buffer.size(), std::memory_order_relaxed);
+	m_position.store(m_position_offset, std::memory_order_relaxed);
+	m_sequence.store(seq + 2, std::memory_order_release);
+}
+
+void SharedFIFO::Snapshot(std::size_t& size, std::size_t& position) const noexcept {
+	while (true) {
+		const std::size_t before = m_sequence.load(std::memory_order_acquire);
+		size = m_size.load(std::memory_order_relaxed);
+		position = m_position.load(std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if ((before & 1) == 0 && before == m_sequence.load(std::memory_order_relaxed))
+			return;
+		std::this_thread::yield();
+	}
+}
+
+bool SharedFIFO::HasRoom(const std::size_t& n) const noexcept {
+	if (m_limit == 0)
+		return true;
+	const std::size_t unread = m_buffer.size() - m_position_offset;
+	return unread == 0 || unread + n <= m_limit || unread < m_demand.load(std::memory_order_relaxed);
 }
 
 std::ostringstream SharedFIFO::HexDumpHeader() const noexcept {
@@ -133,9 +616,22 @@ bool SharedFIFO::ReadInternal(const std::size_t& count, DataType& outBuffer, con
 	std::size_t real_count = count == 0 ? avail : count;
 	if (real_count > avail && !m_closed) {
 		Wait(real_count, lock);
+		avail = FIFO::AvailableBytes();
 	}
 
 	auto result = FIFO::ReadInternal(count, outBuffer, flag);
+	const std::size_t consumed = avail - FIFO::AvailableBytes();
+	CountRead(consumed);
+	// The limit counts unread bytes only, so reading frees room as extracting does
+	const bool freed = flag == Operation::Extract || (m_limit > 0 && consumed > 0);
+	Publish();
+	lock.unlock();
+	if (freed) {
+		// Consuming frees room for writers waiting in bounded mode
+		if (m_limit > 0)
+			m_cv.notify_all();
+		Signal();
+	}
 	return result;
 }
 
@@ -149,46 +645,116 @@ bool SharedFIFO::ReadInternal(const std::size_t& count, WriteOnly& outBuffer, co
 	std::size_t real_count = count == 0 ? avail : count;
 	if (real_count > avail && !m_closed) {
 		Wait(real_count, lock);
+		avail = FIFO::AvailableBytes();
 	}
 
 	auto result = FIFO::ReadInternal(count, outBuffer, flag);
+	const std::size_t consumed = avail - FIFO::AvailableBytes();
+	CountRead(consumed);
+	// The limit counts unread bytes only, so reading frees room as extracting does
+	const bool freed = flag == Operation::Extract || (m_limit > 0 && consumed > 0);
+	Publish();
+	lock.unlock();
+	if (freed) {
+		// Consuming frees room for writers waiting in bounded mode
+		if (m_limit > 0)
+			m_cv.notify_all();
+		Signal();
+	}
 	return result;
 }
 
 void SharedFIFO::Wait(const std::size_t& n, std::unique_lock<std::mutex>& lock) const {
 	if (n == 0) return;
-	m_cv.wait(lock, [&] {
+	const auto start = StartWait();
+	const auto ready = [&] {
 		if (m_closed) { return true; }
 		if (m_error) { return true; }
 		const std::size_t sz = m_buffer.size();
 		const std::size_t rp = m_position_offset;
 		bool ready = sz >= rp + n;
 		return ready;
+	};
+	if (m_limit > 0 && !ready()) {
+		// As AddDemand(): writers waiting for room must not wait for this reader in turn
+		++m_demanding;
+		m_demand.store(std::max(m_demand.load(std::memory_order_relaxed), n), std::memory_order_release);
+		lock.unlock();
+		m_cv.notify_all();
+		Signal();
+		lock.lock();
+		m_cv.wait(lock, ready);
+		// Under the same lock as the read that follows: no other reader takes these bytes
+		if (--m_demanding == 0)
+			m_demand.store(0, std::memory_order_release);
+	}
+	else
+		m_cv.wait(lock, ready);
+	CountWait(start, false);
+}
+
+void SharedFIFO::WaitRoom(const std::size_t& n, std::unique_lock<std::mutex>& lock) const {
+	if (m_closed || m_error || HasRoom(n))
+		return;
+	const auto start = StartWait();
+	m_cv.wait(lock, [&] {
+		return m_closed || m_error || HasRoom(n);
 	});
+	CountWait(start, true);
 }
 
 bool SharedFIFO::WriteInternal(const std::size_t& count, const DataType& src) noexcept {
 	bool result;
 	{
-		std::scoped_lock lock(m_mutex);
+		std::unique_lock lock(m_mutex);
+		if (m_limit > 0)
+			WaitRoom(count == 0 ? src.size() : count, lock);
 		if (m_closed || m_error) {
 			return false;
 		}
+		const std::size_t avail = FIFO::AvailableBytes();
 		result = FIFO::WriteInternal(count, src);
+		CountWrite(FIFO::AvailableBytes() - avail, FIFO::AvailableBytes());
+		Publish();
 	}
 	m_cv.notify_all();
+	Signal();
 	return result;
 }
 
 bool SharedFIFO::WriteInternal(const std::size_t& count, DataType&& src) noexcept {
 	bool result;
 	{
-		std::scoped_lock lock(m_mutex);
+		std::unique_lock lock(m_mutex);
+		if (m_limit > 0)
+			WaitRoom(count == 0 ? src.size() : count, lock);
 		if (m_closed || m_error) {
 			return false;
 		}
+		const std::size_t avail = FIFO::AvailableBytes();
 		result = FIFO::WriteInternal(count, std::move(src));
+		CountWrite(FIFO::AvailableBytes() - avail, FIFO::AvailableBytes());
+		Publish();
 	}
 	m_cv.notify_all();
+	Signal();
 	return result;
+}
+
+bool SharedFIFO::WriteInternal(const std::size_t& count, const ReadOnly& src) noexcept {
+	if (!IsWritable())
+		return false;
+	DataType data;
+	if (!src.Read(count, data))
+		return false;
+	return WriteInternal(data.size(), std::move(data));
+}
+
+bool SharedFIFO::WriteInternal(const std::size_t& count, ReadOnly&& src) noexcept {
+	if (!IsWritable())
+		return false;
+	DataType data;
+	if (!src.Extract(count, data))
+		return false;
+	return WriteInternal(data.size(), std::move(data));
 }
\ No newline at end of file
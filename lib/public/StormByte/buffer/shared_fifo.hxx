@@ -1,9 +1,17 @@
 #pragma once
 
+#include <StormByte/buffer/event_descriptor.hxx>
+#include <StormByte/buffer/executor.hxx>
 #include <StormByte/buffer/fifo.hxx>
+#include <StormByte/buffer/tracer.hxx>
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 /**
  * @namespace Buffer
@@ -46,11 +54,102 @@ namespace StormByte::Buffer {
 	* @par Thread safety
 	*  All public member functions of SharedFIFO are thread-safe. Methods that
 	*  mutate internal state (Write/Extract/Clear/Close/Seek/Reserve) acquire
-	*  the internal mutex. Read accessors also acquire the mutex to maintain
-	*  consistency with the current head/tail/read-position state.
+	*  the internal mutex and, before releasing it, publish the resulting size,
+	*  read position, closed and error flags through atomics. Status queries
+	*  (@ref AvailableBytes(), @ref Size(), @ref Empty(), @ref EoF(),
+	*  @ref HasError(), @ref IsReadable() and @ref IsWritable()) only load those
+	*  atomics, so polling them never contends with writers or readers for the
+	*  mutex.
+	*
+	* @par Bounded mode
+	*  A SharedFIFO constructed with a byte limit makes writers wait while the
+	*  unread bytes (@ref AvailableBytes()) plus the new write would exceed it.
+	*  A write into a buffer with nothing unread is always accepted, so writes
+	*  larger than the limit still go through. Reading or extracting both make
+	*  room; read bytes stay retained until dropped or cleaned, so @ref Seek()
+	*  can still move back to them. While a reader waits for more bytes than
+	*  are unread, writes are admitted past the limit until they are there, so
+	*  a read of any size completes, including one larger than the limit.
+	*  Derived FIFOs with their own write path are unbounded or bound themselves.
+	*
+	* @par Asynchronous waiters
+	*  Coroutines waiting through Consumer::ReadAsync() or Producer::WriteAsync()
+	*  register a @ref Waiter instead of blocking a thread. Every state change that
+	*  can satisfy a waiter (write, consume, seek, close, error) wakes the ready
+	*  ones after the internal mutex is released.
+	*
+	* @par Readiness callbacks
+	*  @ref OnReadable(), @ref OnWritable(), @ref OnClosed() and @ref OnError()
+	*  register callbacks for event-driven consumers that cannot park a thread.
+	*  They ride on the same waiter list: the thread whose change makes a callback
+	*  ready runs it (or posts it to the given @ref Executor) with no lock held.
+	*  One-shot callbacks fire once; persistent ones fire again on each later
+	*  change that finds them ready. Runs of one callback never overlap: changes
+	*  made while it runs (including by the callback itself) make it run once more.
+	*
+	* @par Readiness descriptors
+	*  @ref ReadableDescriptor() and @ref WritableDescriptor() expose an
+	*  @ref EventDescriptor (eventfd, or a pipe where eventfd is missing) for
+	*  poll/epoll loops. A descriptor is set when the buffer becomes ready and
+	*  stays set until acknowledged: after servicing the buffer call
+	*  @ref AcknowledgeReadable() / @ref AcknowledgeWritable(), which clear it and
+	*  set it again at once if the buffer is still ready.
 	*/
 	class STORMBYTE_BUFFER_PUBLIC SharedFIFO: public FIFO {
+		friend class AsyncOperation;
+		friend class FIFOPool;
+		friend class Producer;
+		friend class ReadAwaitable;
+		friend class WriteAwaitable;
 		public:
+			/**
+			 * @class Waiter
+			 * @brief Pending asynchronous operation registered on a SharedFIFO.
+			 * @details @ref Ready() is evaluated with the waiter list lock held and
+			 *          must only use lock-free status queries. @ref Wake() is called
+			 *          once, after the waiter was removed from the list and with no
+			 *          lock held.
+			 */
+			class STORMBYTE_BUFFER_PUBLIC Waiter {
+				public:
+					/**
+					 * @brief Virtual destructor.
+					 */
+					virtual ~Waiter() noexcept 						= default;
+
+					/**
+					 * @brief Check whether the awaited condition holds.
+					 * @return true if the waiter can be woken.
+					 */
+					virtual bool 									Ready() const noexcept = 0;
+
+					/**
+					 * @brief Continue the waiting operation.
+					 */
+					virtual void 									Wake() noexcept = 0;
+
+					/**
+					 * @brief Hook called with the waiter list lock held when the waiter
+					 *        is taken out of the list to be woken.
+					 * @details Lets waiters owned by the buffer keep themselves alive
+					 *          until @ref Wake() runs.
+					 */
+					virtual void 									Collected() noexcept {}
+			};
+
+			using Callback = std::function<void()>;				///< Readiness callback.
+
+			/**
+			 * @brief Snapshot of the counters kept once @ref EnableStatistics() was called.
+			 */
+			struct Counters {
+				std::size_t bytes_read {0};						///< Bytes consumed by reads, extracts and drops.
+				std::size_t bytes_written {0};					///< Bytes appended by writes.
+				std::size_t peak_bytes {0};						///< Most bytes available for reading at once.
+				std::chrono::nanoseconds read_wait {0};			///< Time readers spent blocked waiting for bytes.
+				std::chrono::nanoseconds write_wait {0};		///< Time writers spent blocked waiting for room (bounded mode).
+			};
+
 			/**
 			 * @brief Construct a SharedFIFO with optional initial capacity.
 			 * @param capacity Initial number of bytes to allocate in the buffer.
@@ -62,13 +161,20 @@ namespace StormByte::Buffer {
 			 * @brief Construct a SharedFIFO with initial data.
 			 * @param data Initial byte vector to populate the FIFO.
 			 */
-			inline SharedFIFO(const DataType& data): FIFO(data) {}
+			inline SharedFIFO(const DataType& data): FIFO(data), m_size(m_buffer.size()) {}
 
 			/**
 			 * @brief Construct a SharedFIFO with initial data using move semantics.
 			 * @param data Initial byte vector to move into the FIFO.
 			 */
-			inline SharedFIFO(DataType&& data) noexcept: FIFO(std::move(data)) {}
+			inline SharedFIFO(DataType&& data) noexcept: FIFO(std::move(data)), m_size(m_buffer.size()) {}
+
+			/**
+			 * @brief Construct an empty SharedFIFO in bounded mode.
+			 * @param limit Maximum unread bytes before writers wait; 0 means unbounded.
+			 * @see Limit()
+			 */
+			explicit inline SharedFIFO(const std::size_t& limit) noexcept: FIFO(), m_limit(limit) {}
 
 			/**
 			 * @brief Construct FIFO from an input range.
@@ -83,7 +189,7 @@ namespace StormByte::Buffer {
 				requires(std::ranges::range_value_t<R> v) { static_cast<std::byte>(v); } &&
 				(!std::same_as<std::remove_cvref_t<R>, DataType>)
 			inline SharedFIFO(const R& r) noexcept: FIFO(r), m_closed(false),
-			m_error(false), m_error_message() {}
+			m_error(false), m_error_message(), m_size(m_buffer.size()) {}
 
 			/**
 			 * @brief Construct FIFO from an rvalue range (moves when DataType rvalue).
@@ -94,25 +200,25 @@ namespace StormByte::Buffer {
 			requires (!std::is_class_v<std::remove_cv_t<std::ranges::range_value_t<Rr>>>) &&
 				requires(std::ranges::range_value_t<Rr> v) { static_cast<std::byte>(v); }
 			inline SharedFIFO(Rr&& r) noexcept: FIFO(std::forward<Rr>(r)), m_closed(false),
-			m_error(false), m_error_message() {}
+			m_error(false), m_error_message(), m_size(m_buffer.size()) {}
 
 			/**
 			 * @brief Construct FIFO from a string view (does not include terminating NUL).
 		 	*/
 			inline SharedFIFO(std::string_view sv) noexcept: FIFO(sv), m_closed(false),
-			m_error(false), m_error_message() {}
+			m_error(false), m_error_message(), m_size(m_buffer.size()) {}
 
 			/**
 			 * @brief Construct a SharedFIFO by copying or moving from a FIFO.
 			 * @param other Source FIFO to copy or move from.
 			 */
-			inline SharedFIFO(const FIFO& other): FIFO(other) {}
+			inline SharedFIFO(const FIFO& other): FIFO(other), m_size(m_buffer.size()), m_position(m_position_offset) {}
 
 			/**
 			 * @brief Construct a SharedFIFO by moving from a FIFO.
 			 * @param other Source FIFO to move from; left empty after move.
 			 */
-			inline SharedFIFO(FIFO&& other) noexcept: FIFO(std::move(other)) {}
+			inline SharedFIFO(FIFO&& other) noexcept: FIFO(std::move(other)), m_size(m_buffer.size()), m_position(m_position_offset) {}
 
 			/**
 			 * @brief Copy constructors are deleted.
@@ -189,9 +295,24 @@ namespace StormByte::Buffer {
 				return !(*this == other);
 			}
 
+			/**
+			 * @brief Clear the readable descriptor, setting it again if still readable.
+			 * @details Call after servicing a readable notification; bytes left unread
+			 *          keep the descriptor set.
+			 * @see ReadableDescriptor()
+			 */
+			void 												AcknowledgeReadable() const noexcept;
+
+			/**
+			 * @brief Clear the writable descriptor, setting it again if still writable.
+			 * @see WritableDescriptor()
+			 */
+			void 												AcknowledgeWritable() const noexcept;
+
 			/**
 			 * @brief Get the number of bytes available for reading.
 			 * @return Number of bytes available from the current read position.
+			 * @note Lock-free: computed from the published size and read position.
 			 */
 			virtual std::size_t 								AvailableBytes() const noexcept override;
 
@@ -240,6 +361,27 @@ namespace StormByte::Buffer {
 			 * 	   even if there is no unread data (i.e., when read position is at the end of the buffer).
 			 */
 			virtual bool 										Empty() const noexcept override;
+
+			/**
+			 * @brief Start counting traffic, peak size and blocked time for @ref Statistics().
+			 * @details May be called at any time, from any thread; counting starts then
+			 *          and cannot be turned off. Until called, the read and write paths
+			 *          only test one pointer. Asynchronous operations waiting in a
+			 *          coroutine are not blocked and add no wait time.
+			 */
+			void 												EnableStatistics() const noexcept;
+
+			/**
+			 * @brief Record reads, writes, blocking waits, close and error to @p tracer.
+			 * @param tracer Tracer receiving the events.
+			 * @param id Buffer id the events carry.
+			 * @return false if a tracer was already set (it is kept) or @p tracer is null.
+			 * @details A buffer is traced by one tracer for its whole life, which the
+			 *          buffer keeps alive. Until called, the read and write paths only
+			 *          test one pointer.
+			 * @see Tracer
+			 */
+			bool 												EnableTracing(std::shared_ptr<Tracer> tracer, const std::uint32_t& id) const noexcept;
 			
 			/**
 			 * @brief Check if the reader has reached end-of-file.
@@ -249,6 +391,16 @@ namespace StormByte::Buffer {
 			 */
 			virtual bool 										EoF() const noexcept override;
 
+			/**
+			 * @brief Blocking destructive read of the next message.
+			 * @param outBuffer Replaced with the message bytes.
+			 * @return false if no message became available (closed or error), true otherwise.
+			 * @details A SharedFIFO does not keep write boundaries, so a message is every
+			 *          byte available once at least one is. @ref MessageFIFO overrides
+			 *          this to return each write as it was made, by move.
+			 */
+			virtual bool 										ExtractMessage(DataType& outBuffer) noexcept;
+
 			/**
 			 * @brief Check if the buffer is in an error state.
 			 * @return true if the buffer is in error state, false otherwise.
@@ -282,7 +434,9 @@ namespace StormByte::Buffer {
 			 *          pending to read.
 			 * @see SetError(), IsWritable(), AvailableBytes(), EoF()
 			 */
-			inline virtual bool 								IsReadable() const noexcept override { return !m_error; }
+			inline virtual bool 								IsReadable() const noexcept override {
+				return !m_error.load(std::memory_order_acquire);
+			}
 
 			/**
 			 * @brief Check if the buffer is writable (not closed and not in error state).
@@ -290,7 +444,84 @@ namespace StormByte::Buffer {
 			 * @details A buffer becomes unwritable when Close() or SetError() is called.
 			 * @see Close(), SetError(), IsReadable()
 			 */
-			inline virtual bool 								IsWritable() const noexcept override { return !m_closed && !m_error; }
+			inline virtual bool 								IsWritable() const noexcept override {
+				return !m_closed.load(std::memory_order_acquire) && !m_error.load(std::memory_order_acquire);
+			}
+
+			/**
+			 * @brief Byte limit of bounded mode.
+			 * @return Maximum unread bytes before writers wait, 0 if unbounded.
+			 */
+			inline std::size_t 									Limit() const noexcept {
+				return m_limit;
+			}
+
+			/**
+			 * @brief Call @p callback once the buffer is closed (for writes).
+			 * @param callback Callback to run once.
+			 * @param executor Executor to post the callback to (null: run it in the closing thread).
+			 * @return Callback id for @ref RemoveCallback().
+			 * @details Runs right away if the buffer is already closed.
+			 */
+			std::size_t 										OnClosed(Callback callback, std::shared_ptr<Executor> executor = nullptr) const noexcept;
+
+			/**
+			 * @brief Call @p callback once the buffer enters the error state.
+			 * @param callback Callback to run once.
+			 * @param executor Executor to post the callback to (null: run it in the signalling thread).
+			 * @return Callback id for @ref RemoveCallback().
+			 * @details Runs right away if the buffer is already errored.
+			 */
+			std::size_t 										OnError(Callback callback, std::shared_ptr<Executor> executor = nullptr) const noexcept;
+
+			/**
+			 * @brief Call @p callback when at least @p min_bytes can be read.
+			 * @param min_bytes Bytes that must be available (0 behaves as 1).
+			 * @param callback Callback to run.
+			 * @param persistent Keep the callback armed after it fired.
+			 * @param executor Executor to post the callback to (null: run it in the writing thread).
+			 * @return Callback id for @ref RemoveCallback().
+			 * @details Closing or erroring the buffer makes it readable too (a read then
+			 *          returns what is left or fails), as with @ref EoF().
+			 */
+			std::size_t 										OnReadable(const std::size_t& min_bytes, Callback callback, const bool& persistent = false, std::shared_ptr<Executor> executor = nullptr) const noexcept;
+
+			/**
+			 * @brief Call @p callback when a write of @p bytes would not wait.
+			 * @param bytes Size of the intended write.
+			 * @param callback Callback to run.
+			 * @param persistent Keep the callback armed after it fired.
+			 * @param executor Executor to post the callback to (null: run it in the consuming thread).
+			 * @return Callback id for @ref RemoveCallback().
+			 * @details Only bounded buffers are ever not writable; closing or erroring
+			 *          the buffer fires the callback too (a write then fails).
+			 * @see Limit()
+			 */
+			std::size_t 										OnWritable(const std::size_t& bytes, Callback callback, const bool& persistent = false, std::shared_ptr<Executor> executor = nullptr) const noexcept;
+
+			/**
+			 * @brief Blocking read of the next message, advancing the read position.
+			 * @param outBuffer Replaced with the message bytes.
+			 * @return false if no message became available (closed or error), true otherwise.
+			 * @see ExtractMessage()
+			 */
+			virtual bool 										ReadMessage(DataType& outBuffer) noexcept;
+
+			/**
+			 * @brief Descriptor that polls readable while bytes can be read, or at end of stream.
+			 * @return File descriptor for poll/epoll, or -1 if unsupported on this platform.
+			 * @details Created on first use and owned by the buffer; do not close it.
+			 * @see AcknowledgeReadable()
+			 */
+			int 												ReadableDescriptor() const noexcept;
+
+			/**
+			 * @brief Unregister a readiness callback.
+			 * @param id Id returned when registering.
+			 * @return false if the id is unknown (already fired one-shot or removed).
+			 * @details A callback already being dispatched may still run once.
+			 */
+			bool 												RemoveCallback(const std::size_t& id) const noexcept;
 
 			/**
 			 * @brief Move the read position for non-destructive reads.
@@ -303,6 +534,34 @@ namespace StormByte::Buffer {
 			 */
 			virtual void 										Seek(const std::ptrdiff_t& offset, const Position& mode) const noexcept override;
 
+			/**
+			 * @brief Descriptor that polls readable while a write would not wait.
+			 * @return File descriptor for poll/epoll, or -1 if unsupported on this platform.
+			 * @details Only bounded buffers are ever not writable. Created on first use
+			 *          and owned by the buffer; do not close it.
+			 * @see AcknowledgeWritable(), Limit()
+			 */
+			int 												WritableDescriptor() const noexcept;
+
+			/**
+			 * @brief Write @p data to a priority lane.
+			 * @param lane Lane index; 0 is the highest priority.
+			 * @param data Bytes to write, moved in.
+			 * @return bool indicating success or failure.
+			 * @details A SharedFIFO has a single lane: the lane is ignored and the
+			 *          bytes are written as by @ref Write(). @ref PriorityFIFO
+			 *          overrides this to serve lanes in priority order.
+			 */
+			virtual bool 										WriteLane(const std::size_t& lane, DataType&& data) noexcept;
+
+			/**
+			 * @brief Write a numbered block that must be read in sequence order.
+			 * @param sequence Position of the block in the stream.
+			 * @param data Bytes of the block.
+			 * @return false: a SharedFIFO does not reorder; see @ref ReorderFIFO.
+			 */
+			virtual bool 										WriteSequence(const std::uint64_t& sequence, DataType&& data) noexcept;
+
 			/**
 			 * @brief Thread-safe error state setting.
 			 * @details Marks buffer as erroneous (unreadable and unwritable), notifies all
@@ -318,15 +577,211 @@ namespace StormByte::Buffer {
 			 */
 			virtual std::size_t 								Size() const noexcept override;
 
+			/**
+			 * @brief Read the counters.
+			 * @return Counters so far; all zero until @ref EnableStatistics() is called.
+			 * @details Lock-free; each counter is read separately while the buffer is in use.
+			 */
+			Counters 											Statistics() const noexcept;
+
 		protected:
-			bool m_closed {false};    							///< Whether the SharedFIFO is closed for further writes.
-			bool m_error {false};    							///< Whether the SharedFIFO is in an error state.
+			std::atomic<bool> m_closed {false};					///< Whether the SharedFIFO is closed for further writes.
+			std::atomic<bool> m_error {false};					///< Whether the SharedFIFO is in an error state.
 			std::string m_error_message;    					///< Optional error message associated with the error state.
-
-		private:
 			mutable std::mutex m_mutex;							///< Mutex protecting internal state.
 			mutable std::condition_variable_any m_cv;			///< Condition variable for blocking reads/writes.
 
+			/**
+			 * @brief Obtain the buffer a new Consumer should read from.
+			 * @param self Shared pointer owning this SharedFIFO.
+			 * @return @p self, so every Consumer shares this FIFO and its read position.
+			 * @details Called by Producer::Consumer(). Derived FIFOs that give each
+			 *          consumer its own view of the data (see @ref BroadcastFIFO)
+			 *          return a new per-consumer buffer instead.
+			 */
+			inline virtual std::shared_ptr<SharedFIFO> 			ConsumerView(std::shared_ptr<SharedFIFO> self) {
+				return self;
+			}
+
+			/**
+			 * @brief Outcome of a non-blocking write attempt.
+			 */
+			enum class WriteStatus {
+				Written,										///< The bytes were appended.
+				Full,											///< Bounded mode has no room yet; nothing was written.
+				Rejected										///< Closed or errored.
+			};
+
+			/**
+			 * @brief Check without locking whether a write of @p n bytes fits the limit.
+			 * @param n Size of the write.
+			 * @return true if unbounded, nothing is unread or below the limit after the write.
+			 */
+			virtual bool 										Admits(const std::size_t& n) const noexcept;
+
+			/**
+			 * @brief Count a reader waiting for @p n unread bytes.
+			 * @param n Unread bytes the reader needs.
+			 * @details In bounded mode, writes are admitted past the limit until
+			 *          @p n bytes are unread, so the reader never waits on writers
+			 *          that wait for it. Pair with @ref RemoveDemand().
+			 */
+			void 												AddDemand(const std::size_t& n) const noexcept;
+
+			/**
+			 * @brief Register an asynchronous waiter unless it is already ready.
+			 * @param waiter Waiter to register; must stay alive until woken or removed.
+			 * @return true if registered, false if @p waiter was ready (not registered).
+			 */
+			bool 												AddWaiter(Waiter* waiter) const noexcept;
+
+			/**
+			 * @brief Count and trace bytes consumed by a read. Requires @c m_mutex.
+			 * @param bytes Bytes consumed.
+			 */
+			void 												CountRead(const std::size_t& bytes) const noexcept;
+
+			/**
+			 * @brief Count and trace the time a blocking wait took.
+			 * @param start Value returned by @ref StartWait().
+			 * @param write Whether a writer waited for room (otherwise a reader for bytes).
+			 */
+			void 												CountWait(const std::chrono::steady_clock::time_point& start, const bool& write) const noexcept;
+
+			/**
+			 * @brief Count and trace bytes appended by a write. Requires @c m_mutex.
+			 * @param bytes Bytes appended.
+			 * @param available Bytes available for reading after the write.
+			 */
+			void 												CountWrite(const std::size_t& bytes, const std::size_t& available) const noexcept;
+
+			/**
+			 * @brief Move every ready waiter out of the waiter list.
+			 * @param ready Receives the waiters to wake; the caller wakes them with no lock held.
+			 */
+			void 												CollectReady(std::vector<Waiter*>& ready) const noexcept;
+
+			/**
+			 * @brief Check whether writes to @p lane are read ahead of plain writes.
+			 * @param lane Lane index, as given to @ref WriteLane().
+			 * @return false: a SharedFIFO has a single lane shared with plain writes.
+			 */
+			inline virtual bool 								Overtakes(const std::size_t& lane) const noexcept {
+				(void)lane;
+				return false;
+			}
+
+			/**
+			 * @brief Forget a reader counted by @ref AddDemand().
+			 */
+			void 												RemoveDemand() const noexcept;
+
+			/**
+			 * @brief Unregister a waiter that has not been woken.
+			 * @param waiter Waiter to remove.
+			 */
+			void 												RemoveWaiter(Waiter* waiter) const noexcept;
+
+			/**
+			 * @brief Wake every ready waiter.
+			 * @details Call after each state change, with no lock held. Costs a fence
+			 *          and one atomic load while nobody waits.
+			 */
+			void 												Signal() const noexcept;
+
+			/**
+			 * @brief Time the start of a blocking wait, when statistics or tracing are enabled.
+			 * @return Current time, or the epoch while both are disabled.
+			 */
+			std::chrono::steady_clock::time_point 				StartWait() const noexcept;
+
+			/**
+			 * @brief Record a close or error event when tracing is enabled.
+			 * @param kind Tracer::Kind::Close or Tracer::Kind::Error.
+			 */
+			void 												Trace(const Tracer::Kind& kind) const noexcept;
+
+			/**
+			 * @brief Write without waiting for room in bounded mode.
+			 * @param data Bytes to write; moved from only when written.
+			 * @return Whether the bytes were written, did not fit yet, or were rejected.
+			 * @details Derived FIFOs that are never bounded simply write.
+			 */
+			virtual WriteStatus 								TryWrite(DataType& data) noexcept;
+
+		private:
+			mutable std::atomic<std::size_t> m_sequence {0};	///< Seqlock counter guarding the published size/position pair (odd while publishing).
+			mutable std::atomic<std::size_t> m_size {0};		///< Published buffer size.
+			mutable std::atomic<std::size_t> m_position {0};	///< Published read position.
+			const std::size_t m_limit {0};						///< Bounded mode byte limit (0: unbounded).
+			mutable std::size_t m_demanding {0};				///< Readers waiting for more bytes than are unread; guarded by @c m_mutex.
+			mutable std::atomic<std::size_t> m_demand {0};		///< Most unread bytes a waiting reader needs (0: none); written under @c m_mutex.
+			mutable std::mutex m_async_mutex;					///< Guards @c m_async_waiters.
+			mutable std::vector<Waiter*> m_async_waiters;		///< Registered asynchronous waiters.
+			mutable std::atomic<std::size_t> m_async_count {0};	///< Size of @c m_async_waiters, readable without the lock.
+			class Subscription;									///< Registered readiness callback.
+			struct Meter;										///< Counters behind @ref Statistics().
+			mutable std::atomic<Meter*> m_meter {nullptr};		///< Counters, null until @ref EnableStatistics().
+			mutable std::shared_ptr<Meter> m_meter_owner;		///< Owns @c m_meter; set once under @c m_mutex.
+			mutable std::atomic<Tracer*> m_tracer {nullptr};	///< Event recorder, null until @ref EnableTracing().
+			mutable std::shared_ptr<Tracer> m_tracer_owner;		///< Owns @c m_tracer; set once under @c m_mutex.
+			mutable std::uint32_t m_trace_id {0};				///< Buffer id in traced events; set before @c m_tracer.
+			mutable std::unordered_map<std::size_t, std::shared_ptr<Subscription>> m_subscriptions;	///< Callbacks by id; guarded by @c m_async_mutex.
+			mutable std::size_t m_next_subscription {0};		///< Last callback id handed out; guarded by @c m_async_mutex.
+			mutable std::once_flag m_readable_once;				///< Creates @c m_readable_descriptor.
+			mutable std::once_flag m_writable_once;				///< Creates @c m_writable_descriptor.
+			mutable std::shared_ptr<EventDescriptor> m_readable_descriptor;	///< Set while readable.
+			mutable std::shared_ptr<EventDescriptor> m_writable_descriptor;	///< Set while writable.
+
+			/**
+			 * @brief Finish a fired callback: re-arm it if persistent, forget it otherwise.
+			 * @param subscription Fired callback.
+			 * @return false if it was removed meanwhile and must not run.
+			 */
+			bool 												Rearm(Subscription& subscription) const noexcept;
+
+			/**
+			 * @brief Reset to a new, open and empty buffer for reuse by a FIFOPool.
+			 * @param max_capacity Capacity kept at most; a larger allocation is freed.
+			 * @param grown Receives the capacity the buffer had grown to.
+			 * @return false if an event descriptor was created, which cannot be reset.
+			 * @details Drops callbacks, statistics and tracing. Requires that nothing
+			 *          else refers to the buffer.
+			 */
+			bool 												Recycle(const std::size_t& max_capacity, std::size_t& grown) noexcept;
+
+			/**
+			 * @brief Register a readiness callback, firing it at once if already ready.
+			 * @param subscription Callback to register.
+			 * @return Callback id.
+			 */
+			std::size_t 										Subscribe(std::shared_ptr<Subscription> subscription) const noexcept;
+
+			/**
+			 * @brief Check whether a write of @p n bytes fits the limit. Requires @c m_mutex.
+			 * @param n Size of the write.
+			 * @return true if unbounded, nothing is unread, below the limit after the
+			 *         write, or a reader waits for more than is unread.
+			 */
+			bool 												HasRoom(const std::size_t& n) const noexcept;
+
+			/**
+			 * @brief Publish the current size and read position for lock-free status queries.
+			 * @details Must be called with @c m_mutex held after every operation that
+			 *          changes the buffer size or the read position. The pair is
+			 *          written under a seqlock so that readers never observe a size
+			 *          from one state combined with a position from another.
+			 */
+			void 												Publish() const noexcept;
+
+			/**
+			 * @brief Load a consistent snapshot of the published size and read position.
+			 * @param size Receives the published buffer size.
+			 * @param position Receives the published read position.
+			 * @details Never acquires @c m_mutex; retries only while a publish is in flight.
+			 */
+			void 												Snapshot(std::size_t& size, std::size_t& position) const noexcept;
+
 			/**
 			 * @brief Produce a hexdump header with size and read position.
 			 * @return ostringstream containing the hexdump header.
@@ -366,6 +821,14 @@ namespace StormByte::Buffer {
 			 */
 			void 												Wait(const std::size_t& n, std::unique_lock<std::mutex>& lock) const;
 
+			/**
+			 * @brief Wait until a write of @p n bytes fits the bounded mode limit
+			 *        (or the buffer is closed or errored).
+			 * @param n Size of the write.
+			 * @param lock The caller-held unique_lock for the internal mutex.
+			 */
+			void 												WaitRoom(const std::size_t& n, std::unique_lock<std::mutex>& lock) const;
+
 			/**
 			 * @brief Internal helper for write operations.
 			 * @param dst Destination buffer to write into.
@@ -381,5 +844,23 @@ namespace StormByte::Buffer {
 			 * @return `bool` indicating success or failure.
 			 */
 			virtual bool 										WriteInternal(const std::size_t& count, DataType&& src) noexcept override;
+
+			/**
+			 * @brief Internal helper for write operations from a ReadOnly source.
+			 * @param count Number of bytes to write.
+			 * @param src Source ReadOnly buffer to read from (non-destructive).
+			 * @return `bool` indicating success or failure.
+			 * @details The source is read outside of the internal mutex and then
+			 *          appended through the locked DataType path.
+			 */
+			virtual bool 										WriteInternal(const std::size_t& count, const ReadOnly& src) noexcept override;
+
+			/**
+			 * @brief Internal helper for write operations from a ReadOnly source.
+			 * @param count Number of bytes to write.
+			 * @param src Source ReadOnly buffer to extract from (destructive).
+			 * @return `bool` indicating success or failure.
+			 */
+			virtual bool 										WriteInternal(const std::size_t& count, ReadOnly&& src) noexcept override;
 	};
 }
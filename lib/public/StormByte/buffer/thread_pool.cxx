@@ -0,0 +1,120 @@
+#include <StormByte/buffer/thread_pool.hxx>
+
+#include <algorithm>
+#include <chrono>
+
+using namespace StormByte::Buffer;
+
+namespace {
+	constexpr std::chrono::seconds SpareIdleTime {1};	///< Idle time after which a spare worker exits.
+}
+
+ThreadPool::ThreadPool(const std::size_t& threads, const bool& grow):
+	m_threads(threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency())), m_grow(grow) {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	for (std::size_t i = 0; i < m_threads; ++i)
+		Spawn(false);
+}
+
+ThreadPool::~ThreadPool() noexcept {
+	std::list<std::thread> workers;
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_cv.notify_all();
+	// Workers drain the queue before leaving; tasks may still start spares meanwhile
+	while (true) {
+		{
+			std::scoped_lock<std::mutex> lock(m_mutex);
+			if (m_workers.empty())
+				break;
+			workers.splice(workers.end(), m_workers);
+		}
+		for (std::thread& worker: workers)
+			if (worker.joinable())
+				worker.join();
+		workers.clear();
+	}
+}
+
+void ThreadPool::Post(std::function<void()> task) {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	Reap();
+	m_tasks.push_back(std::move(task));
+	// Every queued task must have an idle worker to take it
+	if (m_grow && m_tasks.size() > m_idle)
+		Spawn(true);
+	m_cv.notify_one();
+}
+
+std::shared_ptr<ThreadPool> ThreadPool::Shared() {
+	static std::shared_ptr<ThreadPool> pool = std::make_shared<ThreadPool>(0, true);
+	return pool;
+}
+
+std::size_t ThreadPool::Capacity() const noexcept {
+	return m_grow ? 0 : m_threads;
+}
+
+std::size_t ThreadPool::Threads() const noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	return m_workers.size() - m_exited.size();
+}
+
+void ThreadPool::Reap() noexcept {
+	for (const std::thread::id& id: m_exited) {
+		auto it = std::find_if(m_workers.begin(), m_workers.end(), [&id](const std::thread& worker) {
+			return worker.get_id() == id;
+		});
+		if (it != m_workers.end()) {
+			it->join();
+			m_workers.erase(it);
+		}
+	}
+	m_exited.clear();
+}
+
+void ThreadPool::Spawn(const bool& spare) {
+	// Counted idle right away so concurrent posts do not start a spare for the same task
+	++m_idle;
+	try {
+		m_workers.emplace_back([this, spare]() { Work(spare); });
+	}
+	catch (...) {
+		--m_idle;
+		throw;
+	}
+}
+
+void ThreadPool::Work(const bool& spare) noexcept {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true) {
+		if (m_tasks.empty()) {
+			if (m_stop)
+				break;
+			const auto ready = [this]() { return m_stop || !m_tasks.empty(); };
+			if (!spare)
+				m_cv.wait(lock, ready);
+			else if (!m_cv.wait_for(lock, SpareIdleTime, ready))
+				break;
+			continue;
+		}
+		std::function<void()> task = std::move(m_tasks.front());
+		m_tasks.pop_front();
+		--m_idle;
+		lock.unlock();
+		try {
+			task();
+		}
+		catch (...) {
+			// Tasks report their own failures
+		}
+		task = nullptr;
+		lock.lock();
+		++m_idle;
+	}
+	--m_idle;
+	if (spare && !m_stop)
+		m_exited.push_back(std::this_thread::get_id());
+}
\ No newline at end of file
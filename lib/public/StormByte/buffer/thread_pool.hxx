@@ -0,0 +1,130 @@
+#pragma once
+
+#include <StormByte/buffer/executor.hxx>
+
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class ThreadPool
+	 * @brief Executor running tasks on a set of reusable worker threads.
+	 *
+	 * @par Overview
+	 *  Tasks are run in the order they were posted by a fixed set of workers
+	 *  started on construction. Pipelines post their stages here instead of
+	 *  starting a thread per stage on every Pipeline::Process() call.
+	 *
+	 * @par Growing pools
+	 *  Pipeline stages block on each other: a stage waiting for input pins its
+	 *  worker until the stage before it writes. With more running stages than
+	 *  workers a fixed pool can stall. A growing pool starts a spare worker when
+	 *  a task is posted while every worker is busy, so no task ever waits for a
+	 *  worker; spare workers stay around for reuse and exit after a second idle.
+	 *  @ref Shared() is a growing pool sized to the hardware.
+	 *
+	 * @par Thread safety
+	 *  @ref Post() may be called from any thread, including from tasks. The
+	 *  destructor runs every task still queued, then joins the workers; it must
+	 *  not be called from one of them.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC ThreadPool final: public Executor {
+		public:
+			/**
+			 * @brief Start the pool.
+			 * @param threads Workers kept running (0: hardware concurrency).
+			 * @param grow Start spare workers instead of queueing when every worker is busy.
+			 */
+			explicit ThreadPool(const std::size_t& threads = 0, const bool& grow = false);
+
+			/**
+			 * @brief Copy constructor deleted.
+			 */
+			ThreadPool(const ThreadPool&)								= delete;
+
+			/**
+			 * @brief Move constructor deleted.
+			 */
+			ThreadPool(ThreadPool&&)									= delete;
+
+			/**
+			 * @brief Run the queued tasks and join every worker.
+			 */
+			~ThreadPool() noexcept override;
+
+			/**
+			 * @brief Copy assignment deleted.
+			 */
+			ThreadPool& operator=(const ThreadPool&)					= delete;
+
+			/**
+			 * @brief Move assignment deleted.
+			 */
+			ThreadPool& operator=(ThreadPool&&)							= delete;
+
+			/**
+			 * @brief Queue @p task for a worker.
+			 * @param task Task to run; exceptions it throws are discarded.
+			 */
+			void 														Post(std::function<void()> task) override;
+
+			/**
+			 * @brief Growing pool shared by every Pipeline without its own executor.
+			 * @return Process-wide pool, created on first use.
+			 */
+			static std::shared_ptr<ThreadPool> 							Shared();
+
+			/**
+			 * @brief Number of tasks the pool can run at the same time.
+			 * @return Permanent workers of a fixed pool, 0 for a growing one.
+			 */
+			std::size_t 												Capacity() const noexcept override;
+
+			/**
+			 * @brief Number of workers currently started.
+			 * @return Permanent plus spare workers.
+			 */
+			std::size_t 												Threads() const noexcept;
+
+		private:
+			const std::size_t m_threads;								///< Permanent workers.
+			const bool m_grow;											///< Whether spare workers are started.
+			mutable std::mutex m_mutex;									///< Protects everything below.
+			std::condition_variable m_cv;								///< Signalled when a task is queued or on stop.
+			std::deque<std::function<void()>> m_tasks;					///< Queued tasks.
+			std::list<std::thread> m_workers;							///< Started workers.
+			std::vector<std::thread::id> m_exited;						///< Spare workers that exited, to join.
+			std::size_t m_idle {0};										///< Workers waiting for a task.
+			bool m_stop {false};										///< Set by the destructor.
+
+			/**
+			 * @brief Join the spare workers that exited. Requires @c m_mutex.
+			 */
+			void 														Reap() noexcept;
+
+			/**
+			 * @brief Start a worker. Requires @c m_mutex.
+			 * @param spare Whether it exits once idle.
+			 */
+			void 														Spawn(const bool& spare);
+
+			/**
+			 * @brief Worker loop.
+			 * @param spare Whether it exits once idle.
+			 */
+			void 														Work(const bool& spare) noexcept;
+	};
+}
@@ -0,0 +1,189 @@
+#include <StormByte/buffer/tracer.hxx>
+
+#include <array>
+#include <fstream>
+#include <sstream>
+
+using namespace StormByte::Buffer;
+
+namespace {
+	std::atomic<std::uint64_t> g_next_tracer {0};
+
+	// Nanoseconds as the microseconds Chrome Trace Event timestamps are in
+	void Microseconds(std::ostringstream& out, const std::int64_t& ns) {
+		const std::int64_t fraction = ns % 1000;
+		out << ns / 1000 << '.' << static_cast<char>('0' + fraction / 100) << static_cast<char>('0' + fraction / 10 % 10) << static_cast<char>('0' + fraction % 10);
+	}
+}
+
+/**
+ * @brief Fixed-size run of events, written by one thread only.
+ */
+struct Tracer::Block {
+	struct Event {
+		std::int64_t time;											///< Nanoseconds since the tracer's origin.
+		std::uint64_t value;										///< Bytes, or span duration in nanoseconds.
+		std::uint32_t id;											///< Stage index or buffer id.
+		Kind kind;
+	};
+
+	static constexpr std::size_t Capacity = 1024;
+
+	std::array<Event, Capacity> events;
+	std::atomic<std::size_t> size {0};								///< Published events; stored after the event is written.
+	std::atomic<Block*> next {nullptr};								///< Following block, once this one is full.
+};
+
+/**
+ * @brief Events of one thread: a list of blocks appended to without locking.
+ */
+struct Tracer::Lane {
+	const std::size_t tid;											///< Thread number in the trace.
+	Block head;
+	Block* tail {&head};											///< Block being filled; owner thread only.
+
+	explicit Lane(const std::size_t& number) noexcept: tid(number) {}
+
+	~Lane() noexcept {
+		Block* block = head.next.load(std::memory_order_relaxed);
+		while (block) {
+			Block* next = block->next.load(std::memory_order_relaxed);
+			delete block;
+			block = next;
+		}
+	}
+};
+
+Tracer::Tracer() noexcept: m_id(++g_next_tracer), m_origin(std::chrono::steady_clock::now()) {}
+
+Tracer::~Tracer() noexcept = default;
+
+std::size_t Tracer::Dropped() const noexcept {
+	return m_dropped.load(std::memory_order_relaxed);
+}
+
+std::size_t Tracer::Events() const noexcept {
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	std::size_t count = 0;
+	for (const auto& [thread, lane]: m_lanes) {
+		for (const Block* block = &lane->head; block; block = block->next.load(std::memory_order_acquire))
+			count += block->size.load(std::memory_order_acquire);
+	}
+	return count;
+}
+
+std::string Tracer::Json() const {
+	std::ostringstream out;
+	out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+	bool first = true;
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	for (const auto& [thread, lane]: m_lanes) {
+		for (const Block* block = &lane->head; block; block = block->next.load(std::memory_order_acquire)) {
+			const std::size_t size = block->size.load(std::memory_order_acquire);
+			for (std::size_t i = 0; i < size; ++i) {
+				const Block::Event& event = block->events[i];
+				out << (first ? "\n" : ",\n");
+				first = false;
+				switch (event.kind) {
+					// Stages may return on another thread than they started on: async spans
+					case Kind::StageBegin:
+					case Kind::StageEnd:
+						out << "{\"name\":\"stage " << event.id << "\",\"cat\":\"stage\",\"ph\":\""
+							<< (event.kind == Kind::StageBegin ? 'b' : 'e') << "\",\"id\":" << event.id;
+						break;
+					case Kind::Read:
+					case Kind::Write:
+						out << "{\"name\":\"" << (event.kind == Kind::Read ? "read" : "write")
+							<< "\",\"cat\":\"buffer\",\"ph\":\"i\",\"s\":\"t\",\"args\":{\"buffer\":" << event.id << ",\"bytes\":" << event.value << '}';
+						break;
+					case Kind::ReadWait:
+					case Kind::WriteWait:
+						out << "{\"name\":\"" << (event.kind == Kind::ReadWait ? "wait read" : "wait write")
+							<< "\",\"cat\":\"wait\",\"ph\":\"X\",\"dur\":";
+						Microseconds(out, static_cast<std::int64_t>(event.value));
+						out << ",\"args\":{\"buffer\":" << event.id << '}';
+						break;
+					case Kind::Close:
+					case Kind::Error:
+						out << "{\"name\":\"" << (event.kind == Kind::Close ? "close" : "error")
+							<< "\",\"cat\":\"buffer\",\"ph\":\"i\",\"s\":\"t\",\"args\":{\"buffer\":" << event.id << '}';
+						break;
+				}
+				out << ",\"ts\":";
+				Microseconds(out, event.time);
+				out << ",\"pid\":1,\"tid\":" << lane->tid << '}';
+			}
+		}
+	}
+	out << "\n]}\n";
+	return out.str();
+}
+
+void Tracer::Record(const Kind& kind, const std::uint32_t& id, const std::uint64_t& bytes) noexcept {
+	Push(kind, id, bytes, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_origin).count());
+}
+
+void Tracer::RecordSpan(const Kind& kind, const std::uint32_t& id, const std::chrono::steady_clock::time_point& start) noexcept {
+	const auto now = std::chrono::steady_clock::now();
+	Push(kind, id, std::chrono::duration_cast<std::chrono::nanoseconds>(now - start).count(),
+		std::chrono::duration_cast<std::chrono::nanoseconds>(start - m_origin).count());
+}
+
+bool Tracer::Save(const std::string& path) const noexcept {
+	try {
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		if (!file)
+			return false;
+		file << Json();
+		file.close();
+		return static_cast<bool>(file);
+	}
+	catch (...) {
+		return false;
+	}
+}
+
+Tracer::Lane* Tracer::Local() noexcept {
+	// Last tracer used by this thread; ids are never reused, so a stale entry cannot match
+	struct Cache {
+		std::uint64_t tracer {0};
+		Lane* lane {nullptr};
+	};
+	thread_local Cache cache;
+	if (cache.tracer == m_id)
+		return cache.lane;
+
+	std::scoped_lock<std::mutex> lock(m_mutex);
+	try {
+		std::unique_ptr<Lane>& lane = m_lanes[std::this_thread::get_id()];
+		if (!lane)
+			lane = std::make_unique<Lane>(m_lanes.size());
+		cache = { m_id, lane.get() };
+		return lane.get();
+	}
+	catch (...) {
+		return nullptr;
+	}
+}
+
+void Tracer::Push(const Kind& kind, const std::uint32_t& id, const std::uint64_t& value, const std::int64_t& time) noexcept {
+	Lane* lane = Local();
+	if (!lane) {
+		m_dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+	Block* block = lane->tail;
+	std::size_t size = block->size.load(std::memory_order_relaxed);
+	if (size == Block::Capacity) {
+		Block* next = new (std::nothrow) Block();
+		if (!next) {
+			m_dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		block->next.store(next, std::memory_order_release);
+		lane->tail = block = next;
+		size = 0;
+	}
+	block->events[size] = { time, value, id, kind };
+	block->size.store(size + 1, std::memory_order_release);
+}
\ No newline at end of file
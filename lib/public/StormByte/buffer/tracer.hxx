@@ -0,0 +1,163 @@
+#pragma once
+
+#include <StormByte/buffer/visibility.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class Tracer
+	 * @brief Timeline recorder exporting Chrome Trace Event JSON.
+	 *
+	 * @par Overview
+	 *  A Tracer collects timestamped events: pipeline stages starting and
+	 *  returning, reads and writes with their size, blocking waits, closes and
+	 *  errors. @ref Save() writes them as a Chrome Trace Event file, which
+	 *  chrome://tracing and ui.perfetto.dev open directly: one row per thread,
+	 *  one span per stage and per wait.
+	 *
+	 * @par Recording
+	 *  Every thread appends to its own buffer, a list of fixed-size blocks it
+	 *  alone writes to, and publishes each event with a single atomic store;
+	 *  recording takes no lock and never waits for a reader. The first event of
+	 *  a thread registers its buffer under a mutex. A thread keeps the buffer of
+	 *  the tracer it used last, so alternating between tracers on one thread
+	 *  takes that mutex on every switch.
+	 *
+	 * @par Thread safety
+	 *  @ref Record() and @ref RecordSpan() may be called from any thread.
+	 *  @ref Json() and @ref Save() may run while events are recorded; they see
+	 *  the events published so far. Events are kept until the tracer is destroyed.
+	 *
+	 * @see SharedFIFO::EnableTracing(), Pipeline::SetTracer()
+	 */
+	class STORMBYTE_BUFFER_PUBLIC Tracer final {
+		public:
+			/**
+			 * @brief What an event records.
+			 */
+			enum class Kind: std::uint8_t {
+				StageBegin,											///< A stage started; @c id is the stage index.
+				StageEnd,											///< A stage returned; @c id is the stage index.
+				Read,												///< Bytes consumed from buffer @c id.
+				Write,												///< Bytes appended to buffer @c id.
+				ReadWait,											///< Span a reader blocked on buffer @c id.
+				WriteWait,											///< Span a writer blocked on buffer @c id.
+				Close,												///< Buffer @c id closed for writes.
+				Error												///< Buffer @c id set to error.
+			};
+
+			/**
+			 * @brief Create an empty tracer; its clock starts now.
+			 */
+			Tracer() noexcept;
+
+			/**
+			 * @brief Copy constructor deleted.
+			 */
+			Tracer(const Tracer&)										= delete;
+
+			/**
+			 * @brief Move constructor deleted.
+			 */
+			Tracer(Tracer&&)											= delete;
+
+			/**
+			 * @brief Free every recorded event.
+			 */
+			~Tracer() noexcept;
+
+			/**
+			 * @brief Copy assignment deleted.
+			 */
+			Tracer& operator=(const Tracer&)							= delete;
+
+			/**
+			 * @brief Move assignment deleted.
+			 */
+			Tracer& operator=(Tracer&&)									= delete;
+
+			/**
+			 * @brief Number of events lost because a block could not be allocated.
+			 * @return Dropped event count.
+			 */
+			std::size_t 												Dropped() const noexcept;
+
+			/**
+			 * @brief Number of events recorded so far.
+			 * @return Published event count, over every thread.
+			 */
+			std::size_t 												Events() const noexcept;
+
+			/**
+			 * @brief Render the events as Chrome Trace Event JSON.
+			 * @return JSON object with a @c traceEvents array; timestamps are
+			 *         microseconds since the tracer was created.
+			 */
+			std::string 												Json() const;
+
+			/**
+			 * @brief Record an event happening now.
+			 * @param kind What happened.
+			 * @param id Stage index or buffer id, depending on @p kind.
+			 * @param bytes Size of a read or write.
+			 */
+			void 														Record(const Kind& kind, const std::uint32_t& id, const std::uint64_t& bytes = 0) noexcept;
+
+			/**
+			 * @brief Record an event that started at @p start and ends now (waits).
+			 * @param kind What happened.
+			 * @param id Buffer id.
+			 * @param start When it started.
+			 */
+			void 														RecordSpan(const Kind& kind, const std::uint32_t& id, const std::chrono::steady_clock::time_point& start) noexcept;
+
+			/**
+			 * @brief Write @ref Json() to a file.
+			 * @param path File to create or truncate.
+			 * @return false if the file could not be written.
+			 */
+			bool 														Save(const std::string& path) const noexcept;
+
+		private:
+			struct Block;												///< Fixed-size run of events.
+			struct Lane;												///< Events of one thread.
+
+			const std::uint64_t m_id;									///< Process-unique id, keys the per-thread cache.
+			const std::chrono::steady_clock::time_point m_origin;		///< Time zero of the trace.
+			mutable std::mutex m_mutex;									///< Guards @c m_lanes.
+			std::unordered_map<std::thread::id, std::unique_ptr<Lane>> m_lanes;	///< Lanes by thread.
+			std::atomic<std::size_t> m_dropped {0};						///< Events lost to allocation failures.
+
+			/**
+			 * @brief Lane of the calling thread, registering it on first use.
+			 * @return Lane, or null if it could not be allocated.
+			 */
+			Lane* 														Local() noexcept;
+
+			/**
+			 * @brief Append an event to the calling thread's lane.
+			 * @param kind What happened.
+			 * @param id Stage index or buffer id.
+			 * @param value Bytes, or duration of a span in nanoseconds.
+			 * @param time Start, in nanoseconds since @c m_origin.
+			 */
+			void 														Push(const Kind& kind, const std::uint32_t& id, const std::uint64_t& value, const std::int64_t& time) noexcept;
+	};
+}
@@ -8,6 +8,7 @@
 #include <functional>
 #include <memory>
 #include <span>
+#include <stop_token>
 #include <vector>
 
 /**
@@ -20,6 +21,8 @@
  */
 namespace StormByte::Buffer {
 	class Consumer;					///< Forward declaration of Consumer class.
+	class Executor;					///< Forward declaration of Executor class.
+	class PipeTask;					///< Forward declaration of PipeTask class.
 	class Producer;					///< Forward declaration of Producer class.
 	class ReadOnly;					///< Forward declaration of ReadOnly class.
 	class WriteOnly;				///< Forward declaration of WriteOnly class.
@@ -69,22 +72,99 @@ namespace StormByte::Buffer {
 	 */
 	using PipeFunction = std::function<void(Consumer, Producer, std::shared_ptr<Logger::Log>)>;
 
+	/**
+	 * @brief Type alias for pipeline stages that observe cancellation.
+	 *
+	 * @details Same role as PipeFunction, plus the run's stop token. A stage doing
+	 *          long computations checks @c stop_requested() between steps, a
+	 *          single atomic load, and returns once it is set; a stage waiting on
+	 *          its input or output is woken by the cancellation itself.
+	 *
+	 * @see Execution::Cancel(), Pipeline::AddPipe()
+	 */
+	using CancellablePipeFunction = std::function<void(Consumer, Producer, std::shared_ptr<Logger::Log>, std::stop_token)>;
+
+	/**
+	 * @brief Type alias for cooperative pipeline stages written as coroutines.
+	 *
+	 * @details Same role as PipeFunction, but the stage waits for its input or
+	 *          output with @c co_await (Consumer::ExtractSomeAsync(),
+	 *          Producer::WriteAsync(), ...) passing the executor it receives, so
+	 *          it releases its thread while waiting instead of blocking it.
+	 *
+	 * @see PipeTask, Pipeline::AddAsyncPipe()
+	 */
+	using AsyncPipeFunction = std::function<PipeTask(Consumer, Producer, std::shared_ptr<Logger::Log>, std::shared_ptr<Executor>)>;
+
+	/**
+	 * @brief Type alias for graph nodes combining several inputs into one output.
+	 *
+	 * @details Receives one Consumer per input, in the order the inputs were
+	 *          given to Graph::AddMerge().
+	 *
+	 * @see Graph::AddMerge()
+	 */
+	using MergeFunction = std::function<void(std::vector<Consumer>, Producer, std::shared_ptr<Logger::Log>)>;
+
+	/**
+	 * @brief Type alias for graph nodes routing one input to several outputs.
+	 *
+	 * @details Receives one Producer per output, in the order of the stream ids
+	 *          returned by Graph::AddSplit().
+	 *
+	 * @see Graph::AddSplit()
+	 */
+	using SplitFunction = std::function<void(Consumer, std::vector<Producer>, std::shared_ptr<Logger::Log>)>;
+
 	/**
 	 * @brief Execution mode selector for pipeline processing.
 	 *
 	 * @details Defines how pipeline stages are scheduled when invoking
 	 *          Pipeline::Process(). Use to control concurrency behavior:
-	 *          - ExecutionMode::Sync  : All stages execute sequentially in the
-	 *                                   caller's thread (no detached threads).
-	 *          - ExecutionMode::Async : Each stage executes concurrently in its
-	 *                                   own detached thread (previous default behavior).
+	 *          - ExecutionMode::Sync  : All stages execute in the caller's thread;
+	 *                                   coroutine stages interleave cooperatively.
+	 *          - ExecutionMode::Async : Each stage executes concurrently on the
+	 *                                   pipeline's executor (see Pipeline::SetExecutor()).
+	 *
+	 *          In both modes an output a stage leaves open is closed once the
+	 *          stage returns, so the stages after it always see end of data.
 	 *
 	 * @note Async maximizes throughput via parallel stage execution; Sync can
 	 *       simplify debugging and deterministic ordering.
 	 * @see Pipeline::Process()
 	 */
 	enum class STORMBYTE_BUFFER_PUBLIC ExecutionMode {
-		Sync,   ///< Sequential single-threaded execution of all stages.
-		Async   ///< Concurrent detached-thread execution per stage.
+		Sync,   ///< Single-threaded execution of all stages in the caller's thread.
+		Async   ///< Concurrent execution of the stages on the pipeline executor.
+	};
+
+	/**
+	 * @brief Policy applied when a broadcast consumer lags too far behind.
+	 *
+	 * @details Used by BroadcastFIFO when a maximum lag is configured:
+	 *          - LagPolicy::Block : writers wait until the slowest consumer
+	 *                               catches up (backpressure).
+	 *          - LagPolicy::Drop  : consumers that would exceed the lag are
+	 *                               detached and observe an error state.
+	 * @see BroadcastFIFO
+	 */
+	enum class STORMBYTE_BUFFER_PUBLIC LagPolicy {
+		Block,  ///< Apply backpressure to writers.
+		Drop    ///< Detach slow consumers.
+	};
+
+	/**
+	 * @brief Order in which a ShardedFIFO reader drains its shards.
+	 *
+	 * @details Writes are always read whole and in order within one shard:
+	 *          - ShardOrder::RoundRobin : the reader takes one write from each
+	 *                                     non-empty shard in turn (fairness).
+	 *          - ShardOrder::Timestamp  : the reader takes the oldest write
+	 *                                     across all shards (global write order).
+	 * @see ShardedFIFO
+	 */
+	enum class STORMBYTE_BUFFER_PUBLIC ShardOrder {
+		RoundRobin, ///< One write per shard in turn.
+		Timestamp   ///< Oldest write first.
 	};
 }
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include <StormByte/buffer/work_stealing_pool.hxx>
+
+#include <algorithm>
+
+using namespace StormByte::Buffer;
+
+namespace {
+	/**
+	 * @brief Pool and index of the worker running on the current thread.
+	 */
+	struct Worker {
+		const WorkStealingPool* pool {nullptr};
+		std::size_t index {0};
+	};
+
+	thread_local Worker t_worker;
+}
+
+WorkStealingPool::WorkStealingPool(const std::size_t& threads) {
+	const std::size_t count = threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+	m_queues.reserve(count);
+	for (std::size_t i = 0; i < count; ++i)
+		m_queues.push_back(std::make_unique<Queue>());
+	m_workers.reserve(count);
+	try {
+		for (std::size_t i = 0; i < count; ++i)
+			m_workers.emplace_back([this, i]() { Work(i); });
+	}
+	catch (...) {
+		{
+			std::scoped_lock<std::mutex> lock(m_mutex);
+			m_stop = true;
+		}
+		m_cv.notify_all();
+		for (std::thread& worker: m_workers)
+			worker.join();
+		throw;
+	}
+}
+
+WorkStealingPool::~WorkStealingPool() noexcept {
+	{
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_cv.notify_all();
+	for (std::thread& worker: m_workers)
+		worker.join();
+}
+
+void WorkStealingPool::Post(std::function<void()> task) {
+	Queue& queue = t_worker.pool == this ? *m_queues[t_worker.index] : m_shared;
+	// Counted first so the count never drops below the queued tasks
+	m_pending.fetch_add(1);
+	try {
+		std::scoped_lock<std::mutex> lock(queue.mutex);
+		queue.tasks.push_back(std::move(task));
+	}
+	catch (...) {
+		m_pending.fetch_sub(1);
+		throw;
+	}
+	// Pairs with the check in Work(): either the sleeper sees the task or we see the sleeper
+	if (m_sleeping.load() > 0) {
+		std::scoped_lock<std::mutex> lock(m_mutex);
+		m_cv.notify_one();
+	}
+}
+
+std::shared_ptr<WorkStealingPool> WorkStealingPool::Shared() {
+	static std::shared_ptr<WorkStealingPool> pool = std::make_shared<WorkStealingPool>();
+	return pool;
+}
+
+std::size_t WorkStealingPool::Steals() const noexcept {
+	return m_steals.load(std::memory_order_relaxed);
+}
+
+std::size_t WorkStealingPool::Capacity() const noexcept {
+	return m_workers.size();
+}
+
+std::size_t WorkStealingPool::Threads() const noexcept {
+	return m_workers.size();
+}
+
+bool WorkStealingPool::Take(const std::size_t& index, std::function<void()>& task) noexcept {
+	const auto pop_front = [&task](Queue& queue) {
+		std::scoped_lock<std::mutex> lock(queue.mutex);
+		if (queue.tasks.empty())
+			return false;
+		task = std::move(queue.tasks.front());
+		queue.tasks.pop_front();
+		return true;
+	};
+
+	bool taken = pop_front(*m_queues[index]) || pop_front(m_shared);
+	for (std::size_t i = 1; !taken && i < m_queues.size(); ++i) {
+		Queue& victim = *m_queues[(index + i) % m_queues.size()];
+		std::scoped_lock<std::mutex> lock(victim.mutex);
+		if (!victim.tasks.empty()) {
+			task = std::move(victim.tasks.back());
+			victim.tasks.pop_back();
+			m_steals.fetch_add(1, std::memory_order_relaxed);
+			taken = true;
+		}
+	}
+	if (taken)
+		m_pending.fetch_sub(1);
+	return taken;
+}
+
+void WorkStealingPool::Work(const std::size_t& index) noexcept {
+	t_worker = { this, index };
+	std::function<void()> task;
+	while (true) {
+		if (Take(index, task)) {
+			try {
+				task();
+			}
+			catch (...) {
+				// Tasks report their own failures
+			}
+			task = nullptr;
+			continue;
+		}
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_sleeping.fetch_add(1);
+		m_cv.wait(lock, [this]() { return m_pending.load() > 0 || m_stop; });
+		m_sleeping.fetch_sub(1);
+		// Queued tasks are run before leaving, including those they post
+		if (m_stop && m_pending.load() == 0)
+			break;
+	}
+	t_worker = {};
+}
\ No newline at end of file
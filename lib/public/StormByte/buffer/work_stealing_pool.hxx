@@ -0,0 +1,140 @@
+#pragma once
+
+#include <StormByte/buffer/executor.hxx>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @namespace Buffer
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The Buffer namespace provides classes and utilities for byte buffers,
+ * including FIFO buffers, thread-safe shared buffers, producer-consumer
+ * interfaces, and multi-stage processing pipelines.
+ */
+namespace StormByte::Buffer {
+	/**
+	 * @class WorkStealingPool
+	 * @brief Executor with a fixed set of workers, each owning a task deque.
+	 *
+	 * @par Overview
+	 *  A task posted from a worker goes to that worker's deque, so a coroutine
+	 *  resumed by a write usually continues on the thread that wrote. Tasks
+	 *  posted from other threads go to a shared queue. A worker runs its own
+	 *  tasks in posting order, then the shared ones, and once both are empty
+	 *  steals the most recent task from another worker before going to sleep.
+	 *
+	 * @par Cooperative stages
+	 *  The pool never starts more threads than it was built with, so its tasks
+	 *  must not block: pipeline stages written as coroutines (AsyncPipeFunction)
+	 *  suspend instead of waiting, and any number of pipelines then shares the
+	 *  same workers. @ref Shared() is a pool with one worker per core.
+	 *
+	 * @par Thread safety
+	 *  @ref Post() may be called from any thread, including from tasks. The
+	 *  destructor runs every task still queued, then joins the workers; it must
+	 *  not be called from one of them.
+	 */
+	class STORMBYTE_BUFFER_PUBLIC WorkStealingPool final: public Executor {
+		public:
+			/**
+			 * @brief Start the pool.
+			 * @param threads Workers (0: hardware concurrency).
+			 */
+			explicit WorkStealingPool(const std::size_t& threads = 0);
+
+			/**
+			 * @brief Copy constructor deleted.
+			 */
+			WorkStealingPool(const WorkStealingPool&)					= delete;
+
+			/**
+			 * @brief Move constructor deleted.
+			 */
+			WorkStealingPool(WorkStealingPool&&)						= delete;
+
+			/**
+			 * @brief Run the queued tasks and join every worker.
+			 */
+			~WorkStealingPool() noexcept override;
+
+			/**
+			 * @brief Copy assignment deleted.
+			 */
+			WorkStealingPool& operator=(const WorkStealingPool&)		= delete;
+
+			/**
+			 * @brief Move assignment deleted.
+			 */
+			WorkStealingPool& operator=(WorkStealingPool&&)				= delete;
+
+			/**
+			 * @brief Queue @p task on the calling worker's deque, or on the shared queue.
+			 * @param task Task to run; exceptions it throws are discarded.
+			 */
+			void 														Post(std::function<void()> task) override;
+
+			/**
+			 * @brief Pool shared by every Pipeline running coroutine stages without its own executor.
+			 * @return Process-wide pool with one worker per core, created on first use.
+			 */
+			static std::shared_ptr<WorkStealingPool> 					Shared();
+
+			/**
+			 * @brief Number of tasks the pool can run at the same time.
+			 * @return Worker count, fixed on construction.
+			 */
+			std::size_t 												Capacity() const noexcept override;
+
+			/**
+			 * @brief Number of tasks taken from another worker's deque so far.
+			 * @return Steal count.
+			 */
+			std::size_t 												Steals() const noexcept;
+
+			/**
+			 * @brief Number of workers.
+			 * @return Worker count, fixed on construction.
+			 */
+			std::size_t 												Threads() const noexcept;
+
+		private:
+			/**
+			 * @brief Task deque guarded by its own mutex.
+			 */
+			struct Queue {
+				std::mutex mutex;										///< Protects @c tasks.
+				std::deque<std::function<void()>> tasks;				///< Queued tasks.
+			};
+
+			std::vector<std::unique_ptr<Queue>> m_queues;				///< One deque per worker.
+			Queue m_shared;												///< Tasks posted from outside the pool.
+			std::vector<std::thread> m_workers;							///< Worker threads.
+			std::mutex m_mutex;											///< Serializes sleeping and stopping.
+			std::condition_variable m_cv;								///< Wakes sleeping workers.
+			std::atomic<std::size_t> m_pending {0};						///< Tasks queued, not yet taken.
+			std::atomic<std::size_t> m_sleeping {0};					///< Workers waiting on @c m_cv.
+			std::atomic<std::size_t> m_steals {0};						///< Tasks stolen so far.
+			bool m_stop {false};										///< Set by the destructor.
+
+			/**
+			 * @brief Take the next task for a worker: its own, shared, then stolen.
+			 * @param index Worker index.
+			 * @param task Receives the task.
+			 * @return true if a task was taken.
+			 */
+			bool 														Take(const std::size_t& index, std::function<void()>& task) noexcept;
+
+			/**
+			 * @brief Worker loop.
+			 * @param index Worker index.
+			 */
+			void 														Work(const std::size_t& index) noexcept;
+	};
+}
@@ -0,0 +1,395 @@
+#include <StormByte/buffer/broadcast_fifo.hxx>
+#include <StormByte/buffer/message_fifo.hxx>
+#include <StormByte/buffer/producer.hxx>
+#include <StormByte/buffer/segmented_fifo.hxx>
+#include <StormByte/string.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using StormByte::Buffer::BroadcastFIFO;
+using StormByte::Buffer::Consumer;
+using StormByte::Buffer::DataType;
+using StormByte::Buffer::Executor;
+using StormByte::Buffer::MessageFIFO;
+using StormByte::Buffer::Producer;
+using StormByte::Buffer::SegmentedFIFO;
+using StormByte::Buffer::SharedFIFO;
+
+static std::string toString(const DataType& v) {
+	return StormByte::String::FromByteVector(v);
+}
+
+static DataType toData(const std::string& s) {
+	return StormByte::String::ToByteVector(s);
+}
+
+// Fire-and-forget coroutine: runs until its first suspension on creation
+struct Detached {
+	struct promise_type {
+		Detached get_return_object() noexcept { return {}; }
+		std::suspend_never initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() noexcept {}
+		void unhandled_exception() noexcept { std::terminate(); }
+	};
+};
+
+struct Outcome {
+	std::atomic<bool> done {false};
+	bool result {false};
+	std::string data;
+	std::thread::id thread;
+};
+
+static Detached readTask(Consumer consumer, std::size_t count, bool some, bool extract, Outcome& outcome, std::shared_ptr<Executor> executor = nullptr) {
+	DataType out;
+	if (some)
+		outcome.result = extract ? co_await consumer.ExtractSomeAsync(count, out, executor) : co_await consumer.ReadSomeAsync(count, out, executor);
+	else
+		outcome.result = extract ? co_await consumer.ExtractAsync(count, out, executor) : co_await consumer.ReadAsync(count, out, executor);
+	outcome.data = toString(out);
+	outcome.thread = std::this_thread::get_id();
+	outcome.done = true;
+}
+
+static Detached writeTask(Producer producer, std::string data, Outcome& outcome) {
+	outcome.result = co_await producer.WriteAsync(toData(data));
+	outcome.done = true;
+}
+
+static bool waitFor(const std::atomic<bool>& flag) {
+	for (int i = 0; i < 2000 && !flag.load(); ++i)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	return flag.load();
+}
+
+// Single worker thread running posted tasks in order
+class WorkerExecutor final: public Executor {
+	public:
+		WorkerExecutor(): m_thread([this]() { Run(); }) {}
+
+		~WorkerExecutor() noexcept override {
+			{
+				std::scoped_lock<std::mutex> lock(m_mutex);
+				m_stop = true;
+			}
+			m_cv.notify_all();
+			m_thread.join();
+		}
+
+		void Post(std::function<void()> task) override {
+			{
+				std::scoped_lock<std::mutex> lock(m_mutex);
+				m_tasks.push_back(std::move(task));
+			}
+			m_cv.notify_one();
+		}
+
+		std::thread::id Id() const noexcept {
+			return m_thread.get_id();
+		}
+
+	private:
+		std::mutex m_mutex;
+		std::condition_variable m_cv;
+		std::deque<std::function<void()>> m_tasks;
+		bool m_stop {false};
+		std::thread m_thread;
+
+		void Run() {
+			std::unique_lock<std::mutex> lock(m_mutex);
+			while (true) {
+				m_cv.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+				if (m_tasks.empty())
+					return;
+				auto task = std::move(m_tasks.front());
+				m_tasks.pop_front();
+				lock.unlock();
+				task();
+				lock.lock();
+			}
+		}
+};
+
+int test_read_async_completes_immediately() {
+	Producer producer;
+	Consumer consumer = producer.Consumer();
+	(void)producer.Write(std::string("Hello World"));
+
+	Outcome read;
+	readTask(consumer, 5, false, false, read);
+	ASSERT_TRUE("completed without suspending", read.done.load());
+	ASSERT_TRUE("result", read.result);
+	ASSERT_EQUAL("content", read.data, std::string("Hello"));
+
+	Outcome extract;
+	readTask(consumer, 0, false, true, extract);
+	ASSERT_TRUE("extract completed", extract.done.load());
+	ASSERT_EQUAL("extract content", extract.data, std::string(" World"));
+	ASSERT_EQUAL("extracted", consumer.AvailableBytes(), static_cast<std::size_t>(0));
+	RETURN_TEST("test_read_async_completes_immediately", 0);
+}
+
+int test_read_async_resumes_on_write() {
+	Producer producer;
+	Consumer consumer = producer.Consumer();
+
+	Outcome outcome;
+	readTask(consumer, 6, false, false, outcome);
+	ASSERT_FALSE("suspended", outcome.done.load());
+	(void)producer.Write(std::string("abc"));
+	ASSERT_FALSE("still short", outcome.done.load());
+	(void)producer.Write(std::string("def"));
+	ASSERT_TRUE("resumed by the write", outcome.done.load());
+	ASSERT_TRUE("result", outcome.result);
+	ASSERT_EQUAL("content", outcome.data, std::string("abcdef"));
+	ASSERT_TRUE("resumed inline", outcome.thread == std::this_thread::get_id());
+
+	std::thread writer([producer]() mutable {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		(void)producer.Write(std::string("from thread"));
+	});
+	Outcome threaded;
+	readTask(consumer, 11, false, true, threaded);
+	writer.join();
+	ASSERT_TRUE("resumed from another thread", waitFor(threaded.done));
+	ASSERT_EQUAL("threaded content", threaded.data, std::string("from thread"));
+	RETURN_TEST("test_read_async_resumes_on_write", 0);
+}
+
+int test_read_some_async() {
+	Producer producer;
+	Consumer consumer = producer.Consumer();
+
+	Outcome first;
+	readTask(consumer, 4, true, true, first);
+	ASSERT_FALSE("waits for a byte", first.done.load());
+	(void)producer.Write(std::string("xy"));
+	ASSERT_TRUE("any bytes complete", first.done.load());
+	ASSERT_EQUAL("partial", first.data, std::string("xy"));
+
+	(void)producer.Write(std::string("0123456789"));
+	Outcome second;
+	readTask(consumer, 4, true, false, second);
+	ASSERT_EQUAL("at most max", second.data, std::string("0123"));
+	Outcome rest;
+	readTask(consumer, 0, true, true, rest);
+	ASSERT_EQUAL("no maximum", rest.data, std::string("456789"));
+	RETURN_TEST("test_read_some_async", 0);
+}
+
+int test_async_close_and_error() {
+	Producer producer;
+	Consumer consumer = producer.Consumer();
+	(void)producer.Write(std::string("abc"));
+
+	Outcome short_read;
+	readTask(consumer, 10, false, true, short_read);
+	Outcome some;
+	readTask(consumer, 0, true, false, some);
+	ASSERT_FALSE("waiting for more", short_read.done.load());
+	ASSERT_EQUAL("some completes at once", some.data, std::string("abc"));
+
+	producer.Close();
+	ASSERT_TRUE("close resumes", short_read.done.load());
+	ASSERT_FALSE("not enough bytes", short_read.result);
+
+	Outcome drained;
+	readTask(consumer, 0, true, true, drained);
+	ASSERT_TRUE("closed and empty", drained.done.load());
+	ASSERT_FALSE("nothing left", drained.result);
+
+	Producer errored;
+	Consumer errored_consumer = errored.Consumer();
+	Outcome pending;
+	readTask(errored_consumer, 1, false, false, pending);
+	errored.SetError();
+	ASSERT_TRUE("error resumes", pending.done.load());
+	ASSERT_FALSE("error fails", pending.result);
+	RETURN_TEST("test_async_close_and_error", 0);
+}
+
+int test_bounded_write_async() {
+	auto fifo = std::make_shared<SharedFIFO>(8);
+	ASSERT_EQUAL("limit", fifo->Limit(), static_cast<std::size_t>(8));
+	Producer producer(fifo);
+	Consumer consumer = producer.Consumer();
+
+	(void)producer.Write(std::string("123456"));
+	Outcome write;
+	writeTask(producer, "abcd", write);
+	ASSERT_FALSE("full: suspended", write.done.load());
+
+	DataType out;
+	ASSERT_TRUE("extract", consumer.Extract(3, out));
+	ASSERT_TRUE("resumed once room was freed", write.done.load());
+	ASSERT_TRUE("written", write.result);
+	ASSERT_EQUAL("size", consumer.Size(), static_cast<std::size_t>(7));
+
+	// Synchronous writes wait as well
+	std::atomic<bool> written {false};
+	std::thread writer([producer, &written]() mutable {
+		(void)producer.Write(std::string("XYZ"));
+		written = true;
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	ASSERT_FALSE("blocked while full", written.load());
+	out.clear();
+	ASSERT_TRUE("drain", consumer.Extract(7, out));
+	writer.join();
+	ASSERT_EQUAL("order kept", toString(out), std::string("456abcd"));
+
+	// Larger than the limit fits an empty buffer only
+	out.clear();
+	ASSERT_TRUE("drain rest", consumer.Extract(0, out));
+	Outcome large;
+	writeTask(producer, "0123456789", large);
+	ASSERT_TRUE("large write into empty buffer", large.done.load() && large.result);
+	Outcome rejected;
+	writeTask(producer, "z", rejected);
+	ASSERT_FALSE("waits behind the large write", rejected.done.load());
+	producer.Close();
+	ASSERT_TRUE("close resumes writer", rejected.done.load());
+	ASSERT_FALSE("rejected", rejected.result);
+
+	Producer unbounded;
+	Outcome immediate;
+	writeTask(unbounded, "free", immediate);
+	ASSERT_TRUE("unbounded completes", immediate.done.load() && immediate.result);
+	RETURN_TEST("test_bounded_write_async", 0);
+}
+
+int test_bounded_read_async_beyond_limit() {
+	auto fifo = std::make_shared<SharedFIFO>(4);
+	Producer producer(fifo);
+	Consumer consumer = producer.Consumer();
+
+	// Waiting for more than the limit lets writers past it until the bytes are there
+	Outcome read;
+	readTask(consumer, 10, false, true, read);
+	ASSERT_FALSE("suspended", read.done.load());
+	std::thread writer([producer]() mutable {
+		for (int i = 0; i < 4; ++i)
+			(void)producer.Write(std::string("abc"));
+	});
+	ASSERT_TRUE("resumed", waitFor(read.done));
+	writer.join();
+	ASSERT_TRUE("read", read.result);
+	ASSERT_EQUAL("bytes", read.data, std::string("abcabcabca"));
+	RETURN_TEST("test_bounded_read_async_beyond_limit", 0);
+}
+
+int test_broadcast_lag_write_async() {
+	auto hub = std::make_shared<BroadcastFIFO>(8, StormByte::Buffer::LagPolicy::Block);
+	Producer producer(hub);
+	Consumer slow = producer.Consumer();
+
+	(void)producer.Write(std::string("123456"));
+	Outcome write;
+	writeTask(producer, "abcd", write);
+	ASSERT_FALSE("slowest cursor too far behind: suspended", write.done.load());
+	ASSERT_EQUAL("nothing appended", hub->Lag(), static_cast<std::size_t>(6));
+
+	DataType out;
+	ASSERT_TRUE("read", slow.Extract(3, out));
+	ASSERT_TRUE("resumed once the cursor caught up", write.done.load());
+	ASSERT_TRUE("written", write.result);
+	out.clear();
+	ASSERT_TRUE("rest", slow.Extract(7, out));
+	ASSERT_EQUAL("order kept", toString(out), std::string("456abcd"));
+
+	// Under Drop the write is never held back
+	auto dropping = std::make_shared<BroadcastFIFO>(8, StormByte::Buffer::LagPolicy::Drop);
+	Producer dropper(dropping);
+	Consumer lagging = dropper.Consumer();
+	(void)dropper.Write(std::string("123456"));
+	Outcome dropped;
+	writeTask(dropper, "abcd", dropped);
+	ASSERT_TRUE("written at once", dropped.done.load() && dropped.result);
+	ASSERT_TRUE("lagging cursor detached", lagging.HasError());
+	RETURN_TEST("test_broadcast_lag_write_async", 0);
+}
+
+int test_async_executor() {
+	auto executor = std::make_shared<WorkerExecutor>();
+	constexpr std::size_t streams = 64;
+	std::vector<Producer> producers(streams);
+	std::vector<Outcome> outcomes(streams);
+	for (std::size_t i = 0; i < streams; ++i)
+		readTask(producers[i].Consumer(), 4, false, true, outcomes[i], executor);
+
+	std::vector<std::thread> writers;
+	for (std::size_t w = 0; w < 4; ++w) {
+		writers.emplace_back([&, w]() {
+			for (std::size_t i = w; i < streams; i += 4) {
+				(void)producers[i].Write(std::string("ab"));
+				(void)producers[i].Write(std::string("cd"));
+			}
+		});
+	}
+	for (auto& t: writers)
+		t.join();
+
+	bool all = true;
+	for (auto& outcome: outcomes) {
+		if (!waitFor(outcome.done) || outcome.data != "abcd" || outcome.thread != executor->Id())
+			all = false;
+	}
+	ASSERT_TRUE("every stream resumed on the executor", all);
+	RETURN_TEST("test_async_executor", 0);
+}
+
+int test_async_variants() {
+	Producer message(std::make_shared<MessageFIFO>());
+	Outcome message_read;
+	readTask(message.Consumer(), 0, true, true, message_read);
+	(void)message.Write(std::string("msg"));
+	ASSERT_TRUE("message fifo", message_read.done.load() && message_read.data == "msg");
+
+	Producer segmented(std::make_shared<SegmentedFIFO>());
+	Outcome segmented_read;
+	readTask(segmented.Consumer(), 5, false, true, segmented_read);
+	(void)segmented.Write(std::string("seg"));
+	(void)segmented.Write(std::string("ment"));
+	ASSERT_TRUE("segmented fifo", segmented_read.done.load() && segmented_read.data == "segme");
+
+	Producer broadcast(std::make_shared<BroadcastFIFO>());
+	Outcome first, second;
+	readTask(broadcast.Consumer(), 4, false, true, first);
+	readTask(broadcast.Consumer(), 2, false, false, second);
+	(void)broadcast.Write(std::string("cast"));
+	ASSERT_TRUE("first cursor", first.done.load() && first.data == "cast");
+	ASSERT_TRUE("second cursor", second.done.load() && second.data == "ca");
+	RETURN_TEST("test_async_variants", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_read_async_completes_immediately();
+	result += test_read_async_resumes_on_write();
+	result += test_read_some_async();
+	result += test_async_close_and_error();
+	result += test_bounded_write_async();
+	result += test_bounded_read_async_beyond_limit();
+	result += test_broadcast_lag_write_async();
+	result += test_async_executor();
+	result += test_async_variants();
+
+	if (result == 0) {
+		std::cout << "Async tests passed!" << std::endl;
+	} else {
+		std::cout << result << " Async tests failed." << std::endl;
+	}
+	return result;
+}
@@ -0,0 +1,313 @@
+#include <StormByte/buffer/broadcast_fifo.hxx>
+#include <StormByte/buffer/producer.hxx>
+#include <StormByte/buffer/consumer.hxx>
+#include <StormByte/string.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using StormByte::Buffer::BroadcastFIFO;
+using StormByte::Buffer::Consumer;
+using StormByte::Buffer::DataType;
+using StormByte::Buffer::LagPolicy;
+using StormByte::Buffer::Position;
+using StormByte::Buffer::Producer;
+
+static std::string toString(const DataType& v) {
+	return StormByte::String::FromByteVector(v);
+}
+
+int test_broadcast_every_consumer_reads_everything() {
+	Producer producer(std::make_shared<BroadcastFIFO>());
+	Consumer a = producer.Consumer();
+	Consumer b = producer.Consumer();
+
+	(void)producer.Write(std::string("Hello "));
+	(void)producer.Write(std::string("World"));
+	producer.Close();
+
+	DataType out_a, out_b;
+	ASSERT_TRUE("consumer a read", a.Read(6, out_a));
+	ASSERT_TRUE("consumer a rest", a.Extract(0, out_a));
+	ASSERT_TRUE("consumer b read all", b.Read(0, out_b));
+	ASSERT_EQUAL("consumer a content", toString(out_a), std::string("Hello World"));
+	ASSERT_EQUAL("consumer b content", toString(out_b), std::string("Hello World"));
+	ASSERT_TRUE("consumer a eof", a.EoF());
+	ASSERT_TRUE("consumer b eof", b.EoF());
+	RETURN_TEST("test_broadcast_every_consumer_reads_everything", 0);
+}
+
+int test_broadcast_consumer_copies_share_cursor() {
+	Producer producer(std::make_shared<BroadcastFIFO>());
+	Consumer a = producer.Consumer();
+	Consumer a_copy = a;
+
+	(void)producer.Write(std::string("ABCDEF"));
+
+	DataType first, second;
+	ASSERT_TRUE("first half", a.Read(3, first));
+	ASSERT_TRUE("second half through copy", a_copy.Read(3, second));
+	ASSERT_EQUAL("first content", toString(first), std::string("ABC"));
+	ASSERT_EQUAL("second content", toString(second), std::string("DEF"));
+	RETURN_TEST("test_broadcast_consumer_copies_share_cursor", 0);
+}
+
+int test_broadcast_reclaims_after_slowest() {
+	auto hub = std::make_shared<BroadcastFIFO>();
+	Producer producer(hub);
+	Consumer fast = producer.Consumer();
+	Consumer slow = producer.Consumer();
+
+	(void)producer.Write(std::string("0123456789"));
+	ASSERT_EQUAL("retained after write", hub->Size(), static_cast<std::size_t>(10));
+
+	DataType out;
+	ASSERT_TRUE("fast reads all", fast.Read(10, out));
+	ASSERT_EQUAL("still retained for slow", hub->Size(), static_cast<std::size_t>(10));
+	ASSERT_EQUAL("lag is slow cursor", hub->Lag(), static_cast<std::size_t>(10));
+
+	out.clear();
+	ASSERT_TRUE("slow reads all", slow.Read(10, out));
+	ASSERT_EQUAL("released after slowest", hub->Size(), static_cast<std::size_t>(0));
+	ASSERT_TRUE("hub empty", hub->Empty());
+	RETURN_TEST("test_broadcast_reclaims_after_slowest", 0);
+}
+
+int test_broadcast_retains_without_subscribers() {
+	auto hub = std::make_shared<BroadcastFIFO>();
+	Producer producer(hub);
+
+	(void)producer.Write(std::string("early"));
+	ASSERT_EQUAL("no subscribers yet", hub->Subscribers(), static_cast<std::size_t>(0));
+
+	Consumer late = producer.Consumer();
+	DataType out;
+	ASSERT_TRUE("late consumer sees retained data", late.Read(5, out));
+	ASSERT_EQUAL("late content", toString(out), std::string("early"));
+	RETURN_TEST("test_broadcast_retains_without_subscribers", 0);
+}
+
+int test_broadcast_detach_on_destruction_releases() {
+	auto hub = std::make_shared<BroadcastFIFO>();
+	Producer producer(hub);
+	Consumer fast = producer.Consumer();
+
+	(void)producer.Write(std::string("payload"));
+	{
+		Consumer idle = producer.Consumer();
+		DataType out;
+		ASSERT_TRUE("fast read", fast.Read(7, out));
+		ASSERT_EQUAL("held by idle", hub->Size(), static_cast<std::size_t>(7));
+		ASSERT_EQUAL("two subscribers", hub->Subscribers(), static_cast<std::size_t>(2));
+	}
+	ASSERT_EQUAL("one subscriber", hub->Subscribers(), static_cast<std::size_t>(1));
+	ASSERT_EQUAL("released after detach", hub->Size(), static_cast<std::size_t>(0));
+	RETURN_TEST("test_broadcast_detach_on_destruction_releases", 0);
+}
+
+int test_broadcast_seek_back_over_retained() {
+	Producer producer(std::make_shared<BroadcastFIFO>());
+	Consumer a = producer.Consumer();
+	Consumer b = producer.Consumer();
+
+	(void)producer.Write(std::string("ABCDEF"));
+	DataType out;
+	ASSERT_TRUE("a reads", a.Read(4, out));
+	a.Seek(-2, Position::Relative);
+	out.clear();
+	ASSERT_TRUE("a rereads", a.Read(2, out));
+	ASSERT_EQUAL("reread content", toString(out), std::string("CD"));
+
+	out.clear();
+	ASSERT_TRUE("b peeks", b.Peek(2, out));
+	ASSERT_EQUAL("peek content", toString(out), std::string("AB"));
+	ASSERT_EQUAL("peek keeps position", b.AvailableBytes(), static_cast<std::size_t>(6));
+	RETURN_TEST("test_broadcast_seek_back_over_retained", 0);
+}
+
+int test_broadcast_lag_block_backpressure() {
+	auto hub = std::make_shared<BroadcastFIFO>(8, LagPolicy::Block);
+	Producer producer(hub);
+	Consumer fast = producer.Consumer();
+	Consumer slow = producer.Consumer();
+
+	std::atomic<bool> writer_done{false};
+	std::thread writer([&]() {
+		for (int i = 0; i < 8; ++i)
+			(void)producer.Write(std::string("abcd"));
+		producer.Close();
+		writer_done = true;
+	});
+
+	DataType fast_out;
+	std::thread fast_reader([&]() {
+		fast.ExtractUntilEoF(fast_out);
+	});
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	ASSERT_FALSE("writer held back by slow consumer", writer_done.load());
+	ASSERT_TRUE("lag within limit", hub->Lag() <= 8);
+
+	DataType slow_out;
+	slow.ExtractUntilEoF(slow_out);
+	writer.join();
+	fast_reader.join();
+
+	ASSERT_EQUAL("slow got everything", slow_out.size(), static_cast<std::size_t>(32));
+	ASSERT_EQUAL("fast got everything", fast_out.size(), static_cast<std::size_t>(32));
+	ASSERT_EQUAL("all released", hub->Size(), static_cast<std::size_t>(0));
+	RETURN_TEST("test_broadcast_lag_block_backpressure", 0);
+}
+
+int test_broadcast_lag_drop_slow_reader() {
+	auto hub = std::make_shared<BroadcastFIFO>(8, LagPolicy::Drop);
+	Producer producer(hub);
+	Consumer fast = producer.Consumer();
+	Consumer slow = producer.Consumer();
+
+	DataType out;
+	for (int i = 0; i < 4; ++i) {
+		ASSERT_TRUE("write succeeds", producer.Write(std::string("abcd")));
+		ASSERT_TRUE("fast keeps up", fast.Read(4, out));
+	}
+	ASSERT_TRUE("slow detached", slow.HasError());
+	ASSERT_TRUE("slow at eof", slow.EoF());
+	ASSERT_FALSE("fast still fine", fast.HasError());
+	ASSERT_EQUAL("single subscriber left", hub->Subscribers(), static_cast<std::size_t>(1));
+	ASSERT_EQUAL("nothing held for dropped reader", hub->Size(), static_cast<std::size_t>(0));
+
+	DataType slow_out;
+	ASSERT_FALSE("slow read fails", slow.Read(1, slow_out));
+	RETURN_TEST("test_broadcast_lag_drop_slow_reader", 0);
+}
+
+int test_broadcast_lag_drop_fires_callbacks() {
+	auto hub = std::make_shared<BroadcastFIFO>(8, LagPolicy::Drop);
+	Producer producer(hub);
+	Consumer fast = producer.Consumer();
+	Consumer slow = producer.Consumer();
+
+	bool errored = false, readable = false;
+	(void)slow.OnError([&errored]() { errored = true; });
+	(void)slow.OnReadable(100, [&readable]() { readable = true; });
+
+	DataType out;
+	for (int i = 0; i < 4; ++i) {
+		ASSERT_TRUE("write succeeds", producer.Write(std::string("abcd")));
+		ASSERT_TRUE("fast keeps up", fast.Read(4, out));
+	}
+	ASSERT_TRUE("slow detached", slow.HasError());
+	ASSERT_TRUE("error callback fired", errored);
+	ASSERT_TRUE("readable callback fired", readable);
+	RETURN_TEST("test_broadcast_lag_drop_fires_callbacks", 0);
+}
+
+int test_broadcast_close_wakes_all_consumers() {
+	Producer producer(std::make_shared<BroadcastFIFO>());
+	Consumer a = producer.Consumer();
+	Consumer b = producer.Consumer();
+
+	std::atomic<int> failed{0};
+	auto wait_more = [&](Consumer c) {
+		DataType out;
+		if (!c.Read(100, out))
+			++failed;
+	};
+	std::thread ta(wait_more, a);
+	std::thread tb(wait_more, b);
+
+	(void)producer.Write(std::string("short"));
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	producer.Close();
+	ta.join();
+	tb.join();
+
+	ASSERT_EQUAL("both reads gave up", failed.load(), 2);
+	ASSERT_FALSE("a still has bytes", a.EoF());
+	ASSERT_EQUAL("a available", a.AvailableBytes(), static_cast<std::size_t>(5));
+	ASSERT_TRUE("write after close fails", !producer.Write(std::string("x")));
+	RETURN_TEST("test_broadcast_close_wakes_all_consumers", 0);
+}
+
+int test_broadcast_error_propagates() {
+	Producer producer(std::make_shared<BroadcastFIFO>());
+	Consumer a = producer.Consumer();
+	Consumer b = producer.Consumer();
+
+	(void)producer.Write(std::string("data"));
+	producer.SetError();
+	ASSERT_TRUE("a sees error", a.HasError());
+	ASSERT_TRUE("b sees error", b.HasError());
+	ASSERT_TRUE("a at eof", a.EoF());
+	ASSERT_FALSE("producer not writable", producer.IsWritable());
+	RETURN_TEST("test_broadcast_error_propagates", 0);
+}
+
+int test_broadcast_threaded_fan_out() {
+	Producer producer(std::make_shared<BroadcastFIFO>(1024, LagPolicy::Block));
+	constexpr int consumers = 4;
+	constexpr std::size_t total = 64 * 1024;
+
+	std::vector<Consumer> views;
+	for (int i = 0; i < consumers; ++i)
+		views.push_back(producer.Consumer());
+
+	std::vector<std::size_t> sums(consumers, 0);
+	std::vector<std::thread> readers;
+	for (int i = 0; i < consumers; ++i) {
+		readers.emplace_back([&, i]() {
+			DataType chunk;
+			while (views[i].Extract(0, chunk) || !views[i].EoF()) {
+				for (std::byte b: chunk)
+					sums[i] += std::to_integer<unsigned char>(b);
+				chunk.clear();
+				std::this_thread::yield();
+			}
+		});
+	}
+
+	std::size_t expected = 0;
+	for (std::size_t i = 0; i < total; i += 256) {
+		DataType block(256);
+		for (std::size_t j = 0; j < block.size(); ++j) {
+			block[j] = static_cast<std::byte>((i + j) & 0xFF);
+			expected += (i + j) & 0xFF;
+		}
+		(void)producer.Write(std::move(block));
+	}
+	producer.Close();
+	for (auto& t: readers)
+		t.join();
+
+	for (int i = 0; i < consumers; ++i)
+		ASSERT_EQUAL("consumer checksum", sums[i], expected);
+	RETURN_TEST("test_broadcast_threaded_fan_out", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_broadcast_every_consumer_reads_everything();
+	result += test_broadcast_consumer_copies_share_cursor();
+	result += test_broadcast_reclaims_after_slowest();
+	result += test_broadcast_retains_without_subscribers();
+	result += test_broadcast_detach_on_destruction_releases();
+	result += test_broadcast_seek_back_over_retained();
+	result += test_broadcast_lag_block_backpressure();
+	result += test_broadcast_lag_drop_slow_reader();
+	result += test_broadcast_lag_drop_fires_callbacks();
+	result += test_broadcast_close_wakes_all_consumers();
+	result += test_broadcast_error_propagates();
+	result += test_broadcast_threaded_fan_out();
+
+	if (result == 0) {
+		std::cout << "BroadcastFIFO tests passed!" << std::endl;
+	} else {
+		std::cout << result << " BroadcastFIFO tests failed." << std::endl;
+	}
+	return result;
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+#include <StormByte/buffer/consumer_set.hxx>
+#include <StormByte/buffer/producer.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <algorithm>
+#include <iostream>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <vector>
+
+using StormByte::Buffer::Consumer;
+using StormByte::Buffer::ConsumerSet;
+using StormByte::Buffer::DataType;
+using StormByte::Buffer::Producer;
+
+int test_consumer_set_select_ready() {
+	Producer first, second;
+	ConsumerSet set;
+	const std::size_t a = set.Add(first.Consumer());
+	const std::size_t b = set.Add(second.Consumer(), 4);
+	ASSERT_EQUAL("ids in order", a, static_cast<std::size_t>(0));
+	ASSERT_EQUAL("ids in order", b, static_cast<std::size_t>(1));
+	ASSERT_EQUAL("size", set.Size(), static_cast<std::size_t>(2));
+	ASSERT_TRUE("nothing ready", set.Select(std::chrono::milliseconds(10)).empty());
+
+	(void)second.Write(std::string("ab"));
+	ASSERT_TRUE("below minimum", set.Select(std::chrono::milliseconds(10)).empty());
+	(void)second.Write(std::string("cd"));
+	auto ready = set.Select();
+	ASSERT_EQUAL("one ready", ready.size(), static_cast<std::size_t>(1));
+	ASSERT_EQUAL("second ready", ready[0], b);
+	RETURN_TEST("test_consumer_set_select_ready", 0);
+}
+
+int test_consumer_set_level_triggered() {
+	Producer producer;
+	Consumer consumer = producer.Consumer();
+	ConsumerSet set;
+	const std::size_t id = set.Add(consumer);
+
+	(void)producer.Write(std::string("abcd"));
+	ASSERT_EQUAL("ready", set.Select().size(), static_cast<std::size_t>(1));
+	ASSERT_EQUAL("still ready while not drained", set.Select(std::chrono::milliseconds(10)).size(), static_cast<std::size_t>(1));
+	DataType out;
+	ASSERT_TRUE("drain", consumer.Extract(4, out));
+	ASSERT_TRUE("drained", set.Select(std::chrono::milliseconds(10)).empty());
+
+	producer.Close();
+	auto ready = set.Select();
+	ASSERT_EQUAL("end of stream is ready", ready.size(), static_cast<std::size_t>(1));
+	ASSERT_EQUAL("ready id", ready[0], id);
+	ASSERT_TRUE("remove", set.Remove(id));
+	ASSERT_FALSE("removed twice", set.Remove(id));
+	ASSERT_TRUE("empty", set.Empty());
+	ASSERT_TRUE("empty set selects nothing", set.Select().empty());
+	RETURN_TEST("test_consumer_set_level_triggered", 0);
+}
+
+int test_consumer_set_error() {
+	Producer producer;
+	ConsumerSet set;
+	(void)set.Add(producer.Consumer());
+	std::thread failing([&producer]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		producer.SetError();
+	});
+	const auto ready = set.Select();
+	failing.join();
+	ASSERT_EQUAL("error wakes select", ready.size(), static_cast<std::size_t>(1));
+	RETURN_TEST("test_consumer_set_error", 0);
+}
+
+int test_consumer_set_stop() {
+	Producer producer;
+	ConsumerSet set;
+	(void)set.Add(producer.Consumer());
+	std::stop_source source;
+	std::thread stopping([&source]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		(void)source.request_stop();
+	});
+	ASSERT_TRUE("stop wakes select", set.Select(source.get_token()).empty());
+	stopping.join();
+	ASSERT_TRUE("already stopped", set.Select(source.get_token()).empty());
+
+	(void)producer.Write(std::string("a"));
+	ASSERT_EQUAL("ready members still reported", set.Select(source.get_token()).size(), static_cast<std::size_t>(1));
+	ASSERT_FALSE("buffer untouched", producer.HasError());
+	RETURN_TEST("test_consumer_set_stop", 0);
+}
+
+int test_consumer_set_merge() {
+	constexpr std::size_t inputs = 64;
+	std::vector<Producer> producers(inputs);
+	std::vector<Consumer> consumers;
+	ConsumerSet set;
+	for (auto& producer: producers) {
+		consumers.push_back(producer.Consumer());
+		(void)set.Add(consumers.back());
+	}
+
+	std::vector<std::thread> writers;
+	for (std::size_t w = 0; w < 4; ++w) {
+		writers.emplace_back([&producers, w]() {
+			for (int round = 0; round < 50; ++round)
+				for (std::size_t i = w; i < producers.size(); i += 4)
+					(void)producers[i].Write(std::string("0123456789"));
+			for (std::size_t i = w; i < producers.size(); i += 4)
+				producers[i].Close();
+		});
+	}
+
+	// One thread merges every input
+	std::size_t received = 0;
+	while (!set.Empty()) {
+		for (const std::size_t& id: set.Select()) {
+			DataType out;
+			if (consumers[id].Extract(consumers[id].AvailableBytes(), out))
+				received += out.size();
+			if (consumers[id].EoF())
+				(void)set.Remove(id);
+		}
+	}
+	for (auto& writer: writers)
+		writer.join();
+	ASSERT_EQUAL("every byte merged", received, inputs * 50 * 10);
+	RETURN_TEST("test_consumer_set_merge", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_consumer_set_select_ready();
+	result += test_consumer_set_level_triggered();
+	result += test_consumer_set_error();
+	result += test_consumer_set_stop();
+	result += test_consumer_set_merge();
+
+	if (result == 0) {
+		std::cout << "ConsumerSet tests passed!" << std::endl;
+	} else {
+		std::cout << result << " ConsumerSet tests failed." << std::endl;
+	}
+	return result;
+}
@@ -0,0 +1,151 @@
+#include <StormByte/buffer/broadcast_fifo.hxx>
+#include <StormByte/buffer/event_descriptor.hxx>
+#include <StormByte/buffer/producer.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef WINDOWS
+#include <poll.h>
+
+using StormByte::Buffer::BroadcastFIFO;
+using StormByte::Buffer::Consumer;
+using StormByte::Buffer::DataType;
+using StormByte::Buffer::EventDescriptor;
+using StormByte::Buffer::Producer;
+using StormByte::Buffer::SharedFIFO;
+
+static bool pollable(const int& fd) {
+	pollfd entry { fd, POLLIN, 0 };
+	return ::poll(&entry, 1, 0) == 1 && (entry.revents & POLLIN);
+}
+
+int test_event_descriptor_set_clear() {
+	EventDescriptor descriptor;
+	ASSERT_TRUE("created", descriptor.Handle() != -1);
+	ASSERT_FALSE("starts cleared", pollable(descriptor.Handle()));
+	descriptor.Set();
+	descriptor.Set();
+	ASSERT_TRUE("set", pollable(descriptor.Handle()));
+	descriptor.Clear();
+	ASSERT_FALSE("cleared", pollable(descriptor.Handle()));
+	descriptor.Clear();
+	descriptor.Set();
+	ASSERT_TRUE("set again", pollable(descriptor.Handle()));
+	RETURN_TEST("test_event_descriptor_set_clear", 0);
+}
+
+int test_consumer_readable_descriptor() {
+	Producer producer;
+	Consumer consumer = producer.Consumer();
+	const int fd = consumer.ReadableDescriptor();
+	ASSERT_TRUE("descriptor", fd != -1);
+	ASSERT_EQUAL("same descriptor", consumer.ReadableDescriptor(), fd);
+	ASSERT_FALSE("nothing to read", pollable(fd));
+
+	(void)producer.Write(std::string("abcd"));
+	ASSERT_TRUE("readable after write", pollable(fd));
+	DataType out;
+	ASSERT_TRUE("read part", consumer.Extract(2, out));
+	consumer.AcknowledgeReadable();
+	ASSERT_TRUE("bytes left keep it set", pollable(fd));
+	ASSERT_TRUE("read rest", consumer.Extract(2, out));
+	ASSERT_TRUE("set until acknowledged", pollable(fd));
+	consumer.AcknowledgeReadable();
+	ASSERT_FALSE("cleared once drained", pollable(fd));
+
+	producer.Close();
+	ASSERT_TRUE("end of stream is readable", pollable(fd));
+	consumer.AcknowledgeReadable();
+	ASSERT_TRUE("stays readable at end of stream", pollable(fd));
+	RETURN_TEST("test_consumer_readable_descriptor", 0);
+}
+
+int test_producer_writable_descriptor() {
+	Producer producer(std::make_shared<SharedFIFO>(4));
+	Consumer consumer = producer.Consumer();
+	const int fd = producer.WritableDescriptor();
+	ASSERT_TRUE("writable while empty", pollable(fd));
+
+	(void)producer.Write(std::string("1234"));
+	producer.AcknowledgeWritable();
+	ASSERT_FALSE("full", pollable(fd));
+	DataType out;
+	ASSERT_TRUE("extract", consumer.Extract(1, out));
+	ASSERT_TRUE("room again", pollable(fd));
+
+	producer.SetError();
+	producer.AcknowledgeWritable();
+	ASSERT_TRUE("errored buffer reports writable (writes fail)", pollable(fd));
+	RETURN_TEST("test_producer_writable_descriptor", 0);
+}
+
+int test_poll_loop_over_many_consumers() {
+	constexpr std::size_t streams = 128;
+	std::vector<Producer> producers;
+	std::vector<Consumer> consumers;
+	std::vector<pollfd> fds;
+	for (std::size_t i = 0; i < streams; ++i) {
+		producers.emplace_back(i % 2 ? std::make_shared<BroadcastFIFO>() : std::make_shared<SharedFIFO>());
+		consumers.push_back(producers.back().Consumer());
+		fds.push_back({ consumers.back().ReadableDescriptor(), POLLIN, 0 });
+	}
+
+	std::thread writer([&producers]() {
+		for (int round = 0; round < 10; ++round)
+			for (auto& producer: producers)
+				(void)producer.Write(std::string("0123456789"));
+		for (auto& producer: producers)
+			producer.Close();
+	});
+
+	// One thread services every consumer
+	std::vector<std::size_t> received(streams, 0);
+	std::size_t open = streams;
+	while (open > 0) {
+		if (::poll(fds.data(), fds.size(), 5000) <= 0)
+			break;
+		for (std::size_t i = 0; i < streams; ++i) {
+			if (fds[i].fd < 0 || !(fds[i].revents & POLLIN))
+				continue;
+			consumers[i].AcknowledgeReadable();
+			DataType out;
+			if (consumers[i].Extract(consumers[i].AvailableBytes(), out))
+				received[i] += out.size();
+			if (consumers[i].EoF()) {
+				fds[i].fd = -1;
+				--open;
+			}
+		}
+	}
+	writer.join();
+
+	bool all = true;
+	for (const std::size_t& bytes: received)
+		if (bytes != 100)
+			all = false;
+	ASSERT_EQUAL("every stream reached end of stream", open, static_cast<std::size_t>(0));
+	ASSERT_TRUE("every byte received", all);
+	RETURN_TEST("test_poll_loop_over_many_consumers", 0);
+}
+#endif
+
+int main() {
+	int result = 0;
+	#ifndef WINDOWS
+	result += test_event_descriptor_set_clear();
+	result += test_consumer_readable_descriptor();
+	result += test_producer_writable_descriptor();
+	result += test_poll_loop_over_many_consumers();
+	#endif
+
+	if (result == 0) {
+		std::cout << "EventDescriptor tests passed!" << std::endl;
+	} else {
+		std::cout << result << " EventDescriptor tests failed." << std::endl;
+	}
+	return result;
+}
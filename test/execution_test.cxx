@@ -0,0 +1,307 @@
+#include <StormByte/buffer/consumer_set.hxx>
+#include <StormByte/buffer/pipeline.hxx>
+#include <StormByte/logger/log.hxx>
+#include <StormByte/string.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <vector>
+
+using StormByte::Buffer::Consumer;
+using StormByte::Buffer::ConsumerSet;
+using StormByte::Buffer::DataType;
+using StormByte::Buffer::Execution;
+using StormByte::Buffer::ExecutionMode;
+using StormByte::Buffer::Executor;
+using StormByte::Buffer::PipeTask;
+using StormByte::Buffer::Pipeline;
+using StormByte::Buffer::Producer;
+using StormByte::Buffer::SharedFIFO;
+
+static std::ostringstream logging_stream;
+static std::shared_ptr<StormByte::Logger::Log> logging = std::make_shared<StormByte::Logger::Log>(logging_stream, StormByte::Logger::Level::Info);
+
+static void copy_stage(Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log>) {
+	DataType data;
+	in.ExtractUntilEoF(data);
+	(void)out.Write(std::move(data));
+	out.Close();
+}
+
+int test_execution_wait() {
+	Pipeline pipeline;
+	pipeline.AddPipe(copy_stage);
+	pipeline.AddPipe(copy_stage);
+
+	Producer input;
+	Execution run = pipeline.Execute(input.Consumer(), ExecutionMode::Async, logging);
+	ASSERT_FALSE("not done before the input ends", run.WaitFor(std::chrono::milliseconds(20)));
+	ASSERT_FALSE("running", run.Done());
+	ASSERT_TRUE("stages running", run.Stages() == std::vector<Execution::StageStatus>(2, Execution::StageStatus::Running));
+	(void)input.Write("payload");
+	input.Close();
+	run.Wait();
+	ASSERT_TRUE("done", run.Done());
+	ASSERT_TRUE("succeeded", run.Succeeded());
+	ASSERT_TRUE("every stage succeeded", run.Stages() == std::vector<Execution::StageStatus>(2, Execution::StageStatus::Succeeded));
+
+	Consumer output = run.Output();
+	ASSERT_FALSE("output ended", output.IsWritable());
+	DataType data;
+	ASSERT_TRUE("output", output.Extract(0, data));
+	ASSERT_EQUAL("content", StormByte::String::FromByteVector(data), std::string("payload"));
+	RETURN_TEST("test_execution_wait", 0);
+}
+
+int test_execution_on_complete() {
+	Pipeline pipeline;
+	pipeline.AddPipe(copy_stage);
+	pipeline.AddPipe([](Consumer in, Producer, std::shared_ptr<StormByte::Logger::Log>) {
+		DataType data;
+		in.ExtractUntilEoF(data);
+		throw std::runtime_error("stage failure");
+	});
+	pipeline.AddPipe(copy_stage);
+
+	Producer input;
+	Execution run = pipeline.Execute(input.Consumer(), ExecutionMode::Async, logging);
+	std::atomic<int> calls {0};
+	std::vector<Execution::StageStatus> reported;
+	ASSERT_TRUE("registered", run.OnComplete([&](const std::vector<Execution::StageStatus>& stages) {
+		reported = stages;
+		++calls;
+	}));
+	input.Close();
+	ASSERT_TRUE("completes", run.WaitFor(std::chrono::seconds(10)));
+	// The callback runs in the finishing thread, right after the waiters are woken
+	for (int i = 0; i < 5000 && calls.load() == 0; ++i)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	ASSERT_EQUAL("called once", calls.load(), 1);
+	ASSERT_FALSE("failed run", run.Succeeded());
+	ASSERT_TRUE("first stage", reported.size() == 3 && reported[0] == Execution::StageStatus::Succeeded);
+	ASSERT_TRUE("throwing stage", reported[1] == Execution::StageStatus::Failed);
+	// Its input errored, but the last stage closed its own output
+	ASSERT_TRUE("last stage", reported[2] == Execution::StageStatus::Succeeded);
+
+	bool late = false;
+	ASSERT_TRUE("registered after completion", run.OnComplete([&late](const std::vector<Execution::StageStatus>& stages) { late = stages.size() == 3; }));
+	ASSERT_TRUE("called at once", late);
+	RETURN_TEST("test_execution_on_complete", 0);
+}
+
+int test_execution_sync_and_empty() {
+	Pipeline empty;
+	Producer input;
+	(void)input.Write("passthrough");
+	input.Close();
+	Execution passthrough = empty.Execute(input.Consumer(), ExecutionMode::Async, logging);
+	ASSERT_TRUE("empty pipeline done", passthrough.Done());
+	ASSERT_TRUE("no stages", passthrough.Stages().empty());
+	ASSERT_TRUE("input passed through", passthrough.Output() == input.Consumer());
+
+	Pipeline pipeline;
+	pipeline.AddPipe(copy_stage);
+	pipeline.AddPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log>) {
+		DataType data;
+		in.ExtractUntilEoF(data);
+		out.SetError();
+	});
+	Producer sync_input;
+	(void)sync_input.Write("sync");
+	sync_input.Close();
+	Execution run = pipeline.Execute(sync_input.Consumer(), ExecutionMode::Sync, logging);
+	ASSERT_TRUE("sync returns complete", run.Done());
+	const std::vector<Execution::StageStatus> stages = run.Stages();
+	ASSERT_TRUE("copy succeeded", stages.size() == 2 && stages[0] == Execution::StageStatus::Succeeded);
+	ASSERT_TRUE("errored output fails the stage", stages[1] == Execution::StageStatus::Failed);
+	ASSERT_TRUE("output errored", run.Output().HasError());
+	RETURN_TEST("test_execution_sync_and_empty", 0);
+}
+
+int test_execution_cancel() {
+	Pipeline pipeline;
+	// Waiting on an input nobody writes to, and on the run's token
+	pipeline.AddPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log>, std::stop_token stop) {
+		ConsumerSet input;
+		(void)input.Add(in);
+		if (input.Select(stop).empty()) {
+			out.SetError();
+			return;
+		}
+		copy_stage(in, out, nullptr);
+	});
+	// Busy until told to stop
+	std::atomic<bool> spinning {false};
+	pipeline.AddPipe([&spinning](Consumer, Producer out, std::shared_ptr<StormByte::Logger::Log>, std::stop_token stop) {
+		spinning = true;
+		while (!stop.stop_requested())
+			;
+		out.SetError();
+	});
+
+	Producer input;
+	Execution run = pipeline.Execute(input.Consumer(), ExecutionMode::Async, logging);
+	for (int i = 0; i < 5000 && !spinning.load(); ++i)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	ASSERT_TRUE("stage spinning", spinning.load());
+	ASSERT_FALSE("not cancelled yet", run.StopRequested());
+	ASSERT_FALSE("still running", run.WaitFor(std::chrono::milliseconds(20)));
+	run.Cancel();
+	ASSERT_TRUE("stop requested", run.StopRequested());
+	ASSERT_TRUE("token set", run.StopToken().stop_requested());
+	ASSERT_TRUE("every stage returns", run.WaitFor(std::chrono::seconds(10)));
+	ASSERT_FALSE("cancelled run failed", run.Succeeded());
+	ASSERT_FALSE("input left to the caller", input.HasError());
+	ASSERT_TRUE("input still writable", input.Write("late"));
+	ASSERT_TRUE("output errored", run.Output().HasError());
+
+	// Cancelling a complete run changes nothing
+	Producer done_input;
+	(void)done_input.Write("done");
+	done_input.Close();
+	Pipeline copy;
+	copy.AddPipe(copy_stage);
+	Execution done = copy.Execute(done_input.Consumer(), ExecutionMode::Sync, logging);
+	done.Cancel();
+	ASSERT_TRUE("still succeeded", done.Succeeded());
+	RETURN_TEST("test_execution_cancel", 0);
+}
+
+int test_execution_cancel_blocked_input() {
+	// A plain first stage waiting on an input that stays open
+	Pipeline pipeline;
+	pipeline.AddPipe(copy_stage);
+	pipeline.AddPipe(copy_stage);
+
+	Producer input;
+	(void)input.Write("partial");
+	Execution run = pipeline.Execute(input.Consumer(), ExecutionMode::Async, logging);
+	ASSERT_FALSE("blocked on the input", run.WaitFor(std::chrono::milliseconds(20)));
+	run.Cancel();
+	run.Wait();
+	ASSERT_TRUE("every stage returned", run.Done());
+	ASSERT_FALSE("cancelled run failed", run.Succeeded());
+	ASSERT_FALSE("input left to the caller", input.HasError());
+	ASSERT_TRUE("input still writable", input.Write("late"));
+
+	// Same for a coroutine first stage
+	Pipeline async;
+	async.AddAsyncPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log>, std::shared_ptr<Executor> executor) -> PipeTask {
+		DataType data;
+		while (co_await in.ExtractSomeAsync(0, data, executor) && !data.empty()) {
+			co_await out.WriteAsync(std::move(data), executor);
+			data.clear();
+		}
+		out.Close();
+	});
+
+	Producer async_input;
+	Execution async_run = async.Execute(async_input.Consumer(), ExecutionMode::Async, logging);
+	ASSERT_FALSE("coroutine waiting on the input", async_run.WaitFor(std::chrono::milliseconds(20)));
+	async_run.Cancel();
+	async_run.Wait();
+	ASSERT_TRUE("coroutine returned", async_run.Done());
+	ASSERT_FALSE("async input left to the caller", async_input.HasError());
+	RETURN_TEST("test_execution_cancel_blocked_input", 0);
+}
+
+int test_execution_cancel_sync_run() {
+	// A Sync run blocked on an open input, stopped from another thread
+	Pipeline pipeline;
+	pipeline.AddPipe(copy_stage);
+	pipeline.AddPipe(copy_stage);
+
+	for (const bool cancel: { true, false }) {
+		Producer input;
+		(void)input.Write("partial");
+		std::atomic<bool> returned {false};
+		// Repeated: the run may not have started when the first call comes
+		std::thread stopper([&pipeline, &returned, cancel]() {
+			while (!returned.load()) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				if (cancel)
+					pipeline.Cancel();
+				else
+					pipeline.SetError();
+			}
+		});
+		Execution run = pipeline.Execute(input.Consumer(), ExecutionMode::Sync, logging);
+		returned = true;
+		stopper.join();
+		ASSERT_TRUE("every stage returned", run.Done());
+		ASSERT_FALSE("stopped run failed", run.Succeeded());
+		ASSERT_TRUE("output errored", run.Output().HasError());
+		ASSERT_FALSE("input left to the caller", input.HasError());
+		ASSERT_TRUE("input still writable", input.Write("late"));
+	}
+	RETURN_TEST("test_execution_cancel_sync_run", 0);
+}
+
+int test_execution_bounded_input_throttles_writer() {
+	// The run's copy of a bounded input keeps its limit: the writer waits for the stage
+	constexpr std::size_t limit = 64;
+	constexpr std::size_t writes = 1024;
+	for (const ExecutionMode mode: { ExecutionMode::Async, ExecutionMode::Sync }) {
+		std::atomic<bool> gate {false};
+		Pipeline pipeline;
+		pipeline.AddPipe([&gate](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+			while (!gate.load())
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			copy_stage(in, out, log);
+		});
+
+		Producer input(std::make_shared<SharedFIFO>(limit));
+		std::atomic<std::size_t> written {0};
+		std::thread writer([&input, &written]() {
+			for (std::size_t i = 0; i < writes; ++i) {
+				if (!input.Write(std::string(limit, 'x')))
+					return;
+				written += limit;
+			}
+			input.Close();
+		});
+		std::size_t held = 0;
+		std::thread opener([&gate, &written, &held]() {
+			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+			held = written.load();
+			gate = true;
+		});
+		Execution run = pipeline.Execute(input.Consumer(), mode, logging);
+		opener.join();
+		const bool completed = run.WaitFor(std::chrono::seconds(10));
+		writer.join();
+
+		// The input, the run's copy and the bytes being moved between them
+		ASSERT_TRUE("writer held back", held <= 3 * limit);
+		ASSERT_TRUE("completes", completed);
+		ASSERT_TRUE("succeeded", run.Succeeded());
+		ASSERT_EQUAL("everything passed through", run.Output().AvailableBytes(), limit * writes);
+	}
+	RETURN_TEST("test_execution_bounded_input_throttles_writer", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_execution_wait();
+	result += test_execution_on_complete();
+	result += test_execution_sync_and_empty();
+	result += test_execution_cancel();
+	result += test_execution_cancel_blocked_input();
+	result += test_execution_cancel_sync_run();
+	result += test_execution_bounded_input_throttles_writer();
+
+	if (result == 0) {
+		std::cout << "Execution tests passed!" << std::endl;
+	} else {
+		std::cout << result << " Execution tests failed." << std::endl;
+	}
+	return result;
+}
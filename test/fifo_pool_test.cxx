@@ -0,0 +1,125 @@
+#include <StormByte/buffer/fifo_pool.hxx>
+#include <StormByte/string.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using StormByte::Buffer::Consumer;
+using StormByte::Buffer::DataType;
+using StormByte::Buffer::FIFOPool;
+using StormByte::Buffer::Producer;
+
+int test_fifo_pool_reuse() {
+	FIFOPool pool;
+	{
+		Producer producer = pool.Acquire();
+		(void)producer.Write(std::string(100000, 'x'));
+		producer.Close();
+	}
+	ASSERT_EQUAL("created one", pool.Created(), 1u);
+	ASSERT_EQUAL("returned on release", pool.Idle(), 1u);
+	ASSERT_TRUE("hint covers the grown buffer", pool.SizeHint() >= 100000u);
+
+	Producer producer = pool.Acquire();
+	ASSERT_EQUAL("reused", pool.Reused(), 1u);
+	ASSERT_EQUAL("no new buffer", pool.Created(), 1u);
+	ASSERT_EQUAL("taken from the pool", pool.Idle(), 0u);
+	Consumer consumer = producer.Consumer();
+	ASSERT_TRUE("empty", consumer.Empty());
+	ASSERT_TRUE("open again", consumer.IsWritable());
+	(void)producer.Write("fresh");
+	producer.Close();
+	DataType data;
+	consumer.ExtractUntilEoF(data);
+	ASSERT_EQUAL("only new data", StormByte::String::FromByteVector(data), std::string("fresh"));
+	RETURN_TEST("test_fifo_pool_reuse", 0);
+}
+
+int test_fifo_pool_reset_state() {
+	FIFOPool pool;
+	int closed = 0;
+	{
+		Producer producer = pool.Acquire();
+		Consumer consumer = producer.Consumer();
+		consumer.EnableStatistics();
+		(void)producer.Write("data");
+		(void)consumer.OnClosed([&closed]() { ++closed; });
+		producer.SetError();
+	}
+	ASSERT_EQUAL("errored buffer returned", pool.Idle(), 1u);
+
+	Producer producer = pool.Acquire();
+	Consumer consumer = producer.Consumer();
+	ASSERT_FALSE("error cleared", consumer.HasError());
+	(void)producer.Write("abc");
+	ASSERT_EQUAL("statistics dropped", consumer.Statistics().bytes_written, 0u);
+	closed = 0;
+	producer.Close();
+	ASSERT_EQUAL("callbacks dropped", closed, 0);
+	RETURN_TEST("test_fifo_pool_reset_state", 0);
+}
+
+int test_fifo_pool_limits() {
+	FIFOPool pool(1, 1024);
+	{
+		Producer first = pool.Acquire();
+		Producer second = pool.Acquire();
+		(void)first.Write(std::string(4096, 'x'));
+	}
+	ASSERT_EQUAL("idle count capped", pool.Idle(), 1u);
+	ASSERT_TRUE("hint capped", pool.SizeHint() <= 1024u);
+
+	FIFOPool watched;
+	{
+		Producer producer = watched.Acquire();
+		(void)producer.Consumer().ReadableDescriptor();
+	}
+	ASSERT_EQUAL("buffer with a descriptor not reused", watched.Idle(), 0u);
+	RETURN_TEST("test_fifo_pool_limits", 0);
+}
+
+int test_fifo_pool_release_anywhere() {
+	Producer survivor;
+	{
+		FIFOPool pool;
+		survivor = pool.Acquire();
+	}
+	(void)survivor.Write("outlives the pool");
+	survivor.Close();
+
+	FIFOPool pool(16);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t) {
+		threads.emplace_back([&pool]() {
+			for (int i = 0; i < 200; ++i) {
+				Producer producer = pool.Acquire();
+				(void)producer.Write(std::string(64, 'a'));
+				producer.Close();
+			}
+		});
+	}
+	for (auto& thread: threads)
+		thread.join();
+	ASSERT_EQUAL("every acquire served", pool.Created() + pool.Reused(), 800u);
+	ASSERT_TRUE("at most one buffer per thread", pool.Created() <= 4u);
+	RETURN_TEST("test_fifo_pool_release_anywhere", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_fifo_pool_reuse();
+	result += test_fifo_pool_reset_state();
+	result += test_fifo_pool_limits();
+	result += test_fifo_pool_release_anywhere();
+
+	if (result == 0) {
+		std::cout << "FIFOPool tests passed!" << std::endl;
+	} else {
+		std::cout << result << " FIFOPool tests failed." << std::endl;
+	}
+	return result;
+}
@@ -0,0 +1,186 @@
+#include <StormByte/buffer/fused_stage.hxx>
+#include <StormByte/logger/log.hxx>
+#include <StormByte/string.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <vector>
+
+using StormByte::Buffer::ChunkTransform;
+using StormByte::Buffer::Consumer;
+using StormByte::Buffer::DataType;
+using StormByte::Buffer::Execution;
+using StormByte::Buffer::ExecutionMode;
+using StormByte::Buffer::FusedStage;
+using StormByte::Buffer::MakePipeline;
+using StormByte::Buffer::Pipeline;
+using StormByte::Buffer::Producer;
+using StormByte::Buffer::Threaded;
+
+static std::ostringstream logging_stream;
+static std::shared_ptr<StormByte::Logger::Log> logging = std::make_shared<StormByte::Logger::Log>(logging_stream, StormByte::Logger::Level::Info);
+
+static void uppercase(DataType& chunk) {
+	for (auto& byte: chunk)
+		byte = static_cast<std::byte>(std::toupper(static_cast<unsigned char>(byte)));
+}
+
+static_assert(ChunkTransform<decltype(&uppercase)>);
+static_assert(!ChunkTransform<StormByte::Buffer::PipeFunction>);
+
+static std::string run(const Pipeline& pipeline, const std::string& text, const ExecutionMode& mode, std::size_t* stages = nullptr) {
+	Producer input;
+	(void)input.Write(text);
+	input.Close();
+	Execution execution = pipeline.Execute(input.Consumer(), mode, logging);
+	execution.Wait();
+	if (stages)
+		*stages = execution.Stages().size();
+	DataType data;
+	execution.Output().ExtractUntilEoF(data);
+	return StormByte::String::FromByteVector(data);
+}
+
+int test_fused_stage_fusion() {
+	const auto strip_spaces = [](DataType& chunk) {
+		chunk.erase(std::remove(chunk.begin(), chunk.end(), std::byte{' '}), chunk.end());
+	};
+	const auto reverse = [](DataType& chunk) { std::reverse(chunk.begin(), chunk.end()); };
+	const Pipeline pipeline = MakePipeline(strip_spaces, uppercase, reverse);
+
+	std::size_t stages = 0;
+	ASSERT_EQUAL("async output", run(pipeline, "a b c", ExecutionMode::Async, &stages), std::string("CBA"));
+	ASSERT_EQUAL("fused into one stage", stages, 1u);
+	ASSERT_EQUAL("sync output", run(pipeline, "x y", ExecutionMode::Sync), std::string("YX"));
+	RETURN_TEST("test_fused_stage_fusion", 0);
+}
+
+int test_fused_stage_boundaries() {
+	const auto exclaim = [](DataType& chunk) { chunk.push_back(std::byte{'!'}); };
+	const StormByte::Buffer::PipeFunction copy = [](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log>) {
+		DataType data;
+		in.ExtractUntilEoF(data);
+		(void)out.Write(std::move(data));
+		out.Close();
+	};
+	// uppercase + exclaim | Threaded exclaim | copy | exclaim + exclaim
+	const Pipeline pipeline = MakePipeline(uppercase, exclaim, Threaded{exclaim}, copy, exclaim, exclaim);
+
+	std::size_t stages = 0;
+	ASSERT_EQUAL("output", run(pipeline, "go", ExecutionMode::Async, &stages), std::string("GO!!!!"));
+	ASSERT_EQUAL("split at the threaded transform and the pipe", stages, 4u);
+
+	std::size_t alone = 0;
+	ASSERT_EQUAL("threaded only", run(MakePipeline(Threaded{exclaim}), "a", ExecutionMode::Sync, &alone), std::string("a!"));
+	ASSERT_EQUAL("one stage", alone, 1u);
+	std::size_t none = 0;
+	ASSERT_EQUAL("empty pipeline passes input through", run(MakePipeline(), "same", ExecutionMode::Sync, &none), std::string("same"));
+	ASSERT_EQUAL("no stages", none, 0u);
+	RETURN_TEST("test_fused_stage_boundaries", 0);
+}
+
+int test_fused_stage_chunks() {
+	// Chunks arrive in order and bounded; state lives for one run
+	std::vector<std::size_t> sizes;
+	auto record = [&sizes](DataType& chunk) { sizes.push_back(chunk.size()); };
+	std::size_t count = 0;
+	auto number = [count](DataType& chunk) mutable {
+		chunk.insert(chunk.begin(), static_cast<std::byte>('0' + count++));
+	};
+	Pipeline pipeline;
+	FusedStage<>({}, 4).AddTo(pipeline, number, record);
+
+	ASSERT_EQUAL("numbered chunks", run(pipeline, "abcdefghij", ExecutionMode::Sync), std::string("0abcd1efgh2ij"));
+	ASSERT_TRUE("chunk sizes", sizes == std::vector<std::size_t>({ 5, 5, 3 }));
+	ASSERT_EQUAL("state starts over each run", run(pipeline, "ab", ExecutionMode::Sync), std::string("0ab"));
+
+	const std::string large(200000, 'q');
+	ASSERT_EQUAL("large input in order", run(MakePipeline(uppercase), large, ExecutionMode::Async), std::string(200000, 'Q'));
+	RETURN_TEST("test_fused_stage_chunks", 0);
+}
+
+int test_fused_stage_partial_chunks() {
+	// Bytes flow on as they arrive instead of waiting for a whole chunk
+	const Pipeline pipeline = MakePipeline(uppercase);
+	Producer input;
+	Execution execution = pipeline.Execute(input.Consumer(), ExecutionMode::Async, logging);
+	(void)input.Write("ab");
+	DataType data;
+	ASSERT_TRUE("less than a chunk transformed", execution.Output().Extract(2, data));
+	ASSERT_EQUAL("partial chunk", StormByte::String::FromByteVector(data), std::string("AB"));
+	input.Close();
+	execution.Wait();
+	ASSERT_TRUE("succeeded", execution.Succeeded());
+	RETURN_TEST("test_fused_stage_partial_chunks", 0);
+}
+
+int test_fused_stage_errors() {
+	const auto fail = [](DataType& chunk) {
+		if (!chunk.empty() && chunk.front() == std::byte{'x'})
+			throw std::runtime_error("bad chunk");
+	};
+	const Pipeline pipeline = MakePipeline(fail, uppercase);
+	Producer input;
+	(void)input.Write("xyz");
+	input.Close();
+	Execution execution = pipeline.Execute(input.Consumer(), ExecutionMode::Async, logging);
+	execution.Wait();
+	ASSERT_FALSE("throwing transform fails the stage", execution.Succeeded());
+
+	// An errored input errors the output
+	Producer errored;
+	(void)errored.Write("ab");
+	errored.SetError();
+	Execution failed = MakePipeline(uppercase).Execute(errored.Consumer(), ExecutionMode::Sync, logging);
+	ASSERT_TRUE("output errored", failed.Output().HasError());
+	RETURN_TEST("test_fused_stage_errors", 0);
+}
+
+int test_fused_stage_cancel() {
+	Producer input, output;
+	(void)input.Write("abcdefgh");
+	input.Close();
+	std::stop_source stop;
+	(void)stop.request_stop();
+	FusedStage<decltype(&uppercase)>(std::tuple(&uppercase), 2)(input.Consumer(), output, logging, stop.get_token());
+	ASSERT_TRUE("output errored", output.HasError());
+	ASSERT_EQUAL("no chunk transformed", output.Consumer().AvailableBytes(), 0u);
+
+	// Cancelling wakes the stage waiting on its open input
+	const Pipeline pipeline = MakePipeline(uppercase);
+	Producer open;
+	Execution run = pipeline.Execute(open.Consumer(), ExecutionMode::Async, logging);
+	(void)open.Write("ab");
+	DataType seen;
+	ASSERT_TRUE("waiting for more input", run.Output().Extract(2, seen));
+	run.Cancel();
+	ASSERT_TRUE("completes", run.WaitFor(std::chrono::seconds(10)));
+	ASSERT_FALSE("cancelled", run.Succeeded());
+	ASSERT_FALSE("input left to the caller", open.HasError());
+	RETURN_TEST("test_fused_stage_cancel", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_fused_stage_fusion();
+	result += test_fused_stage_boundaries();
+	result += test_fused_stage_chunks();
+	result += test_fused_stage_partial_chunks();
+	result += test_fused_stage_errors();
+	result += test_fused_stage_cancel();
+
+	if (result == 0) {
+		std::cout << "FusedStage tests passed!" << std::endl;
+	} else {
+		std::cout << result << " FusedStage tests failed." << std::endl;
+	}
+	return result;
+}
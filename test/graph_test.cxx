@@ -0,0 +1,318 @@
+#include <StormByte/buffer/graph.hxx>
+#include <StormByte/buffer/thread_pool.hxx>
+#include <StormByte/buffer/work_stealing_pool.hxx>
+#include <StormByte/logger/log.hxx>
+#include <StormByte/string.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using StormByte::Buffer::Consumer;
+using StormByte::Buffer::DataType;
+using StormByte::Buffer::Execution;
+using StormByte::Buffer::ExecutionMode;
+using StormByte::Buffer::Executor;
+using StormByte::Buffer::Graph;
+using StormByte::Buffer::Producer;
+using StormByte::Buffer::SharedFIFO;
+using StormByte::Buffer::ThreadPool;
+using StormByte::Buffer::WorkStealingPool;
+
+static std::ostringstream logging_stream;
+static std::shared_ptr<StormByte::Logger::Log> logging = std::make_shared<StormByte::Logger::Log>(logging_stream, StormByte::Logger::Level::Info);
+
+static void uppercase(Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log>) {
+	DataType data;
+	in.ExtractUntilEoF(data);
+	for (auto& byte: data)
+		byte = static_cast<std::byte>(std::toupper(static_cast<unsigned char>(byte)));
+	(void)out.Write(std::move(data));
+	out.Close();
+}
+
+static void reverse(Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log>) {
+	DataType data;
+	in.ExtractUntilEoF(data);
+	std::reverse(data.begin(), data.end());
+	(void)out.Write(std::move(data));
+	out.Close();
+}
+
+static Consumer closed_input(const std::string& text) {
+	Producer input;
+	(void)input.Write(text);
+	input.Close();
+	return input.Consumer();
+}
+
+static std::string drain(Consumer consumer) {
+	DataType data;
+	consumer.ExtractUntilEoF(data);
+	return StormByte::String::FromByteVector(data);
+}
+
+int test_graph_tee_input() {
+	Graph graph;
+	ASSERT_EQUAL("first stream", graph.AddStage(uppercase), 1u);
+	ASSERT_EQUAL("second stream", graph.AddStage(reverse), 2u);
+
+	for (const ExecutionMode mode: { ExecutionMode::Async, ExecutionMode::Sync }) {
+		Execution run = graph.Execute(closed_input("tee"), mode, logging);
+		ASSERT_TRUE("completes", run.WaitFor(std::chrono::seconds(10)));
+		ASSERT_EQUAL("nodes and the input relay", run.Stages().size(), 3u);
+		ASSERT_TRUE("succeeded", run.Succeeded());
+		const std::vector<Consumer> outputs = run.Outputs();
+		ASSERT_EQUAL("one output per branch", outputs.size(), 2u);
+		ASSERT_EQUAL("uppercase branch", drain(outputs[0]), std::string("TEE"));
+		ASSERT_EQUAL("reverse branch", drain(outputs[1]), std::string("eet"));
+	}
+	RETURN_TEST("test_graph_tee_input", 0);
+}
+
+int test_graph_tee_stage() {
+	Graph graph;
+	const std::size_t upper = graph.AddStage(uppercase);
+	graph.AddStage(reverse, upper);
+	graph.AddStage(reverse, upper);
+	graph.AddStage(uppercase, upper);
+
+	// A large stream shared by three readers, fed while they run
+	const std::string text(300000, 'x');
+	Producer input;
+	Execution run = graph.Execute(input.Consumer(), ExecutionMode::Async, logging);
+	(void)input.Write(text);
+	input.Close();
+	ASSERT_TRUE("completes", run.WaitFor(std::chrono::seconds(10)));
+	ASSERT_EQUAL("no relay for a single input reader", run.Stages().size(), 4u);
+	const std::vector<Consumer> outputs = run.Outputs();
+	ASSERT_EQUAL("three outputs", outputs.size(), 3u);
+	for (const Consumer& output: outputs)
+		ASSERT_EQUAL("every reader sees the whole stream", drain(output), std::string(300000, 'X'));
+	RETURN_TEST("test_graph_tee_stage", 0);
+}
+
+int test_graph_split_merge() {
+	Graph graph;
+	const std::vector<std::size_t> parts = graph.AddSplit([](Consumer in, std::vector<Producer> outputs, std::shared_ptr<StormByte::Logger::Log>) {
+		DataType data, even, odd;
+		in.ExtractUntilEoF(data);
+		for (std::size_t i = 0; i < data.size(); ++i)
+			(i % 2 == 0 ? even : odd).push_back(data[i]);
+		(void)outputs[0].Write(std::move(even));
+		(void)outputs[1].Write(std::move(odd));
+		outputs[0].Close();
+		outputs[1].Close();
+	}, Graph::Input, 2);
+	ASSERT_EQUAL("two parts", parts.size(), 2u);
+	const std::size_t upper = graph.AddStage(uppercase, parts[1]);
+	const std::size_t merged = graph.AddMerge(Graph::Concatenate(), { parts[0], upper });
+	ASSERT_EQUAL("merged stream", merged, 4u);
+	ASSERT_EQUAL("three nodes", graph.Nodes(), 3u);
+
+	for (const ExecutionMode mode: { ExecutionMode::Sync, ExecutionMode::Async }) {
+		Execution run = graph.Execute(closed_input("abcdefg"), mode, logging);
+		ASSERT_EQUAL("single output", run.Outputs().size(), 1u);
+		ASSERT_EQUAL("even bytes, then odd ones uppercased", drain(run.Output()), std::string("acegBDF"));
+		ASSERT_TRUE("completes", run.WaitFor(std::chrono::seconds(10)));
+		ASSERT_TRUE("succeeded", run.Succeeded());
+	}
+	RETURN_TEST("test_graph_split_merge", 0);
+}
+
+int test_graph_interleave() {
+	Graph graph;
+	const std::size_t upper = graph.AddStage(uppercase);
+	const std::size_t reversed = graph.AddStage(reverse);
+	graph.AddMerge(Graph::Interleave(), { upper, reversed, Graph::Input });
+
+	Producer input;
+	Execution run = graph.Execute(input.Consumer(), ExecutionMode::Async, logging);
+	(void)input.Write("abc");
+	input.Close();
+	std::string result = drain(run.Output());
+	ASSERT_TRUE("completes", run.WaitFor(std::chrono::seconds(10)));
+	ASSERT_EQUAL("every input merged", result.size(), 9u);
+	// Both stages write their output at once, so it arrives whole
+	ASSERT_TRUE("uppercase branch whole", result.find("ABC") != std::string::npos);
+	ASSERT_TRUE("reverse branch whole", result.find("cba") != std::string::npos);
+	std::sort(result.begin(), result.end());
+	ASSERT_EQUAL("same bytes", result, std::string("ABCaabbcc"));
+	RETURN_TEST("test_graph_interleave", 0);
+}
+
+int test_graph_errors() {
+	Graph graph;
+	ASSERT_EQUAL("unknown input", graph.AddStage(uppercase, 5), Graph::Invalid);
+	ASSERT_EQUAL("unknown merge input", graph.AddMerge(Graph::Concatenate(), { Graph::Input, 7 }), Graph::Invalid);
+	ASSERT_TRUE("no outputs", graph.AddSplit(nullptr, Graph::Input, 0).empty());
+	ASSERT_EQUAL("nothing added", graph.Nodes(), 0u);
+	ASSERT_EQUAL("empty graph passes its input through", drain(graph.Execute(closed_input("same"), ExecutionMode::Sync, logging).Output()), std::string("same"));
+
+	const std::size_t failing = graph.AddStage([](Consumer, Producer, std::shared_ptr<StormByte::Logger::Log>) {
+		throw std::runtime_error("node failure");
+	});
+	const std::size_t fine = graph.AddStage(uppercase);
+	graph.AddMerge(Graph::Concatenate(), { fine, failing });
+	Execution run = graph.Execute(closed_input("abc"), ExecutionMode::Async, logging);
+	ASSERT_TRUE("completes", run.WaitFor(std::chrono::seconds(10)));
+	const std::vector<Execution::StageStatus> stages = run.Stages();
+	ASSERT_TRUE("throwing node failed", stages[0] == Execution::StageStatus::Failed);
+	ASSERT_TRUE("other branch succeeded", stages[1] == Execution::StageStatus::Succeeded);
+	ASSERT_TRUE("merge failed", stages[2] == Execution::StageStatus::Failed);
+	ASSERT_TRUE("output errored", run.Output().HasError());
+
+	// Stopping one run
+	Producer open_input;
+	Execution stopped = graph.Execute(open_input.Consumer(), ExecutionMode::Async, logging);
+	stopped.SetError();
+	open_input.Close();
+	ASSERT_TRUE("stopped run completes", stopped.WaitFor(std::chrono::seconds(10)));
+	ASSERT_FALSE("stopped run failed", stopped.Succeeded());
+
+	// Cancelling wakes the relay waiting on the open input, which stays the caller's
+	Graph tee;
+	tee.AddStage(uppercase);
+	tee.AddStage(reverse);
+	Producer idle;
+	Execution cancelled = tee.Execute(idle.Consumer(), ExecutionMode::Async, logging);
+	cancelled.Cancel();
+	ASSERT_TRUE("cancelled run completes", cancelled.WaitFor(std::chrono::seconds(10)));
+	ASSERT_FALSE("cancelled run failed", cancelled.Succeeded());
+	ASSERT_FALSE("input left alone", idle.HasError());
+
+	// Same for a single node that would read the open input directly
+	Graph single;
+	single.AddStage(uppercase);
+	Producer partial;
+	(void)partial.Write("partial");
+	Execution waiting = single.Execute(partial.Consumer(), ExecutionMode::Async, logging);
+	ASSERT_FALSE("blocked on the input", waiting.WaitFor(std::chrono::milliseconds(20)));
+	waiting.Cancel();
+	ASSERT_TRUE("cancelled node returns", waiting.WaitFor(std::chrono::seconds(10)));
+	ASSERT_FALSE("cancelled node failed", waiting.Succeeded());
+	ASSERT_EQUAL("relay is not a stage", waiting.Stages().size(), 1u);
+	ASSERT_FALSE("partial input left alone", partial.HasError());
+	ASSERT_TRUE("input still writable", partial.Write("late"));
+	RETURN_TEST("test_graph_errors", 0);
+}
+
+int test_graph_closes_open_outputs() {
+	// Nodes that return without closing their outputs, in both modes
+	Graph graph;
+	const std::vector<std::size_t> parts = graph.AddSplit([](Consumer in, std::vector<Producer> outputs, std::shared_ptr<StormByte::Logger::Log>) {
+		DataType data;
+		in.ExtractUntilEoF(data);
+		(void)outputs[0].Write(data);
+		(void)outputs[1].Write(std::move(data));
+	}, Graph::Input, 2);
+	graph.AddStage(uppercase, parts[0]);
+	graph.AddStage(reverse, parts[1]);
+
+	for (const ExecutionMode mode: { ExecutionMode::Sync, ExecutionMode::Async }) {
+		Execution run = graph.Execute(closed_input("open"), mode, logging);
+		ASSERT_TRUE("completes", run.WaitFor(std::chrono::seconds(10)));
+		ASSERT_TRUE("succeeded", run.Succeeded());
+		const std::vector<Consumer> outputs = run.Outputs();
+		ASSERT_EQUAL("uppercase branch", drain(outputs[0]), std::string("OPEN"));
+		ASSERT_EQUAL("reverse branch", drain(outputs[1]), std::string("nepo"));
+	}
+	RETURN_TEST("test_graph_closes_open_outputs", 0);
+}
+
+int test_graph_fixed_pool() {
+	Graph graph;
+	const std::size_t upper = graph.AddStage(uppercase);
+	graph.AddStage(reverse, upper);
+
+	// Fewer workers than nodes: the run fails instead of waiting for good
+	graph.SetExecutor(std::make_shared<ThreadPool>(1, false));
+	Producer input;
+	Execution small = graph.Execute(input.Consumer(), ExecutionMode::Async, logging);
+	ASSERT_TRUE("rejected run completes", small.WaitFor(std::chrono::seconds(10)));
+	ASSERT_FALSE("rejected run failed", small.Succeeded());
+	ASSERT_TRUE("output errored", small.Output().HasError());
+	ASSERT_EQUAL("sync runs need no worker", drain(graph.Execute(closed_input("abc"), ExecutionMode::Sync, logging).Output()), std::string("CBA"));
+
+	// An open input takes one more worker, for the relay
+	const std::vector<std::shared_ptr<Executor>> executors {
+		std::make_shared<ThreadPool>(3, false),
+		std::make_shared<WorkStealingPool>(3)
+	};
+	for (const auto& executor: executors) {
+		graph.SetExecutor(executor);
+		Producer open;
+		Execution run = graph.Execute(open.Consumer(), ExecutionMode::Async, logging);
+		(void)open.Write("abc");
+		open.Close();
+		ASSERT_TRUE("completes with a worker per node and the relay", run.WaitFor(std::chrono::seconds(10)));
+		ASSERT_TRUE("succeeded", run.Succeeded());
+		ASSERT_EQUAL("output", drain(run.Output()), std::string("CBA"));
+	}
+	RETURN_TEST("test_graph_fixed_pool", 0);
+}
+
+int test_graph_bounded_input_throttles_writer() {
+	// The relayed copy of a bounded input keeps its limit: the writer waits for the node
+	constexpr std::size_t limit = 64;
+	constexpr std::size_t writes = 1024;
+	std::atomic<bool> gate {false};
+	Graph graph;
+	graph.AddStage([&gate](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		while (!gate.load())
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		uppercase(in, out, log);
+	});
+
+	Producer input(std::make_shared<SharedFIFO>(limit));
+	Execution run = graph.Execute(input.Consumer(), ExecutionMode::Async, logging);
+	std::atomic<std::size_t> written {0};
+	std::thread writer([&input, &written]() {
+		for (std::size_t i = 0; i < writes; ++i) {
+			if (!input.Write(std::string(limit, 'x')))
+				return;
+			written += limit;
+		}
+		input.Close();
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	const std::size_t held = written.load();
+	gate = true;
+	const bool completed = run.WaitFor(std::chrono::seconds(10));
+	writer.join();
+
+	// The input, the run's copy and the bytes being moved between them
+	ASSERT_TRUE("writer held back", held <= 3 * limit);
+	ASSERT_TRUE("completes", completed);
+	ASSERT_TRUE("succeeded", run.Succeeded());
+	ASSERT_EQUAL("everything passed through", run.Output().AvailableBytes(), limit * writes);
+	RETURN_TEST("test_graph_bounded_input_throttles_writer", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_graph_tee_input();
+	result += test_graph_tee_stage();
+	result += test_graph_split_merge();
+	result += test_graph_interleave();
+	result += test_graph_errors();
+	result += test_graph_closes_open_outputs();
+	result += test_graph_fixed_pool();
+	result += test_graph_bounded_input_throttles_writer();
+
+	if (result == 0) {
+		std::cout << "Graph tests passed!" << std::endl;
+	} else {
+		std::cout << result << " Graph tests failed." << std::endl;
+	}
+	return result;
+}
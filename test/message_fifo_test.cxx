@@ -0,0 +1,204 @@
+#include <StormByte/buffer/message_fifo.hxx>
+#include <StormByte/buffer/producer.hxx>
+#include <StormByte/buffer/consumer.hxx>
+#include <StormByte/string.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using StormByte::Buffer::Consumer;
+using StormByte::Buffer::DataType;
+using StormByte::Buffer::MessageFIFO;
+using StormByte::Buffer::Position;
+using StormByte::Buffer::Producer;
+using StormByte::Buffer::SharedFIFO;
+
+static std::string toString(const DataType& v) {
+	return StormByte::String::FromByteVector(v);
+}
+
+static DataType toData(const std::string& s) {
+	return StormByte::String::ToByteVector(s);
+}
+
+int test_message_fifo_keeps_boundaries() {
+	MessageFIFO fifo;
+	(void)fifo.Write(toData("abc"));
+	(void)fifo.Write(toData("de"));
+	(void)fifo.Write(std::string("f"));
+	ASSERT_EQUAL("messages", fifo.Messages(), static_cast<std::size_t>(3));
+	ASSERT_EQUAL("size", fifo.Size(), static_cast<std::size_t>(6));
+
+	DataType out;
+	ASSERT_TRUE("read message", fifo.ReadMessage(out));
+	ASSERT_EQUAL("first", toString(out), std::string("abc"));
+	ASSERT_EQUAL("read keeps bytes", fifo.Size(), static_cast<std::size_t>(6));
+	ASSERT_TRUE("extract message", fifo.ExtractMessage(out));
+	ASSERT_EQUAL("second replaces output", toString(out), std::string("de"));
+	ASSERT_EQUAL("extract releases read bytes", fifo.Size(), static_cast<std::size_t>(1));
+	ASSERT_TRUE("extract last", fifo.ExtractMessage(out));
+	ASSERT_EQUAL("third", toString(out), std::string("f"));
+	ASSERT_TRUE("empty", fifo.Empty());
+	ASSERT_EQUAL("no messages", fifo.Messages(), static_cast<std::size_t>(0));
+	RETURN_TEST("test_message_fifo_keeps_boundaries", 0);
+}
+
+int test_message_fifo_extract_moves_vector() {
+	Producer producer(std::make_shared<MessageFIFO>());
+	Consumer consumer = producer.Consumer();
+
+	DataType message(4096, std::byte{0x42});
+	const std::byte* storage = message.data();
+	(void)producer.Write(std::move(message));
+
+	DataType out;
+	ASSERT_TRUE("extract through consumer", consumer.ExtractMessage(out));
+	ASSERT_EQUAL("size", out.size(), static_cast<std::size_t>(4096));
+	ASSERT_TRUE("same storage, no copy", out.data() == storage);
+
+	DataType bytes(128, std::byte{0x01});
+	storage = bytes.data();
+	(void)producer.Write(std::move(bytes));
+	out.clear();
+	ASSERT_TRUE("byte extract of a whole message", consumer.Extract(128, out));
+	ASSERT_TRUE("moved as well", out.data() == storage);
+	RETURN_TEST("test_message_fifo_extract_moves_vector", 0);
+}
+
+int test_message_fifo_byte_reads_span_messages() {
+	MessageFIFO fifo;
+	(void)fifo.Write(std::string("Hello"));
+	(void)fifo.Write(std::string(", "));
+	(void)fifo.Write(std::string("World"));
+
+	DataType out;
+	ASSERT_TRUE("read across", fifo.Read(6, out));
+	ASSERT_EQUAL("read content", toString(out), std::string("Hello,"));
+	ASSERT_EQUAL("partial message counted", fifo.Messages(), static_cast<std::size_t>(2));
+	ASSERT_TRUE("rest of message", fifo.ReadMessage(out));
+	ASSERT_EQUAL("rest content", toString(out), std::string(" "));
+
+	fifo.Seek(3, Position::Absolute);
+	out.clear();
+	ASSERT_TRUE("peek across", fifo.Peek(6, out));
+	ASSERT_EQUAL("peek content", toString(out), std::string("lo, Wo"));
+	out.clear();
+	ASSERT_TRUE("extract across", fifo.Extract(4, out));
+	ASSERT_EQUAL("extract content", toString(out), std::string("lo, "));
+	ASSERT_EQUAL("extract releases", fifo.Size(), static_cast<std::size_t>(5));
+	ASSERT_TRUE("drop", fifo.Drop(2));
+	ASSERT_TRUE("tail message", fifo.ExtractMessage(out));
+	ASSERT_EQUAL("tail content", toString(out), std::string("rld"));
+	RETURN_TEST("test_message_fifo_byte_reads_span_messages", 0);
+}
+
+int test_message_fifo_clean_and_clear() {
+	MessageFIFO fifo;
+	(void)fifo.Write(std::string("1234"));
+	(void)fifo.Write(std::string("5678"));
+	DataType out;
+	ASSERT_TRUE("read", fifo.Read(5, out));
+	fifo.Clean();
+	ASSERT_EQUAL("clean releases", fifo.Size(), static_cast<std::size_t>(3));
+	fifo.Seek(0, Position::Absolute);
+	ASSERT_TRUE("message after clean", fifo.ReadMessage(out));
+	ASSERT_EQUAL("after clean content", toString(out), std::string("678"));
+
+	fifo.Clear();
+	ASSERT_TRUE("clear empties", fifo.Empty());
+	(void)fifo.Write(std::string("next"));
+	ASSERT_TRUE("write after clear", fifo.ExtractMessage(out));
+	ASSERT_EQUAL("after clear content", toString(out), std::string("next"));
+	RETURN_TEST("test_message_fifo_clean_and_clear", 0);
+}
+
+int test_message_fifo_blocking_close_error() {
+	MessageFIFO fifo;
+	std::string received;
+	std::atomic<bool> last{true};
+	std::thread reader([&]() {
+		DataType out;
+		if (fifo.ExtractMessage(out))
+			received = toString(out);
+		last = fifo.ExtractMessage(out);
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	(void)fifo.Write(std::string("wake"));
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	fifo.Close();
+	reader.join();
+
+	ASSERT_EQUAL("woken by write", received, std::string("wake"));
+	ASSERT_FALSE("close ends waiting", last.load());
+	ASSERT_FALSE("write after close", fifo.Write(std::string("x")));
+	ASSERT_TRUE("eof", fifo.EoF());
+
+	MessageFIFO errored;
+	(void)errored.Write(std::string("data"));
+	errored.SetError();
+	DataType out;
+	ASSERT_FALSE("error fails message", errored.ExtractMessage(out));
+	ASSERT_TRUE("error eof", errored.EoF());
+	RETURN_TEST("test_message_fifo_blocking_close_error", 0);
+}
+
+int test_shared_fifo_message_without_boundaries() {
+	SharedFIFO fifo;
+	(void)fifo.Write(std::string("ab"));
+	(void)fifo.Write(std::string("cd"));
+	DataType out = toData("stale");
+	ASSERT_TRUE("message", fifo.ExtractMessage(out));
+	ASSERT_EQUAL("every available byte", toString(out), std::string("abcd"));
+	fifo.Close();
+	ASSERT_FALSE("closed and empty", fifo.ReadMessage(out));
+	RETURN_TEST("test_shared_fifo_message_without_boundaries", 0);
+}
+
+int test_message_fifo_producer_consumer_threads() {
+	Producer producer(std::make_shared<MessageFIFO>());
+	Consumer consumer = producer.Consumer();
+	constexpr std::size_t messages = 2000;
+
+	std::thread writer([&]() {
+		for (std::size_t i = 1; i <= messages; ++i)
+			(void)producer.Write(DataType(i % 97 + 1, static_cast<std::byte>(i & 0xFF)));
+		producer.Close();
+	});
+
+	std::size_t count = 0;
+	bool intact = true;
+	DataType out;
+	while (consumer.ExtractMessage(out)) {
+		++count;
+		if (out.size() != count % 97 + 1 || out.front() != static_cast<std::byte>(count & 0xFF))
+			intact = false;
+	}
+	writer.join();
+
+	ASSERT_EQUAL("every message", count, messages);
+	ASSERT_TRUE("boundaries and order kept", intact);
+	ASSERT_TRUE("eof", consumer.EoF());
+	RETURN_TEST("test_message_fifo_producer_consumer_threads", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_message_fifo_keeps_boundaries();
+	result += test_message_fifo_extract_moves_vector();
+	result += test_message_fifo_byte_reads_span_messages();
+	result += test_message_fifo_clean_and_clear();
+	result += test_message_fifo_blocking_close_error();
+	result += test_shared_fifo_message_without_boundaries();
+	result += test_message_fifo_producer_consumer_threads();
+
+	if (result == 0) {
+		std::cout << "MessageFIFO tests passed!" << std::endl;
+	} else {
+		std::cout << result << " MessageFIFO tests failed." << std::endl;
+	}
+	return result;
+}
\ No newline at end of file
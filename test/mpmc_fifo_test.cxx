@@ -0,0 +1,258 @@
+#include <StormByte/buffer/mpmc_fifo.hxx>
+#include <StormByte/buffer/producer.hxx>
+#include <StormByte/buffer/consumer.hxx>
+#include <StormByte/string.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using StormByte::Buffer::Consumer;
+using StormByte::Buffer::DataType;
+using StormByte::Buffer::MPMCFIFO;
+using StormByte::Buffer::Position;
+using StormByte::Buffer::Producer;
+
+static std::string toString(const DataType& v) {
+	return StormByte::String::FromByteVector(v);
+}
+
+int test_mpmc_fifo_basic_read_peek_extract() {
+	MPMCFIFO fifo;
+	(void)fifo.Write(std::string("Hello "));
+	(void)fifo.Write(std::string("World"));
+	ASSERT_EQUAL("available", fifo.AvailableBytes(), static_cast<std::size_t>(11));
+
+	DataType out;
+	ASSERT_TRUE("peek", fifo.Peek(8, out));
+	ASSERT_EQUAL("peek content", toString(out), std::string("Hello Wo"));
+	ASSERT_EQUAL("peek keeps bytes", fifo.AvailableBytes(), static_cast<std::size_t>(11));
+
+	out.clear();
+	ASSERT_TRUE("read", fifo.Read(3, out));
+	ASSERT_EQUAL("read content", toString(out), std::string("Hel"));
+	ASSERT_EQUAL("read consumes", fifo.AvailableBytes(), static_cast<std::size_t>(8));
+
+	out.clear();
+	ASSERT_TRUE("extract rest", fifo.Extract(0, out));
+	ASSERT_EQUAL("extract content", toString(out), std::string("lo World"));
+	ASSERT_TRUE("empty", fifo.Empty());
+	RETURN_TEST("test_mpmc_fifo_basic_read_peek_extract", 0);
+}
+
+int test_mpmc_fifo_seek_skips_forward() {
+	MPMCFIFO fifo;
+	(void)fifo.Write(std::string("ABCDEFGH"));
+	fifo.Seek(3, Position::Relative);
+	fifo.Seek(-2, Position::Relative);
+	ASSERT_TRUE("drop", fifo.Drop(1));
+
+	DataType out;
+	ASSERT_TRUE("read after skip", fifo.Read(0, out));
+	ASSERT_EQUAL("skip content", toString(out), std::string("EFGH"));
+	RETURN_TEST("test_mpmc_fifo_seek_skips_forward", 0);
+}
+
+int test_mpmc_fifo_writes_stay_atomic_units() {
+	auto fifo = std::make_shared<MPMCFIFO>(64);
+	constexpr int producers = 16;
+	constexpr int writes = 500;
+	constexpr std::size_t record = 32;
+
+	std::vector<std::thread> threads;
+	for (int p = 0; p < producers; ++p) {
+		threads.emplace_back([fifo, p]() {
+			for (int i = 0; i < writes; ++i) {
+				// Whole record filled with the producer id: any byte-wise
+				// interleaving shows up as a mixed record
+				DataType data(record, static_cast<std::byte>('A' + p));
+				(void)fifo->Write(std::move(data));
+			}
+		});
+	}
+
+	std::vector<int> per_producer(producers, 0);
+	bool mixed = false;
+	for (int r = 0; r < producers * writes; ++r) {
+		DataType out;
+		if (!fifo->Extract(record, out))
+			break;
+		for (std::byte b: out)
+			if (b != out[0])
+				mixed = true;
+		per_producer[std::to_integer<int>(out[0]) - 'A']++;
+	}
+	for (auto& t: threads)
+		t.join();
+
+	ASSERT_FALSE("no interleaved records", mixed);
+	for (int p = 0; p < producers; ++p)
+		ASSERT_EQUAL("per producer count", per_producer[p], writes);
+	ASSERT_TRUE("drained", fifo->Empty());
+	RETURN_TEST("test_mpmc_fifo_writes_stay_atomic_units", 0);
+}
+
+int test_mpmc_fifo_full_ring_blocks_producer() {
+	auto fifo = std::make_shared<MPMCFIFO>(2);
+	ASSERT_EQUAL("capacity", fifo->Capacity(), static_cast<std::size_t>(2));
+	(void)fifo->Write(std::string("a"));
+	(void)fifo->Write(std::string("b"));
+
+	std::atomic<bool> written{false};
+	std::thread writer([&]() {
+		(void)fifo->Write(std::string("c"));
+		written = true;
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(30));
+	ASSERT_FALSE("producer waits for a free cell", written.load());
+
+	DataType out;
+	ASSERT_TRUE("free a cell", fifo->Extract(1, out));
+	writer.join();
+	ASSERT_TRUE("producer resumed", written.load());
+	out.clear();
+	ASSERT_TRUE("read rest", fifo->Extract(0, out));
+	ASSERT_EQUAL("rest content", toString(out), std::string("bc"));
+	RETURN_TEST("test_mpmc_fifo_full_ring_blocks_producer", 0);
+}
+
+int test_mpmc_fifo_close_releases_waiting_producer() {
+	auto fifo = std::make_shared<MPMCFIFO>(2);
+	(void)fifo->Write(std::string("a"));
+	(void)fifo->Write(std::string("b"));
+
+	std::atomic<bool> result{true};
+	std::thread writer([&]() {
+		result = fifo->Write(std::string("c"));
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	fifo->Close();
+	writer.join();
+
+	ASSERT_FALSE("waiting write fails on close", result.load());
+	ASSERT_FALSE("write after close", fifo->Write(std::string("d")));
+	DataType out;
+	ASSERT_TRUE("published data still readable", fifo->Extract(0, out));
+	ASSERT_EQUAL("content", toString(out), std::string("ab"));
+	ASSERT_TRUE("eof", fifo->EoF());
+	RETURN_TEST("test_mpmc_fifo_close_releases_waiting_producer", 0);
+}
+
+int test_mpmc_fifo_close_wakes_reader() {
+	MPMCFIFO fifo;
+	std::atomic<bool> failed{false};
+	std::thread reader([&]() {
+		DataType out;
+		failed = !fifo.Read(10, out);
+	});
+	(void)fifo.Write(std::string("abc"));
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	fifo.Close();
+	reader.join();
+
+	ASSERT_TRUE("insufficient read fails", failed.load());
+	ASSERT_FALSE("not eof with data", fifo.EoF());
+
+	MPMCFIFO errored;
+	errored.SetError();
+	ASSERT_TRUE("error eof", errored.EoF());
+	ASSERT_FALSE("error not writable", errored.IsWritable());
+	RETURN_TEST("test_mpmc_fifo_close_wakes_reader", 0);
+}
+
+int test_mpmc_fifo_many_producers_many_consumers() {
+	Producer producer(std::make_shared<MPMCFIFO>(256));
+	constexpr int producers = 8;
+	constexpr int consumers = 3;
+	constexpr int writes = 2000;
+
+	std::vector<std::thread> writers;
+	for (int p = 0; p < producers; ++p) {
+		writers.emplace_back([producer]() mutable {
+			for (int i = 0; i < writes; ++i)
+				(void)producer.Write(std::string("0123456789"));
+		});
+	}
+
+	std::atomic<std::size_t> received{0};
+	std::vector<std::thread> readers;
+	for (int c = 0; c < consumers; ++c) {
+		readers.emplace_back([consumer = producer.Consumer(), &received]() mutable {
+			while (!consumer.EoF()) {
+				DataType out;
+				if (consumer.Extract(10, out) || consumer.Extract(0, out))
+					received += out.size();
+			}
+		});
+	}
+
+	for (auto& t: writers)
+		t.join();
+	producer.Close();
+	for (auto& t: readers)
+		t.join();
+
+	ASSERT_EQUAL("received everything", received.load(), static_cast<std::size_t>(producers * writes * 10));
+	RETURN_TEST("test_mpmc_fifo_many_producers_many_consumers", 0);
+}
+
+int test_mpmc_fifo_close_full_ring_keeps_accepted_writes() {
+	// Every write that reported success must be readable after Close, even
+	// when Close races producers queued on a full ring
+	for (int round = 0; round < 200; ++round) {
+		auto fifo = std::make_shared<MPMCFIFO>(2);
+		constexpr int producers = 6;
+
+		std::atomic<std::size_t> accepted{0};
+		std::vector<std::thread> writers;
+		for (int p = 0; p < producers; ++p) {
+			writers.emplace_back([fifo, &accepted]() {
+				while (fifo->Write(std::string("0123456789")))
+					accepted += 10;
+			});
+		}
+
+		std::size_t received = 0;
+		std::thread reader([fifo, &received]() {
+			while (!fifo->EoF()) {
+				DataType out;
+				if (fifo->Extract(10, out) || fifo->Extract(0, out))
+					received += out.size();
+				else
+					std::this_thread::yield();
+			}
+		});
+
+		std::this_thread::sleep_for(std::chrono::microseconds(50 * (round % 20)));
+		fifo->Close();
+		for (auto& t: writers)
+			t.join();
+		reader.join();
+
+		ASSERT_EQUAL("accepted bytes are read", received, accepted.load());
+	}
+	RETURN_TEST("test_mpmc_fifo_close_full_ring_keeps_accepted_writes", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_mpmc_fifo_basic_read_peek_extract();
+	result += test_mpmc_fifo_seek_skips_forward();
+	result += test_mpmc_fifo_writes_stay_atomic_units();
+	result += test_mpmc_fifo_full_ring_blocks_producer();
+	result += test_mpmc_fifo_close_releases_waiting_producer();
+	result += test_mpmc_fifo_close_wakes_reader();
+	result += test_mpmc_fifo_close_full_ring_keeps_accepted_writes();
+	result += test_mpmc_fifo_many_producers_many_consumers();
+
+	if (result == 0) {
+		std::cout << "MPMCFIFO tests passed!" << std::endl;
+	} else {
+		std::cout << result << " MPMCFIFO tests failed." << std::endl;
+	}
+	return result;
+}
\ No newline at end of file
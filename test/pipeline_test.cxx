@@ -1,19 +1,32 @@
 #include <StormByte/buffer/pipeline.hxx>
+#include <StormByte/buffer/thread_pool.hxx>
+#include <StormByte/buffer/work_stealing_pool.hxx>
 #include <StormByte/logger/log.hxx>
 #include <StormByte/string.hxx>
 #include <StormByte/test_handlers.h>
 
+#include <atomic>
 #include <iostream>
 #include <string>
 #include <thread>
 #include <chrono>
+#include <future>
 #include <cctype>
 #include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <stop_token>
+#include <vector>
 
 using StormByte::Buffer::DataType;
 using StormByte::Buffer::Pipeline;
 using StormByte::Buffer::Producer;
 using StormByte::Buffer::Consumer;
+using StormByte::Buffer::Execution;
+using StormByte::Buffer::Executor;
+using StormByte::Buffer::PipeTask;
+using StormByte::Buffer::ThreadPool;
+using StormByte::Buffer::WorkStealingPool;
 
 // Configure the size of large data test (in kilobytes)
 #define LARGE_TEST_SIZE_KB 1024
@@ -34,11 +47,23 @@ using StormByte::Buffer::Consumer;
 static std::ostringstream logging_stream;
 std::shared_ptr<StormByte::Logger::Log> logging = std::make_shared<StormByte::Logger::Log>(logging_stream, StormByte::Logger::Level::Info);
 
-// Helper to wait for pipeline completion without arbitrary sleeps
+// Helper to wait for pipeline completion without arbitrary sleeps or spinning
 void wait_for_pipeline_completion(Consumer& consumer) {
-	while (consumer.IsWritable()) {
-		std::this_thread::yield();
-	}
+	auto ended = std::make_shared<std::promise<void>>();
+	auto signal = [ended]() {
+		try {
+			ended->set_value();
+		}
+		catch (const std::future_error&) {
+			// Closed and errored: already signalled
+		}
+	};
+	std::future<void> done = ended->get_future();
+	const std::size_t closed = consumer.OnClosed(signal);
+	const std::size_t errored = consumer.OnError(signal);
+	done.wait();
+	(void)consumer.RemoveCallback(closed);
+	(void)consumer.RemoveCallback(errored);
 }
 
 int test_pipeline_empty() {
@@ -1202,6 +1227,758 @@ int test_pipeline_interrupted_by_seterror() {
 	RETURN_TEST("test_pipeline_interrupted_by_seterror", 0);
 }
 
+int test_pipeline_shared_executor() {
+	// Two stages per pipeline, run one after the other on the same two workers
+	auto pool = std::make_shared<ThreadPool>(2);
+	auto uppercase = [](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		while (!in.EoF()) {
+			DataType data;
+			auto res = CONSUME(in, 0, data);
+			if (res && !data.empty()) {
+				std::string str = StormByte::String::FromByteVector(data);
+				for (auto& c : str) c = std::toupper(c);
+				(void)out.Write(str);
+			}
+		}
+		out.Close();
+	};
+	auto exclaim = [](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		while (!in.EoF()) {
+			DataType data;
+			auto res = CONSUME(in, 0, data);
+			if (res && !data.empty())
+				(void)out.Write(data);
+		}
+		(void)out.Write("!");
+		out.Close();
+	};
+
+	Pipeline first, second;
+	for (Pipeline* pipeline: { &first, &second }) {
+		pipeline->AddPipe(uppercase);
+		pipeline->AddPipe(exclaim);
+		pipeline->SetExecutor(pool);
+	}
+
+	for (int round = 0; round < 20; ++round) {
+		Producer input;
+		(void)input.Write("pool");
+		input.Close();
+		Pipeline& pipeline = round % 2 == 0 ? first : second;
+		Consumer result = pipeline.Process(input.Consumer(), StormByte::Buffer::ExecutionMode::Async, logging);
+		wait_for_pipeline_completion(result);
+		DataType data;
+		auto res = CONSUME(result, 0, data);
+		ASSERT_TRUE("executor result", res);
+		ASSERT_EQUAL("executor transformation", StormByte::String::FromByteVector(data), std::string("POOL!"));
+	}
+	ASSERT_EQUAL("no thread per run", pool->Threads(), static_cast<std::size_t>(2));
+
+	RETURN_TEST("test_pipeline_shared_executor", 0);
+}
+
+int test_pipeline_stage_exception() {
+	Pipeline pipeline;
+	pipeline.AddPipe([](Consumer, Producer, std::shared_ptr<StormByte::Logger::Log>) {
+		throw std::runtime_error("stage failure");
+	});
+	pipeline.AddPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		while (!in.EoF()) {
+			DataType data;
+			auto res = CONSUME(in, 0, data);
+			if (res && !data.empty())
+				(void)out.Write(data);
+		}
+		out.Close();
+	});
+
+	Producer input;
+	(void)input.Write("lost");
+	input.Close();
+	Consumer result = pipeline.Process(input.Consumer(), StormByte::Buffer::ExecutionMode::Async, logging);
+	wait_for_pipeline_completion(result);
+	ASSERT_TRUE("failure reaches the end", result.EoF());
+	ASSERT_EQUAL("nothing produced", result.AvailableBytes(), static_cast<std::size_t>(0));
+
+	RETURN_TEST("test_pipeline_stage_exception", 0);
+}
+
+// Cooperative stage: uppercases its input without ever blocking a worker
+static PipeTask uppercase_coroutine(Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log, std::shared_ptr<Executor> executor) {
+	DataType data;
+	while (co_await in.ExtractSomeAsync(0, data, executor) && !data.empty()) {
+		for (auto& b : data)
+			b = static_cast<std::byte>(std::toupper(static_cast<unsigned char>(b)));
+		co_await out.WriteAsync(std::move(data), executor);
+		data.clear();
+	}
+	out.Close();
+}
+
+int test_pipeline_async_stages_many_pipelines() {
+	// Far more waiting stages than workers: only cooperative stages can all make progress
+	constexpr std::size_t pipelines = 32;
+	auto pool = std::make_shared<WorkStealingPool>(2);
+	std::vector<Pipeline> group(pipelines);
+	std::vector<Producer> inputs(pipelines);
+	std::vector<Consumer> results;
+	for (std::size_t i = 0; i < pipelines; ++i) {
+		for (int stage = 0; stage < 3; ++stage)
+			group[i].AddAsyncPipe(uppercase_coroutine);
+		group[i].AddAsyncPipe([suffix = std::string("!")](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log, std::shared_ptr<Executor> executor) -> PipeTask {
+			DataType data;
+			while (co_await in.ExtractSomeAsync(0, data, executor) && !data.empty()) {
+				co_await out.WriteAsync(std::move(data), executor);
+				data.clear();
+			}
+			co_await out.WriteAsync(StormByte::String::ToByteVector(suffix), executor);
+			out.Close();
+		});
+		group[i].SetExecutor(pool);
+		results.push_back(group[i].Process(inputs[i].Consumer(), StormByte::Buffer::ExecutionMode::Async, logging));
+	}
+
+	// Every stage is now suspended waiting for input
+	for (int chunk = 0; chunk < 10; ++chunk)
+		for (auto& input : inputs)
+			(void)input.Write("ab");
+	for (auto& input : inputs)
+		input.Close();
+
+	bool all_ok = true;
+	for (auto& result : results) {
+		wait_for_pipeline_completion(result);
+		DataType data;
+		(void)CONSUME(result, 0, data);
+		all_ok = all_ok && StormByte::String::FromByteVector(data) == std::string("ABABABABABABABABABAB!");
+	}
+	ASSERT_TRUE("every pipeline produced its output", all_ok);
+	ASSERT_EQUAL("thread count fixed", pool->Threads(), static_cast<std::size_t>(2));
+
+	RETURN_TEST("test_pipeline_async_stages_many_pipelines", 0);
+}
+
+int test_pipeline_async_stages_mixed_sync() {
+	Pipeline pipeline;
+	// Blocking stage feeding a coroutine stage, on the default pools
+	pipeline.AddPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		while (!in.EoF()) {
+			DataType data;
+			auto res = CONSUME(in, 0, data);
+			if (res && !data.empty()) {
+				std::string str = StormByte::String::FromByteVector(data);
+				std::replace(str.begin(), str.end(), ' ', '-');
+				(void)out.Write(str);
+			}
+		}
+		out.Close();
+	});
+	pipeline.AddAsyncPipe(uppercase_coroutine);
+
+	Producer input;
+	(void)input.Write("mixed stages");
+	input.Close();
+	Consumer result = pipeline.Process(input.Consumer(), StormByte::Buffer::ExecutionMode::Sync, logging);
+	ASSERT_FALSE("sync result writable", result.IsWritable());
+	DataType data;
+	auto res = CONSUME(result, 0, data);
+	ASSERT_TRUE("mixed has data", res);
+	ASSERT_EQUAL("mixed transformation", StormByte::String::FromByteVector(data), std::string("MIXED-STAGES"));
+
+	// A coroutine that throws fails its output
+	Pipeline failing;
+	failing.AddAsyncPipe([](Consumer in, Producer, std::shared_ptr<StormByte::Logger::Log>, std::shared_ptr<Executor> executor) -> PipeTask {
+		DataType data;
+		co_await in.ExtractSomeAsync(0, data, executor);
+		throw std::runtime_error("coroutine failure");
+	});
+	Producer failing_input;
+	(void)failing_input.Write("x");
+	failing_input.Close();
+	Consumer failed = failing.Process(failing_input.Consumer(), StormByte::Buffer::ExecutionMode::Sync, logging);
+	ASSERT_FALSE("failed not writable", failed.IsWritable());
+	ASSERT_TRUE("failed eof", failed.EoF());
+
+	RETURN_TEST("test_pipeline_async_stages_mixed_sync", 0);
+}
+
+int test_pipeline_sync_single_thread() {
+	Pipeline pipeline;
+	std::vector<std::thread::id> threads;
+	// Blocking stage that forgets to close its output
+	pipeline.AddPipe([&threads](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		threads.push_back(std::this_thread::get_id());
+		while (!in.EoF()) {
+			DataType data;
+			auto res = CONSUME(in, 0, data);
+			if (res && !data.empty())
+				(void)out.Write(data);
+		}
+	});
+	pipeline.AddAsyncPipe([&threads](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log, std::shared_ptr<Executor> executor) -> PipeTask {
+		DataType data;
+		while (co_await in.ExtractSomeAsync(1, data, executor) && !data.empty()) {
+			threads.push_back(std::this_thread::get_id());
+			co_await out.WriteAsync(std::move(data), executor);
+			data.clear();
+		}
+		out.Close();
+	});
+	pipeline.AddAsyncPipe(uppercase_coroutine);
+	pipeline.AddPipe([&threads](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		threads.push_back(std::this_thread::get_id());
+		(void)out.Write("[");
+		while (!in.EoF()) {
+			DataType data;
+			auto res = CONSUME(in, 0, data);
+			if (res && !data.empty())
+				(void)out.Write(data);
+		}
+		(void)out.Write("]");
+		out.Close();
+	});
+
+	for (int round = 0; round < 3; ++round) {
+		threads.clear();
+		Producer input;
+		(void)input.Write("one ");
+		(void)input.Write("thread");
+		input.Close();
+		Consumer result = pipeline.Process(input.Consumer(), StormByte::Buffer::ExecutionMode::Sync, logging);
+		ASSERT_FALSE("sync result writable", result.IsWritable());
+		DataType data;
+		auto res = CONSUME(result, 0, data);
+		ASSERT_TRUE("sync has data", res);
+		ASSERT_EQUAL("sync transformation", StormByte::String::FromByteVector(data), std::string("[ONE THREAD]"));
+		bool caller_only = threads.size() == 12;
+		for (const auto& id : threads)
+			caller_only = caller_only && id == std::this_thread::get_id();
+		ASSERT_TRUE("every stage ran in the caller's thread", caller_only);
+	}
+
+	RETURN_TEST("test_pipeline_sync_single_thread", 0);
+}
+
+int test_pipeline_sync_input_fed_later() {
+	Pipeline pipeline;
+	pipeline.AddAsyncPipe(uppercase_coroutine);
+	pipeline.AddAsyncPipe(uppercase_coroutine);
+
+	// Coroutine stages wait for the input without blocking the loop
+	Producer input;
+	std::thread feeder([input]() mutable {
+		for (int i = 0; i < 5; ++i) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+			(void)input.Write("late");
+		}
+		input.Close();
+	});
+	Consumer result = pipeline.Process(input.Consumer(), StormByte::Buffer::ExecutionMode::Sync, logging);
+	feeder.join();
+	DataType data;
+	auto res = CONSUME(result, 0, data);
+	ASSERT_TRUE("fed later has data", res);
+	ASSERT_EQUAL("fed later", StormByte::String::FromByteVector(data), std::string("LATELATELATELATELATE"));
+	ASSERT_TRUE("fed later eof", result.EoF());
+
+	RETURN_TEST("test_pipeline_sync_input_fed_later", 0);
+}
+
+int test_pipeline_parallel_stage_order() {
+	Pipeline pipeline;
+	auto running = std::make_shared<std::atomic<int>>(0);
+	auto peak = std::make_shared<std::atomic<int>>(0);
+	// Replicas finish out of order: later chunks are faster
+	pipeline.AddParallelPipe([running, peak](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		const int now = ++*running;
+		int seen = peak->load();
+		while (now > seen && !peak->compare_exchange_weak(seen, now)) {}
+		DataType data;
+		(void)CONSUME(in, 0, data);
+		std::this_thread::sleep_for(std::chrono::microseconds(data.empty() ? 0 : (static_cast<int>(data[0]) % 7) * 100));
+		for (auto& b : data)
+			b = static_cast<std::byte>(std::toupper(static_cast<unsigned char>(b)));
+		(void)out.Write(std::move(data));
+		out.Close();
+		--*running;
+	}, 3, 5);
+	pipeline.AddPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		while (!in.EoF()) {
+			DataType data;
+			auto res = CONSUME(in, 0, data);
+			if (res && !data.empty())
+				(void)out.Write(data);
+		}
+		out.Close();
+	});
+
+	std::string text;
+	for (int i = 0; i < 400; ++i)
+		text += static_cast<char>('a' + (i * 7) % 26);
+	std::string expected = text;
+	for (auto& c : expected) c = static_cast<char>(std::toupper(c));
+
+	for (auto mode : { StormByte::Buffer::ExecutionMode::Async, StormByte::Buffer::ExecutionMode::Sync }) {
+		Producer input;
+		(void)input.Write(text);
+		input.Close();
+		Consumer result = pipeline.Process(input.Consumer(), mode, logging);
+		wait_for_pipeline_completion(result);
+		DataType data;
+		(void)CONSUME(result, 0, data);
+		ASSERT_EQUAL("chunks reassembled in order", StormByte::String::FromByteVector(data), expected);
+	}
+	ASSERT_TRUE("replicas bounded by workers", peak->load() <= 3);
+
+	RETURN_TEST("test_pipeline_parallel_stage_order", 0);
+}
+
+int test_pipeline_parallel_stage_failure() {
+	Pipeline filter;
+	// Replicas may produce nothing for a chunk
+	filter.AddParallelPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		DataType data;
+		(void)CONSUME(in, 0, data);
+		if (!data.empty() && data[0] != static_cast<std::byte>('x'))
+			(void)out.Write(std::move(data));
+		out.Close();
+	}, 2, 2);
+	Producer input;
+	(void)input.Write("abxxcdxxe");
+	input.Close();
+	Consumer result = filter.Process(input.Consumer(), StormByte::Buffer::ExecutionMode::Async, logging);
+	wait_for_pipeline_completion(result);
+	DataType data;
+	(void)CONSUME(result, 0, data);
+	ASSERT_EQUAL("empty chunks skipped", StormByte::String::FromByteVector(data), std::string("abcde"));
+	ASSERT_FALSE("filter not errored", result.HasError());
+
+	Pipeline failing;
+	failing.AddParallelPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		DataType data;
+		(void)CONSUME(in, 0, data);
+		if (!data.empty() && data[0] == static_cast<std::byte>('!'))
+			throw std::runtime_error("replica failure");
+		(void)out.Write(std::move(data));
+		out.Close();
+	}, 2, 1);
+	Producer failing_input;
+	(void)failing_input.Write("abc!def");
+	failing_input.Close();
+	Consumer failed = failing.Process(failing_input.Consumer(), StormByte::Buffer::ExecutionMode::Async, logging);
+	wait_for_pipeline_completion(failed);
+	ASSERT_TRUE("replica failure fails the stage", failed.HasError());
+
+	RETURN_TEST("test_pipeline_parallel_stage_failure", 0);
+}
+
+int test_pipeline_parallel_stage_fixed_pool() {
+	// The splitting loop holds the only worker: it must run the chunks itself
+	const std::vector<std::shared_ptr<Executor>> executors {
+		std::make_shared<ThreadPool>(1, false),
+		std::make_shared<WorkStealingPool>(1)
+	};
+	for (const auto& executor : executors) {
+		Pipeline pipeline;
+		pipeline.AddParallelPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+			DataType data;
+			(void)CONSUME(in, 0, data);
+			for (auto& b : data)
+				b = static_cast<std::byte>(std::toupper(static_cast<unsigned char>(b)));
+			(void)out.Write(std::move(data));
+			out.Close();
+		}, 4, 3);
+		pipeline.SetExecutor(executor);
+		Producer input;
+		const Execution run = pipeline.Execute(input.Consumer(), StormByte::Buffer::ExecutionMode::Async, logging);
+		(void)input.Write("abcdefghijklmnopqrstuvwxyz");
+		input.Close();
+		ASSERT_TRUE("completes on one worker", run.WaitFor(std::chrono::seconds(10)));
+		ASSERT_TRUE("succeeded", run.Succeeded());
+		DataType data;
+		run.Output().ExtractUntilEoF(data);
+		ASSERT_EQUAL("chunks in order", StormByte::String::FromByteVector(data), std::string("ABCDEFGHIJKLMNOPQRSTUVWXYZ"));
+	}
+	RETURN_TEST("test_pipeline_parallel_stage_fixed_pool", 0);
+}
+
+int test_pipeline_statistics() {
+	Pipeline pipeline;
+	// Doubles every byte, slowly
+	pipeline.AddPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		while (!in.EoF()) {
+			DataType data;
+			if (in.Extract(1, data) && !data.empty()) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				(void)out.Write(DataType { data[0], data[0] });
+			}
+		}
+		out.Close();
+	});
+	pipeline.AddPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		while (!in.EoF()) {
+			DataType data;
+			if (in.Extract(2, data) && !data.empty())
+				(void)out.Write(std::move(data));
+		}
+		out.Close();
+	});
+
+	Producer input;
+	Consumer result = pipeline.Process(input.Consumer(), StormByte::Buffer::ExecutionMode::Async, logging);
+	ASSERT_TRUE("disabled by default", pipeline.Statistics().empty());
+	input.Close();
+	DataType data;
+	(void)result.ExtractUntilEoF(data);
+
+	pipeline.EnableStatistics();
+	Producer counted;
+	result = pipeline.Process(counted.Consumer(), StormByte::Buffer::ExecutionMode::Async, logging);
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	(void)counted.Write("abcdefghij");
+	counted.Close();
+	data.clear();
+	result.ExtractUntilEoF(data);
+	ASSERT_EQUAL("output", StormByte::String::FromByteVector(data), std::string("aabbccddeeffgghhiijj"));
+
+	// The last stage may still be returning
+	std::vector<Pipeline::StageStatistics> stages;
+	for (int i = 0; i < 5000; ++i) {
+		stages = pipeline.Statistics();
+		if (stages.size() == 2 && stages[1].bytes_in == 20 && stages[0].wall_time > std::chrono::nanoseconds(0))
+			break;
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	ASSERT_EQUAL("one entry per stage", stages.size(), static_cast<std::size_t>(2));
+	ASSERT_EQUAL("first stage in", stages[0].bytes_in, static_cast<std::size_t>(10));
+	ASSERT_EQUAL("first stage out", stages[0].bytes_out, static_cast<std::size_t>(20));
+	ASSERT_EQUAL("second stage in", stages[1].bytes_in, static_cast<std::size_t>(20));
+	ASSERT_EQUAL("second stage out", stages[1].bytes_out, static_cast<std::size_t>(20));
+	ASSERT_TRUE("first stage waited for its input", stages[0].input_wait >= std::chrono::milliseconds(5));
+	ASSERT_TRUE("second stage waited for the slow one", stages[1].input_wait >= std::chrono::milliseconds(5));
+	ASSERT_TRUE("wall time covers the work", stages[0].wall_time >= std::chrono::milliseconds(10));
+	ASSERT_TRUE("wall time covers the wait", stages[0].wall_time >= stages[0].input_wait);
+	ASSERT_TRUE("queue depth", stages[0].peak_queue >= 2 && stages[0].peak_queue <= 20);
+	ASSERT_EQUAL("unbounded output never waits", stages[0].output_wait.count(), static_cast<std::chrono::nanoseconds::rep>(0));
+
+	pipeline.EnableStatistics(false);
+	Producer again;
+	again.Close();
+	result = pipeline.Process(again.Consumer(), StormByte::Buffer::ExecutionMode::Sync, logging);
+	ASSERT_TRUE("disabled again", pipeline.Statistics().empty());
+
+	RETURN_TEST("test_pipeline_statistics", 0);
+}
+
+int test_pipeline_statistics_sync() {
+	Pipeline pipeline;
+	pipeline.EnableStatistics();
+	pipeline.AddAsyncPipe(uppercase_coroutine);
+	pipeline.AddParallelPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		DataType data;
+		(void)in.ExtractUntilEoF(data);
+		(void)out.Write(std::move(data));
+		out.Close();
+	}, 2, 4);
+
+	Producer input;
+	(void)input.Write("statistics");
+	input.Close();
+	Consumer result = pipeline.Process(input.Consumer(), StormByte::Buffer::ExecutionMode::Sync, logging);
+	DataType data;
+	(void)result.ExtractUntilEoF(data);
+	ASSERT_EQUAL("output", StormByte::String::FromByteVector(data), std::string("STATISTICS"));
+
+	const std::vector<Pipeline::StageStatistics> stages = pipeline.Statistics();
+	ASSERT_EQUAL("one entry per stage", stages.size(), static_cast<std::size_t>(2));
+	ASSERT_EQUAL("coroutine in", stages[0].bytes_in, static_cast<std::size_t>(10));
+	ASSERT_EQUAL("coroutine out", stages[0].bytes_out, static_cast<std::size_t>(10));
+	ASSERT_EQUAL("parallel in", stages[1].bytes_in, static_cast<std::size_t>(10));
+	ASSERT_EQUAL("parallel out", stages[1].bytes_out, static_cast<std::size_t>(10));
+	ASSERT_EQUAL("read by the caller", stages[1].peak_queue, static_cast<std::size_t>(10));
+	ASSERT_TRUE("both finished", stages[0].wall_time > std::chrono::nanoseconds(0) && stages[1].wall_time > std::chrono::nanoseconds(0));
+	RETURN_TEST("test_pipeline_statistics_sync", 0);
+}
+
+int test_pipeline_tracing() {
+	auto tracer = std::make_shared<StormByte::Buffer::Tracer>();
+	Pipeline pipeline;
+	pipeline.SetTracer(tracer);
+	pipeline.AddPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		while (!in.EoF()) {
+			DataType data;
+			if (in.Extract(1, data) && !data.empty())
+				(void)out.Write(std::move(data));
+		}
+		out.Close();
+	});
+	pipeline.AddPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		DataType data;
+		(void)in.ExtractUntilEoF(data);
+		out.SetError();
+	});
+
+	Producer input;
+	const Execution run = pipeline.Execute(input.Consumer(), StormByte::Buffer::ExecutionMode::Async, logging);
+	(void)input.Write("abc");
+	input.Close();
+	// Stages record their end before the run counts them finished
+	run.Wait();
+	ASSERT_TRUE("failed stage", run.Output().HasError());
+	ASSERT_TRUE("statistics stay disabled", pipeline.Statistics().empty());
+
+	const std::string json = tracer->Json();
+	const auto has = [&json](const std::string& pattern) { return json.find(pattern) != std::string::npos; };
+	ASSERT_TRUE("stage 0 start", has("\"name\":\"stage 0\",\"cat\":\"stage\",\"ph\":\"b\""));
+	ASSERT_TRUE("stage 0 end", has("\"name\":\"stage 0\",\"cat\":\"stage\",\"ph\":\"e\""));
+	ASSERT_TRUE("stage 1 end", has("\"name\":\"stage 1\",\"cat\":\"stage\",\"ph\":\"e\""));
+	ASSERT_TRUE("input written", has("\"name\":\"write\",\"cat\":\"buffer\",\"ph\":\"i\",\"s\":\"t\",\"args\":{\"buffer\":0,\"bytes\":3}"));
+	ASSERT_TRUE("input read byte by byte", has("\"name\":\"read\",\"cat\":\"buffer\",\"ph\":\"i\",\"s\":\"t\",\"args\":{\"buffer\":0,\"bytes\":1}"));
+	ASSERT_TRUE("input closed", has("\"name\":\"close\",\"cat\":\"buffer\",\"ph\":\"i\",\"s\":\"t\",\"args\":{\"buffer\":0}"));
+	ASSERT_TRUE("first output closed", has("\"name\":\"close\",\"cat\":\"buffer\",\"ph\":\"i\",\"s\":\"t\",\"args\":{\"buffer\":1}"));
+	ASSERT_TRUE("error propagated", has("\"name\":\"error\",\"cat\":\"buffer\",\"ph\":\"i\",\"s\":\"t\",\"args\":{\"buffer\":2}"));
+	ASSERT_EQUAL("nothing dropped", tracer->Dropped(), static_cast<std::size_t>(0));
+
+	RETURN_TEST("test_pipeline_tracing", 0);
+}
+
+int test_pipeline_concurrent_process() {
+	Pipeline pipeline;
+	pipeline.AddPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		DataType data;
+		in.ExtractUntilEoF(data);
+		std::reverse(data.begin(), data.end());
+		(void)out.Write(std::move(data));
+		out.Close();
+	});
+	pipeline.AddAsyncPipe(uppercase_coroutine);
+
+	// One configured pipeline serves every thread, with runs overlapping
+	constexpr int threads = 4;
+	constexpr int runs = 25;
+	std::atomic<int> mismatches {0};
+	std::vector<std::thread> clients;
+	for (int t = 0; t < threads; ++t) {
+		clients.emplace_back([&pipeline, &mismatches, t]() {
+			for (int r = 0; r < runs; ++r) {
+				const std::string request = "request " + std::to_string(t) + "-" + std::to_string(r);
+				Producer input;
+				Consumer result = pipeline.Process(input.Consumer(), StormByte::Buffer::ExecutionMode::Async, logging);
+				(void)input.Write(request);
+				input.Close();
+				DataType data;
+				result.ExtractUntilEoF(data);
+				std::string expected(request.rbegin(), request.rend());
+				std::transform(expected.begin(), expected.end(), expected.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+				if (StormByte::String::FromByteVector(data) != expected)
+					++mismatches;
+			}
+		});
+	}
+	for (auto& client: clients)
+		client.join();
+	ASSERT_EQUAL("every run got its own output", mismatches.load(), 0);
+	RETURN_TEST("test_pipeline_concurrent_process", 0);
+}
+
+int test_pipeline_execution_set_error() {
+	Pipeline pipeline;
+	pipeline.AddPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		DataType data;
+		in.ExtractUntilEoF(data);
+		(void)out.Write(std::move(data));
+		out.Close();
+	});
+
+	Producer first_input, second_input, third_input;
+	Execution first = pipeline.Execute(first_input.Consumer(), StormByte::Buffer::ExecutionMode::Async, logging);
+	Execution second = pipeline.Execute(second_input.Consumer(), StormByte::Buffer::ExecutionMode::Async, logging);
+	first.SetError();
+	(void)second_input.Write("second");
+	second_input.Close();
+	first_input.Close();
+	ASSERT_TRUE("first completes", first.WaitFor(std::chrono::seconds(10)));
+	ASSERT_TRUE("second completes", second.WaitFor(std::chrono::seconds(10)));
+	ASSERT_TRUE("first failed", first.Output().HasError());
+	ASSERT_TRUE("second unaffected", second.Succeeded());
+	DataType data;
+	second.Output().ExtractUntilEoF(data);
+	ASSERT_EQUAL("second output", StormByte::String::FromByteVector(data), std::string("second"));
+
+	// The pipeline-wide error reaches every run still going
+	Execution third = pipeline.Execute(third_input.Consumer(), StormByte::Buffer::ExecutionMode::Async, logging);
+	pipeline.SetError();
+	third_input.Close();
+	ASSERT_TRUE("third completes", third.WaitFor(std::chrono::seconds(10)));
+	ASSERT_TRUE("third failed", third.Output().HasError());
+	RETURN_TEST("test_pipeline_execution_set_error", 0);
+}
+
+int test_pipeline_buffer_pool() {
+	auto pool = std::make_shared<StormByte::Buffer::FIFOPool>();
+	Pipeline pipeline;
+	pipeline.SetBufferPool(pool);
+	pipeline.AddPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		DataType data;
+		in.ExtractUntilEoF(data);
+		(void)out.Write(std::move(data));
+		out.Close();
+	});
+	pipeline.AddPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		DataType data;
+		in.ExtractUntilEoF(data);
+		std::reverse(data.begin(), data.end());
+		(void)out.Write(std::move(data));
+		out.Close();
+	});
+
+	const std::string words[] = { "first run", "second", "the third run" };
+	for (const std::string& word: words) {
+		Producer input;
+		(void)input.Write(word);
+		input.Close();
+		DataType data;
+		pipeline.Process(input.Consumer(), StormByte::Buffer::ExecutionMode::Sync, logging).ExtractUntilEoF(data);
+		std::string expected(word.rbegin(), word.rend());
+		ASSERT_EQUAL("output of a reused buffer", StormByte::String::FromByteVector(data), expected);
+	}
+	ASSERT_EQUAL("one buffer per stage created", pool->Created(), 2u);
+	ASSERT_EQUAL("later runs reuse them", pool->Reused(), 4u);
+	ASSERT_EQUAL("back in the pool", pool->Idle(), 2u);
+	ASSERT_TRUE("size hint learned", pool->SizeHint() >= std::string("the third run").size());
+
+	// Without a pool every run allocates its own buffers
+	pipeline.SetBufferPool(nullptr);
+	Producer input;
+	(void)input.Write("unpooled");
+	input.Close();
+	DataType data;
+	pipeline.Process(input.Consumer(), StormByte::Buffer::ExecutionMode::Sync, logging).ExtractUntilEoF(data);
+	ASSERT_EQUAL("unpooled output", StormByte::String::FromByteVector(data), std::string("deloopnu"));
+	ASSERT_EQUAL("pool untouched", pool->Created() + pool->Reused(), 6u);
+	RETURN_TEST("test_pipeline_buffer_pool", 0);
+}
+
+int test_pipeline_cancel() {
+	Pipeline pipeline;
+	std::atomic<int> spinning {0};
+	pipeline.AddPipe([&spinning](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log, std::stop_token stop) {
+		DataType data;
+		(void)in.Extract(1, data);
+		++spinning;
+		while (!stop.stop_requested())
+			;
+		out.SetError();
+	});
+	pipeline.AddParallelPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		DataType data;
+		in.ExtractUntilEoF(data);
+		(void)out.Write(std::move(data));
+		out.Close();
+	}, 2, 4);
+
+	// Every run still going is cancelled; inputs belong to the caller
+	Producer first_input, second_input;
+	(void)first_input.Write("a");
+	(void)second_input.Write("b");
+	Execution first = pipeline.Execute(first_input.Consumer(), StormByte::Buffer::ExecutionMode::Async, logging);
+	Execution second = pipeline.Execute(second_input.Consumer(), StormByte::Buffer::ExecutionMode::Async, logging);
+	for (int i = 0; i < 5000 && spinning.load() < 2; ++i)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	ASSERT_EQUAL("both runs spinning", spinning.load(), 2);
+	pipeline.Cancel();
+	ASSERT_TRUE("first completes", first.WaitFor(std::chrono::seconds(10)));
+	ASSERT_TRUE("second completes", second.WaitFor(std::chrono::seconds(10)));
+	ASSERT_TRUE("first cancelled", first.StopRequested() && first.Output().HasError());
+	ASSERT_TRUE("second cancelled", second.StopRequested() && second.Output().HasError());
+	ASSERT_FALSE("inputs left alone", first_input.HasError() || second_input.HasError());
+
+	// A later run starts with a fresh token
+	Pipeline copy;
+	copy.AddPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log, std::stop_token stop) {
+		DataType data;
+		in.ExtractUntilEoF(data);
+		if (stop.stop_requested())
+			return;
+		(void)out.Write(std::move(data));
+		out.Close();
+	});
+	copy.Cancel();
+	Producer input;
+	(void)input.Write("fresh");
+	input.Close();
+	DataType data;
+	copy.Process(input.Consumer(), StormByte::Buffer::ExecutionMode::Sync, logging).ExtractUntilEoF(data);
+	ASSERT_EQUAL("not cancelled", StormByte::String::FromByteVector(data), std::string("fresh"));
+	RETURN_TEST("test_pipeline_cancel", 0);
+}
+
+int test_pipeline_cancel_parallel_in_flight() {
+	// Slow replicas of the first stage, fed from an input the caller keeps open
+	Pipeline pipeline;
+	auto started = std::make_shared<std::atomic<int>>(0);
+	pipeline.AddParallelPipe([started](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		++*started;
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		DataType data;
+		(void)CONSUME(in, 0, data);
+		(void)out.Write(std::move(data));
+		out.Close();
+	}, 2, 1);
+
+	Producer input;
+	(void)input.Write("abcdefghijklmnopqrst");
+	const Execution run = pipeline.Execute(input.Consumer(), StormByte::Buffer::ExecutionMode::Async, logging);
+	for (int i = 0; i < 5000 && started->load() == 0; ++i)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	ASSERT_TRUE("chunks in flight", started->load() > 0);
+	run.Cancel();
+	ASSERT_TRUE("completes with the input still open", run.WaitFor(std::chrono::seconds(10)));
+	ASSERT_FALSE("cancelled", run.Succeeded());
+	ASSERT_TRUE("output errored", run.Output().HasError());
+	ASSERT_TRUE("no further chunk started", started->load() < 20);
+	ASSERT_FALSE("input left to the caller", input.HasError());
+
+	// Cancelled while only waiting on the open input
+	Producer idle;
+	const Execution waiting = pipeline.Execute(idle.Consumer(), StormByte::Buffer::ExecutionMode::Async, logging);
+	ASSERT_FALSE("waits for input", waiting.WaitFor(std::chrono::milliseconds(20)));
+	waiting.Cancel();
+	ASSERT_TRUE("wakes on the token", waiting.WaitFor(std::chrono::seconds(10)));
+	ASSERT_FALSE("idle input left alone", idle.HasError());
+	RETURN_TEST("test_pipeline_cancel_parallel_in_flight", 0);
+}
+
+int test_pipeline_closes_open_outputs() {
+	// Stages that return without closing their output, in both modes
+	Pipeline pipeline;
+	pipeline.AddPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log) {
+		DataType data;
+		in.ExtractUntilEoF(data);
+		(void)out.Write(std::move(data));
+	});
+	pipeline.AddAsyncPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log> log, std::shared_ptr<Executor> executor) -> PipeTask {
+		DataType data;
+		while (co_await in.ExtractSomeAsync(0, data, executor) && !data.empty()) {
+			co_await out.WriteAsync(std::move(data), executor);
+			data.clear();
+		}
+	});
+	for (const auto mode: { StormByte::Buffer::ExecutionMode::Sync, StormByte::Buffer::ExecutionMode::Async }) {
+		Producer input;
+		(void)input.Write("open");
+		input.Close();
+		const Execution run = pipeline.Execute(input.Consumer(), mode, logging);
+		ASSERT_TRUE("completes", run.WaitFor(std::chrono::seconds(10)));
+		ASSERT_TRUE("succeeded", run.Succeeded());
+		DataType data;
+		run.Output().ExtractUntilEoF(data);
+		ASSERT_EQUAL("output", StormByte::String::FromByteVector(data), std::string("open"));
+		ASSERT_TRUE("output closed", run.Output().EoF());
+	}
+	RETURN_TEST("test_pipeline_closes_open_outputs", 0);
+}
+
 int main() {
 	int result = 0;
 	result += test_pipeline_empty();
@@ -1224,6 +2001,24 @@ int main() {
 	result += test_pipeline_large_concurrent_stress();
 	result += test_pipeline_sync_execution();
 	result += test_pipeline_interrupted_by_seterror();
+	result += test_pipeline_shared_executor();
+	result += test_pipeline_stage_exception();
+	result += test_pipeline_async_stages_many_pipelines();
+	result += test_pipeline_async_stages_mixed_sync();
+	result += test_pipeline_sync_single_thread();
+	result += test_pipeline_sync_input_fed_later();
+	result += test_pipeline_parallel_stage_order();
+	result += test_pipeline_parallel_stage_failure();
+	result += test_pipeline_parallel_stage_fixed_pool();
+	result += test_pipeline_statistics();
+	result += test_pipeline_statistics_sync();
+	result += test_pipeline_tracing();
+	result += test_pipeline_concurrent_process();
+	result += test_pipeline_execution_set_error();
+	result += test_pipeline_buffer_pool();
+	result += test_pipeline_cancel();
+	result += test_pipeline_cancel_parallel_in_flight();
+	result += test_pipeline_closes_open_outputs();
 
 	if (result == 0) {
 		std::cout << "Pipeline tests passed!" << std::endl;
@@ -0,0 +1,161 @@
+#include <StormByte/buffer/priority_fifo.hxx>
+#include <StormByte/buffer/producer.hxx>
+#include <StormByte/string.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using StormByte::Buffer::Consumer;
+using StormByte::Buffer::DataType;
+using StormByte::Buffer::PriorityFIFO;
+using StormByte::Buffer::Producer;
+
+static std::string toString(const DataType& v) {
+	return StormByte::String::FromByteVector(v);
+}
+
+static DataType toData(const std::string& s) {
+	return StormByte::String::ToByteVector(s);
+}
+
+int test_priority_fifo_strict() {
+	auto fifo = std::make_shared<PriorityFIFO>(3);
+	Producer producer(fifo);
+	Consumer consumer = producer.Consumer();
+
+	(void)producer.Write(std::string("bulk1"));
+	(void)producer.WriteLane(1, toData("mid"));
+	(void)producer.Write(std::string("bulk2"));
+	(void)producer.WriteLane(0, toData("flush"));
+	ASSERT_EQUAL("lanes", fifo->Lanes(), static_cast<std::size_t>(3));
+	ASSERT_EQUAL("bulk lane bytes", fifo->LaneBytes(2), static_cast<std::size_t>(10));
+	ASSERT_EQUAL("total bytes", consumer.AvailableBytes(), static_cast<std::size_t>(18));
+
+	DataType out;
+	ASSERT_TRUE("peek", consumer.Peek(8, out));
+	ASSERT_EQUAL("peek in priority order", toString(out), std::string("flushmid"));
+	out.clear();
+	ASSERT_TRUE("extract", consumer.Extract(0, out));
+	ASSERT_EQUAL("control first, bulk in order", toString(out), std::string("flushmidbulk1bulk2"));
+	RETURN_TEST("test_priority_fifo_strict", 0);
+}
+
+int test_priority_fifo_partial_write_not_interleaved() {
+	auto fifo = std::make_shared<PriorityFIFO>(2);
+	Producer producer(fifo);
+	Consumer consumer = producer.Consumer();
+
+	(void)producer.Write(std::string("abcdef"));
+	DataType out;
+	ASSERT_TRUE("partial", consumer.Extract(2, out));
+	ASSERT_EQUAL("first part", toString(out), std::string("ab"));
+	(void)producer.WriteLane(0, toData("X"));
+	out.clear();
+	ASSERT_TRUE("rest", consumer.Extract(5, out));
+	ASSERT_EQUAL("started write finishes first", toString(out), std::string("cdefX"));
+	RETURN_TEST("test_priority_fifo_partial_write_not_interleaved", 0);
+}
+
+int test_priority_fifo_weighted() {
+	auto fifo = std::make_shared<PriorityFIFO>(std::vector<std::size_t>{ 2, 1 });
+	Producer producer(fifo);
+	Consumer consumer = producer.Consumer();
+	for (int i = 0; i < 4; ++i) {
+		(void)producer.WriteLane(0, toData("H"));
+		(void)producer.WriteLane(1, toData("l"));
+	}
+	std::string order;
+	DataType out;
+	while (consumer.AvailableBytes() > 0 && consumer.ExtractMessage(out))
+		order += toString(out);
+	ASSERT_EQUAL("two high for each low", order, std::string("HHlHHlll"));
+	RETURN_TEST("test_priority_fifo_weighted", 0);
+}
+
+int test_priority_fifo_messages_moved() {
+	auto fifo = std::make_shared<PriorityFIFO>(2);
+	Producer producer(fifo);
+	Consumer consumer = producer.Consumer();
+	DataType control = toData("cancel");
+	const std::byte* address = control.data();
+	(void)producer.Write(std::string("payload"));
+	(void)producer.WriteLane(0, std::move(control));
+
+	DataType out;
+	ASSERT_TRUE("message", consumer.ExtractMessage(out));
+	ASSERT_EQUAL("control message", toString(out), std::string("cancel"));
+	ASSERT_TRUE("moved, not copied", out.data() == address);
+	ASSERT_FALSE("unknown lane", producer.WriteLane(5, toData("x")));
+
+	Producer plain;
+	Consumer plain_consumer = plain.Consumer();
+	ASSERT_TRUE("single lane buffer ignores the lane", plain.WriteLane(3, toData("ok")));
+	ASSERT_EQUAL("written", plain_consumer.AvailableBytes(), static_cast<std::size_t>(2));
+	RETURN_TEST("test_priority_fifo_messages_moved", 0);
+}
+
+int test_priority_fifo_write_combining_keeps_lane_order() {
+	auto fifo = std::make_shared<PriorityFIFO>(2);
+	Producer producer(fifo);
+	Consumer consumer = producer.Consumer();
+	producer.EnableWriteCombining(1024);
+
+	(void)producer.Write(std::string("bulk1-"));
+	(void)producer.WriteLane(0, toData("ctl-"));
+	ASSERT_EQUAL("control lane not held back", consumer.AvailableBytes(), static_cast<std::size_t>(4));
+	(void)producer.WriteLane(1, toData("bulk2"));
+	DataType out;
+	ASSERT_TRUE("read all", consumer.Extract(0, out));
+	ASSERT_EQUAL("bulk lane in write order", toString(out), std::string("ctl-bulk1-bulk2"));
+
+	Producer plain;
+	Consumer plain_consumer = plain.Consumer();
+	plain.EnableWriteCombining(1024);
+	(void)plain.Write(std::string("first-"));
+	(void)plain.WriteLane(0, toData("second"));
+	out.clear();
+	ASSERT_TRUE("read plain", plain_consumer.Extract(0, out));
+	ASSERT_EQUAL("single lane buffer in write order", toString(out), std::string("first-second"));
+	RETURN_TEST("test_priority_fifo_write_combining_keeps_lane_order", 0);
+}
+
+int test_priority_fifo_blocking_close() {
+	auto fifo = std::make_shared<PriorityFIFO>(2);
+	Producer producer(fifo);
+	Consumer consumer = producer.Consumer();
+	std::thread writer([producer]() mutable {
+		for (int i = 0; i < 100; ++i) {
+			(void)producer.Write(std::string("0123456789"));
+			(void)producer.WriteLane(0, toData("c"));
+		}
+		producer.Close();
+	});
+	std::size_t received = 0;
+	DataType out;
+	while (consumer.ExtractMessage(out))
+		received += out.size();
+	writer.join();
+	ASSERT_EQUAL("every byte", received, static_cast<std::size_t>(1100));
+	ASSERT_TRUE("end of stream", consumer.EoF());
+	RETURN_TEST("test_priority_fifo_blocking_close", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_priority_fifo_strict();
+	result += test_priority_fifo_partial_write_not_interleaved();
+	result += test_priority_fifo_weighted();
+	result += test_priority_fifo_messages_moved();
+	result += test_priority_fifo_write_combining_keeps_lane_order();
+	result += test_priority_fifo_blocking_close();
+
+	if (result == 0) {
+		std::cout << "PriorityFIFO tests passed!" << std::endl;
+	} else {
+		std::cout << result << " PriorityFIFO tests failed." << std::endl;
+	}
+	return result;
+}
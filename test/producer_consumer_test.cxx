@@ -1313,6 +1313,122 @@ int test_empty_read_failure() {
 	RETURN_TEST("test_empty_read_failure", 0);
 }
 
+int test_producer_write_combining_threshold() {
+	Producer producer;
+	auto consumer = producer.Consumer();
+	producer.EnableWriteCombining(8);
+
+	(void)producer.Write("ABC");
+	(void)producer.Write("DEF");
+	ASSERT_EQUAL("combined bytes pending", producer.PendingBytes(), static_cast<std::size_t>(6));
+	ASSERT_EQUAL("nothing visible before threshold", consumer.AvailableBytes(), static_cast<std::size_t>(0));
+
+	(void)producer.Write("GH");
+	ASSERT_EQUAL("threshold flushes", consumer.AvailableBytes(), static_cast<std::size_t>(8));
+	ASSERT_EQUAL("nothing pending after flush", producer.PendingBytes(), static_cast<std::size_t>(0));
+
+	(void)producer.Write("IJ");
+	ASSERT_TRUE("explicit flush", producer.Flush());
+	(void)producer.Write("KL");
+	producer.Close();
+
+	std::vector<std::byte> data;
+	ASSERT_TRUE("read combined", consumer.Read(0, data));
+	ASSERT_EQUAL("combined content", StormByte::String::FromByteVector(data), std::string("ABCDEFGHIJKL"));
+	ASSERT_TRUE("eof after close flush", consumer.EoF());
+
+	RETURN_TEST("test_producer_write_combining_threshold", 0);
+}
+
+int test_producer_write_combining_time_budget() {
+	Producer producer;
+	auto consumer = producer.Consumer();
+	producer.EnableWriteCombining(1024, std::chrono::milliseconds(5));
+
+	(void)producer.Write("A");
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	(void)producer.Write("B");
+	ASSERT_EQUAL("time budget flushes", consumer.AvailableBytes(), static_cast<std::size_t>(2));
+
+	// Large writes with nothing pending bypass the combining buffer
+	(void)producer.Write(std::string(2048, 'x'));
+	ASSERT_EQUAL("large write bypass", consumer.AvailableBytes(), static_cast<std::size_t>(2050));
+	ASSERT_EQUAL("large write not pending", producer.PendingBytes(), static_cast<std::size_t>(0));
+
+	RETURN_TEST("test_producer_write_combining_time_budget", 0);
+}
+
+int test_producer_write_combining_threaded() {
+	Producer producer;
+	auto consumer = producer.Consumer();
+	constexpr int writers = 4;
+	constexpr int writes = 2000;
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < writers; ++t) {
+		// Each thread owns a copy, so each gets its own combining buffer
+		threads.emplace_back([producer]() mutable {
+			producer.EnableWriteCombining(256);
+			for (int i = 0; i < writes; ++i)
+				(void)producer.Write("0123456789");
+			// Remaining bytes are flushed when the copy is destroyed
+		});
+	}
+	for (auto& t : threads) t.join();
+	producer.Close();
+
+	std::vector<std::byte> data;
+	consumer.ExtractUntilEoF(data);
+	ASSERT_EQUAL("all combined bytes delivered", data.size(), static_cast<std::size_t>(writers * writes * 10));
+
+	RETURN_TEST("test_producer_write_combining_threaded", 0);
+}
+
+int test_producer_write_combining_discarded_on_error() {
+	Producer producer;
+	auto consumer = producer.Consumer();
+	producer.EnableWriteCombining(64);
+
+	(void)producer.Write("LOST");
+	producer.SetError();
+	ASSERT_EQUAL("pending dropped on error", producer.PendingBytes(), static_cast<std::size_t>(0));
+	ASSERT_FALSE("write after error fails", producer.Write("MORE"));
+	ASSERT_TRUE("consumer sees error", consumer.HasError());
+
+	RETURN_TEST("test_producer_write_combining_discarded_on_error", 0);
+}
+
+int test_producer_has_error() {
+	Producer producer;
+	auto consumer = producer.Consumer();
+	ASSERT_FALSE("no error yet", producer.HasError());
+	producer.Close();
+	ASSERT_FALSE("closing is not an error", producer.HasError());
+
+	Producer writer;
+	Producer other(writer.Consumer());
+	other.SetError();
+	ASSERT_TRUE("error set through another handle", writer.HasError());
+
+	RETURN_TEST("test_producer_has_error", 0);
+}
+
+int test_producer_write_lvalue_data() {
+	Producer producer;
+	auto consumer = producer.Consumer();
+	std::vector<std::byte> data = StormByte::String::ToByteVector("AB");
+	ASSERT_TRUE("first write", producer.Write(data));
+	ASSERT_EQUAL("lvalue left untouched", data.size(), 2u);
+	ASSERT_TRUE("second write", producer.Write(1, data));
+	ASSERT_EQUAL("still untouched", data.size(), 2u);
+	producer.Close();
+
+	std::vector<std::byte> out;
+	ASSERT_TRUE("read back", consumer.Extract(0, out));
+	ASSERT_EQUAL("both writes", StormByte::String::FromByteVector(out), std::string("ABA"));
+	RETURN_TEST("test_producer_write_lvalue_data", 0);
+}
+
 int main() {
 	int result = 0;
 	
@@ -1361,6 +1477,12 @@ int main() {
 	result += test_consumer_peek_basic();
 	result += test_consumer_peek_blocking();
 	result += test_empty_read_failure();
+	result += test_producer_write_combining_threshold();
+	result += test_producer_write_combining_time_budget();
+	result += test_producer_write_combining_threaded();
+	result += test_producer_write_combining_discarded_on_error();
+	result += test_producer_has_error();
+	result += test_producer_write_lvalue_data();
 
 	if (result == 0) {
 		std::cout << "All Producer/Consumer tests passed!" << std::endl;
@@ -0,0 +1,152 @@
+#include <StormByte/buffer/producer.hxx>
+#include <StormByte/buffer/reorder_fifo.hxx>
+#include <StormByte/string.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using StormByte::Buffer::Consumer;
+using StormByte::Buffer::DataType;
+using StormByte::Buffer::Producer;
+using StormByte::Buffer::ReorderFIFO;
+
+static std::string toString(const DataType& v) {
+	return StormByte::String::FromByteVector(v);
+}
+
+static DataType toData(const std::string& s) {
+	return StormByte::String::ToByteVector(s);
+}
+
+int test_reorder_fifo_in_order_read() {
+	auto fifo = std::make_shared<ReorderFIFO>(8);
+	Producer producer(fifo);
+	Consumer consumer = producer.Consumer();
+
+	ASSERT_TRUE("write 2", producer.WriteSequence(2, toData("c")));
+	ASSERT_TRUE("write 1", producer.WriteSequence(1, toData("b")));
+	ASSERT_EQUAL("nothing readable behind the gap", consumer.AvailableBytes(), static_cast<std::size_t>(0));
+	ASSERT_EQUAL("parked", fifo->Parked(), static_cast<std::size_t>(2));
+	ASSERT_TRUE("write 0", producer.WriteSequence(0, toData("a")));
+	ASSERT_EQUAL("run released", consumer.AvailableBytes(), static_cast<std::size_t>(3));
+	ASSERT_EQUAL("nothing parked", fifo->Parked(), static_cast<std::size_t>(0));
+	ASSERT_EQUAL("next", fifo->NextSequence(), static_cast<std::uint64_t>(3));
+
+	DataType out;
+	ASSERT_TRUE("extract", consumer.Extract(0, out));
+	ASSERT_EQUAL("in order", toString(out), std::string("abc"));
+	RETURN_TEST("test_reorder_fifo_in_order_read", 0);
+}
+
+int test_reorder_fifo_rejects() {
+	auto fifo = std::make_shared<ReorderFIFO>(4, 10);
+	Producer producer(fifo);
+	ASSERT_FALSE("plain write", producer.Write(std::string("x")));
+	ASSERT_FALSE("before first", producer.WriteSequence(9, toData("x")));
+	ASSERT_TRUE("write 11", producer.WriteSequence(11, toData("x")));
+	ASSERT_FALSE("duplicate parked", producer.WriteSequence(11, toData("x")));
+	ASSERT_TRUE("write 10", producer.WriteSequence(10, toData("x")));
+	ASSERT_FALSE("already passed", producer.WriteSequence(10, toData("x")));
+
+	Producer plain;
+	ASSERT_FALSE("plain SharedFIFO does not reorder", plain.WriteSequence(0, toData("x")));
+	RETURN_TEST("test_reorder_fifo_rejects", 0);
+}
+
+int test_reorder_fifo_messages_moved() {
+	auto fifo = std::make_shared<ReorderFIFO>();
+	Producer producer(fifo);
+	Consumer consumer = producer.Consumer();
+	DataType second = toData("second");
+	const std::byte* address = second.data();
+	(void)producer.WriteSequence(1, std::move(second));
+	(void)producer.WriteSequence(0, toData("first"));
+
+	DataType out;
+	ASSERT_TRUE("first message", consumer.ExtractMessage(out));
+	ASSERT_EQUAL("first", toString(out), std::string("first"));
+	ASSERT_TRUE("second message", consumer.ExtractMessage(out));
+	ASSERT_EQUAL("second", toString(out), std::string("second"));
+	ASSERT_TRUE("parked block handed over without copy", out.data() == address);
+	RETURN_TEST("test_reorder_fifo_messages_moved", 0);
+}
+
+int test_reorder_fifo_window_backpressure() {
+	auto fifo = std::make_shared<ReorderFIFO>(2);
+	Producer producer(fifo);
+	Consumer consumer = producer.Consumer();
+	std::atomic<bool> written {false};
+	std::thread ahead([&producer, &written]() {
+		written = producer.WriteSequence(2, toData("c"));
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	ASSERT_FALSE("beyond window waits", written.load());
+	(void)producer.WriteSequence(0, toData("a"));
+	ahead.join();
+	ASSERT_TRUE("admitted once the window moved", written.load());
+	(void)producer.WriteSequence(1, toData("b"));
+	DataType out;
+	ASSERT_TRUE("extract", consumer.Extract(0, out));
+	ASSERT_EQUAL("in order", toString(out), std::string("abc"));
+
+	std::thread blocked([&producer, &written]() {
+		written = producer.WriteSequence(10, toData("z"));
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	producer.Close();
+	blocked.join();
+	ASSERT_FALSE("close releases waiting writers", written.load());
+	RETURN_TEST("test_reorder_fifo_window_backpressure", 0);
+}
+
+int test_reorder_fifo_parallel_workers() {
+	constexpr std::uint64_t blocks = 2000;
+	constexpr std::size_t workers = 4;
+	auto fifo = std::make_shared<ReorderFIFO>(16);
+	Producer producer(fifo);
+	Consumer consumer = producer.Consumer();
+
+	std::vector<std::thread> threads;
+	std::atomic<std::size_t> done {0};
+	for (std::size_t w = 0; w < workers; ++w) {
+		threads.emplace_back([&, w]() {
+			Producer local = producer;
+			for (std::uint64_t seq = w; seq < blocks; seq += workers)
+				(void)local.WriteSequence(seq, toData(std::to_string(seq) + ";"));
+			if (++done == workers)
+				local.Close();
+		});
+	}
+
+	std::string expected;
+	for (std::uint64_t seq = 0; seq < blocks; ++seq)
+		expected += std::to_string(seq) + ";";
+	std::string received;
+	DataType out;
+	while (consumer.ExtractMessage(out))
+		received += toString(out);
+	for (auto& thread: threads)
+		thread.join();
+	ASSERT_EQUAL("every block in order", received, expected);
+	RETURN_TEST("test_reorder_fifo_parallel_workers", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_reorder_fifo_in_order_read();
+	result += test_reorder_fifo_rejects();
+	result += test_reorder_fifo_messages_moved();
+	result += test_reorder_fifo_window_backpressure();
+	result += test_reorder_fifo_parallel_workers();
+
+	if (result == 0) {
+		std::cout << "ReorderFIFO tests passed!" << std::endl;
+	} else {
+		std::cout << result << " ReorderFIFO tests failed." << std::endl;
+	}
+	return result;
+}
@@ -0,0 +1,212 @@
+#include <StormByte/buffer/segmented_fifo.hxx>
+#include <StormByte/buffer/producer.hxx>
+#include <StormByte/buffer/consumer.hxx>
+#include <StormByte/string.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using StormByte::Buffer::Consumer;
+using StormByte::Buffer::DataType;
+using StormByte::Buffer::Position;
+using StormByte::Buffer::Producer;
+using StormByte::Buffer::SegmentedFIFO;
+
+static std::string toString(const DataType& v) {
+	return StormByte::String::FromByteVector(v);
+}
+
+int test_segmented_fifo_write_read_across_segments() {
+	SegmentedFIFO fifo;
+	(void)fifo.Write(std::string("ABC"));
+	(void)fifo.Write(std::string("DEFG"));
+	(void)fifo.Write(std::string("HIJ"));
+	ASSERT_EQUAL("size", fifo.Size(), static_cast<std::size_t>(10));
+
+	DataType out;
+	ASSERT_TRUE("read spanning segments", fifo.Read(5, out));
+	ASSERT_EQUAL("read content", toString(out), std::string("ABCDE"));
+	ASSERT_EQUAL("available after read", fifo.AvailableBytes(), static_cast<std::size_t>(5));
+	ASSERT_EQUAL("read keeps bytes", fifo.Size(), static_cast<std::size_t>(10));
+
+	out.clear();
+	ASSERT_TRUE("read rest", fifo.Read(0, out));
+	ASSERT_EQUAL("rest content", toString(out), std::string("FGHIJ"));
+	RETURN_TEST("test_segmented_fifo_write_read_across_segments", 0);
+}
+
+int test_segmented_fifo_extract_releases() {
+	SegmentedFIFO fifo;
+	(void)fifo.Write(std::string("0123"));
+	(void)fifo.Write(std::string("4567"));
+
+	DataType out;
+	ASSERT_TRUE("extract", fifo.Extract(6, out));
+	ASSERT_EQUAL("extract content", toString(out), std::string("012345"));
+	ASSERT_EQUAL("released", fifo.Size(), static_cast<std::size_t>(2));
+
+	out.clear();
+	ASSERT_TRUE("extract rest", fifo.Extract(0, out));
+	ASSERT_EQUAL("rest content", toString(out), std::string("67"));
+	ASSERT_TRUE("empty", fifo.Empty());
+	RETURN_TEST("test_segmented_fifo_extract_releases", 0);
+}
+
+int test_segmented_fifo_seek_and_clean() {
+	SegmentedFIFO fifo;
+	(void)fifo.Write(std::string("Hello"));
+	(void)fifo.Write(std::string("World"));
+
+	DataType out;
+	ASSERT_TRUE("read", fifo.Read(7, out));
+	fifo.Seek(-4, Position::Relative);
+	out.clear();
+	ASSERT_TRUE("reread", fifo.Read(4, out));
+	ASSERT_EQUAL("reread content", toString(out), std::string("loWo"));
+
+	fifo.Seek(1, Position::Absolute);
+	out.clear();
+	ASSERT_TRUE("peek", fifo.Peek(3, out));
+	ASSERT_EQUAL("peek content", toString(out), std::string("ell"));
+	ASSERT_EQUAL("peek keeps position", fifo.AvailableBytes(), static_cast<std::size_t>(9));
+
+	fifo.Seek(6, Position::Absolute);
+	fifo.Clean();
+	ASSERT_EQUAL("clean releases", fifo.Size(), static_cast<std::size_t>(4));
+	fifo.Seek(0, Position::Absolute);
+	out.clear();
+	ASSERT_TRUE("read after clean", fifo.Read(0, out));
+	ASSERT_EQUAL("after clean content", toString(out), std::string("orld"));
+	RETURN_TEST("test_segmented_fifo_seek_and_clean", 0);
+}
+
+int test_segmented_fifo_drop_and_clear() {
+	SegmentedFIFO fifo;
+	(void)fifo.Write(std::string("abcdef"));
+	ASSERT_TRUE("drop", fifo.Drop(2));
+	ASSERT_EQUAL("drop releases", fifo.Size(), static_cast<std::size_t>(4));
+	fifo.Close();
+	ASSERT_FALSE("drop too much on closed", fifo.Drop(10));
+
+	SegmentedFIFO other;
+	(void)other.Write(std::string("xyz"));
+	other.Clear();
+	ASSERT_TRUE("clear empties", other.Empty());
+	ASSERT_EQUAL("clear available", other.AvailableBytes(), static_cast<std::size_t>(0));
+	(void)other.Write(std::string("after"));
+	DataType out;
+	ASSERT_TRUE("write after clear", other.Read(0, out));
+	ASSERT_EQUAL("after clear content", toString(out), std::string("after"));
+	RETURN_TEST("test_segmented_fifo_drop_and_clear", 0);
+}
+
+int test_segmented_fifo_close_and_error() {
+	SegmentedFIFO fifo;
+	std::atomic<bool> failed{false};
+	std::thread reader([&]() {
+		DataType out;
+		failed = !fifo.Read(10, out);
+	});
+	(void)fifo.Write(std::string("abc"));
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	fifo.Close();
+	reader.join();
+
+	ASSERT_TRUE("insufficient read fails after close", failed.load());
+	ASSERT_FALSE("write after close", fifo.Write(std::string("x")));
+	ASSERT_FALSE("not eof with data", fifo.EoF());
+
+	SegmentedFIFO errored;
+	errored.SetError();
+	ASSERT_TRUE("error eof", errored.EoF());
+	ASSERT_FALSE("error not writable", errored.IsWritable());
+	RETURN_TEST("test_segmented_fifo_close_and_error", 0);
+}
+
+int test_segmented_fifo_blocking_producer_consumer() {
+	Producer producer(std::make_shared<SegmentedFIFO>());
+	Consumer consumer = producer.Consumer();
+	constexpr std::size_t total = 1024 * 1024;
+
+	std::size_t expected = 0;
+	std::thread writer([&]() {
+		for (std::size_t i = 0; i < total; i += 4096) {
+			DataType block(4096);
+			for (std::size_t j = 0; j < block.size(); ++j)
+				block[j] = static_cast<std::byte>((i + j) & 0xFF);
+			(void)producer.Write(std::move(block));
+		}
+		producer.Close();
+	});
+	for (std::size_t i = 0; i < total; ++i)
+		expected += i & 0xFF;
+
+	std::size_t sum = 0, received = 0;
+	while (!consumer.EoF()) {
+		DataType chunk;
+		if (consumer.Extract(10000, chunk) || consumer.Extract(0, chunk)) {
+			received += chunk.size();
+			for (std::byte b: chunk)
+				sum += std::to_integer<unsigned char>(b);
+		}
+	}
+	writer.join();
+
+	ASSERT_EQUAL("received all", received, total);
+	ASSERT_EQUAL("checksum", sum, expected);
+	RETURN_TEST("test_segmented_fifo_blocking_producer_consumer", 0);
+}
+
+int test_segmented_fifo_multi_producer_counts() {
+	auto fifo = std::make_shared<SegmentedFIFO>();
+	constexpr int producers = 4;
+	constexpr int writes = 2000;
+
+	std::vector<std::thread> threads;
+	for (int p = 0; p < producers; ++p) {
+		threads.emplace_back([fifo]() {
+			for (int i = 0; i < writes; ++i)
+				(void)fifo->Write(std::string("xy"));
+		});
+	}
+
+	std::size_t received = 0;
+	std::thread reader([&]() {
+		DataType out;
+		while (received < producers * writes * 2) {
+			out.clear();
+			if (fifo->Extract(2, out))
+				received += out.size();
+		}
+	});
+	for (auto& t: threads)
+		t.join();
+	reader.join();
+
+	ASSERT_EQUAL("received", received, static_cast<std::size_t>(producers * writes * 2));
+	ASSERT_TRUE("drained", fifo->Empty());
+	RETURN_TEST("test_segmented_fifo_multi_producer_counts", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_segmented_fifo_write_read_across_segments();
+	result += test_segmented_fifo_extract_releases();
+	result += test_segmented_fifo_seek_and_clean();
+	result += test_segmented_fifo_drop_and_clear();
+	result += test_segmented_fifo_close_and_error();
+	result += test_segmented_fifo_blocking_producer_consumer();
+	result += test_segmented_fifo_multi_producer_counts();
+
+	if (result == 0) {
+		std::cout << "SegmentedFIFO tests passed!" << std::endl;
+	} else {
+		std::cout << result << " SegmentedFIFO tests failed." << std::endl;
+	}
+	return result;
+}
\ No newline at end of file
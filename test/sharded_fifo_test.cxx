@@ -0,0 +1,238 @@
+#include <StormByte/buffer/sharded_fifo.hxx>
+#include <StormByte/buffer/pipeline.hxx>
+#include <StormByte/logger/log.hxx>
+#include <StormByte/string.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using StormByte::Buffer::Consumer;
+using StormByte::Buffer::DataType;
+using StormByte::Buffer::ExecutionMode;
+using StormByte::Buffer::Pipeline;
+using StormByte::Buffer::Producer;
+using StormByte::Buffer::ShardedFIFO;
+using StormByte::Buffer::ShardOrder;
+
+static std::ostringstream logging_stream;
+static std::shared_ptr<StormByte::Logger::Log> logging = std::make_shared<StormByte::Logger::Log>(logging_stream, StormByte::Logger::Level::Info);
+
+static std::string toString(const DataType& v) {
+	return StormByte::String::FromByteVector(v);
+}
+
+// Each write comes from a fresh thread, so it lands in the next shard
+static void writeFromThread(ShardedFIFO& fifo, const std::string& data) {
+	std::thread([&]() { (void)fifo.Write(data); }).join();
+}
+
+int test_sharded_fifo_basic_read_peek_extract() {
+	ShardedFIFO fifo(4);
+	ASSERT_EQUAL("shards", fifo.Shards(), static_cast<std::size_t>(4));
+	(void)fifo.Write(std::string("Hello "));
+	(void)fifo.Write(std::string("World"));
+	ASSERT_EQUAL("available", fifo.AvailableBytes(), static_cast<std::size_t>(11));
+
+	DataType out;
+	ASSERT_TRUE("peek", fifo.Peek(8, out));
+	ASSERT_EQUAL("peek content", toString(out), std::string("Hello Wo"));
+	ASSERT_EQUAL("peek keeps bytes", fifo.AvailableBytes(), static_cast<std::size_t>(11));
+
+	out.clear();
+	ASSERT_TRUE("read", fifo.Read(3, out));
+	ASSERT_EQUAL("read content", toString(out), std::string("Hel"));
+	ASSERT_EQUAL("read consumes", fifo.AvailableBytes(), static_cast<std::size_t>(8));
+
+	fifo.Seek(1, StormByte::Buffer::Position::Relative);
+	out.clear();
+	ASSERT_TRUE("extract rest", fifo.Extract(0, out));
+	ASSERT_EQUAL("extract content", toString(out), std::string("o World"));
+	ASSERT_TRUE("empty", fifo.Empty());
+	ASSERT_TRUE("default shards", ShardedFIFO().Shards() >= 1);
+	RETURN_TEST("test_sharded_fifo_basic_read_peek_extract", 0);
+}
+
+int test_sharded_fifo_round_robin_order() {
+	ShardedFIFO fifo(3, ShardOrder::RoundRobin);
+	for (const char* writer: { "a", "b", "c" }) {
+		std::thread([&fifo, writer]() {
+			for (int i = 0; i < 2; ++i)
+				(void)fifo.Write(std::string(writer) + std::to_string(i));
+		}).join();
+	}
+
+	DataType out;
+	ASSERT_TRUE("read all", fifo.Extract(0, out));
+	const std::string result = toString(out);
+	ASSERT_EQUAL("size", result.size(), static_cast<std::size_t>(12));
+	// One write per shard in turn: each round holds every writer once
+	std::set<char> first { result[0], result[2], result[4] };
+	ASSERT_EQUAL("first round", first.size(), static_cast<std::size_t>(3));
+	ASSERT_EQUAL("round order kept", result.substr(6, 1) + result.substr(8, 1) + result.substr(10, 1),
+		result.substr(0, 1) + result.substr(2, 1) + result.substr(4, 1));
+	for (std::size_t i = 0; i < 6; i += 2)
+		ASSERT_EQUAL("writer order", result.substr(i + 1, 1) + result.substr(i + 7, 1), std::string("01"));
+	RETURN_TEST("test_sharded_fifo_round_robin_order", 0);
+}
+
+int test_sharded_fifo_shards_assigned_per_instance() {
+	ShardedFIFO fifo(2, ShardOrder::RoundRobin);
+	ShardedFIFO other(2);
+	// A thread writing to another FIFO in between must not shift this one's shards
+	auto writer = [&fifo](const std::string& name) {
+		std::thread([&fifo, name]() {
+			for (int i = 0; i < 2; ++i)
+				(void)fifo.Write(name + std::to_string(i));
+		}).join();
+	};
+	writer("a");
+	writeFromThread(other, "x");
+	writer("b");
+
+	DataType out;
+	ASSERT_TRUE("read first round", fifo.Read(4, out));
+	const std::string first = toString(out);
+	ASSERT_TRUE("writers on different shards", first == "a0b0" || first == "b0a0");
+	RETURN_TEST("test_sharded_fifo_shards_assigned_per_instance", 0);
+}
+
+int test_sharded_fifo_timestamp_order() {
+	ShardedFIFO fifo(4, ShardOrder::Timestamp);
+	ASSERT_TRUE("order", fifo.Order() == ShardOrder::Timestamp);
+	for (const char* data: { "one ", "two ", "three ", "four ", "five" })
+		writeFromThread(fifo, data);
+
+	DataType out;
+	ASSERT_TRUE("peek", fifo.Peek(0, out));
+	ASSERT_EQUAL("peek in write order", toString(out), std::string("one two three four five"));
+	out.clear();
+	ASSERT_TRUE("read part", fifo.Read(6, out));
+	ASSERT_EQUAL("read part content", toString(out), std::string("one tw"));
+	out.clear();
+	ASSERT_TRUE("read rest", fifo.Read(0, out));
+	ASSERT_EQUAL("partial write finished first", toString(out), std::string("o three four five"));
+	RETURN_TEST("test_sharded_fifo_timestamp_order", 0);
+}
+
+int test_sharded_fifo_writes_stay_whole() {
+	auto fifo = std::make_shared<ShardedFIFO>(4);
+	constexpr int producers = 8;
+	constexpr int writes = 500;
+	constexpr std::size_t record = 32;
+
+	std::vector<std::thread> threads;
+	for (int p = 0; p < producers; ++p) {
+		threads.emplace_back([fifo, p]() {
+			for (int i = 0; i < writes; ++i)
+				(void)fifo->Write(DataType(record, static_cast<std::byte>('A' + p)));
+		});
+	}
+
+	std::vector<int> per_producer(producers, 0);
+	bool mixed = false;
+	for (int r = 0; r < producers * writes; ++r) {
+		DataType out;
+		if (!fifo->Extract(record, out))
+			break;
+		for (std::byte b: out)
+			if (b != out[0])
+				mixed = true;
+		per_producer[std::to_integer<int>(out[0]) - 'A']++;
+	}
+	for (auto& t: threads)
+		t.join();
+
+	ASSERT_FALSE("no interleaved records", mixed);
+	for (int p = 0; p < producers; ++p)
+		ASSERT_EQUAL("per producer count", per_producer[p], writes);
+	ASSERT_TRUE("drained", fifo->Empty());
+	RETURN_TEST("test_sharded_fifo_writes_stay_whole", 0);
+}
+
+int test_sharded_fifo_close_and_error() {
+	ShardedFIFO fifo(2);
+	std::atomic<bool> failed{false};
+	std::thread reader([&]() {
+		DataType out;
+		failed = !fifo.Read(10, out);
+	});
+	writeFromThread(fifo, "abc");
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	fifo.Close();
+	reader.join();
+
+	ASSERT_TRUE("insufficient read fails after close", failed.load());
+	ASSERT_FALSE("write after close", fifo.Write(std::string("x")));
+	ASSERT_FALSE("not eof with data", fifo.EoF());
+	ASSERT_TRUE("drop rest", fifo.Drop(3));
+	ASSERT_TRUE("eof", fifo.EoF());
+
+	ShardedFIFO errored(2);
+	errored.SetError();
+	ASSERT_TRUE("error eof", errored.EoF());
+	ASSERT_FALSE("error not writable", errored.IsWritable());
+	ASSERT_FALSE("write after error", errored.Write(std::string("x")));
+	RETURN_TEST("test_sharded_fifo_close_and_error", 0);
+}
+
+int test_sharded_fifo_as_pipeline_input() {
+	Producer producer(std::make_shared<ShardedFIFO>(4));
+	Pipeline pipeline;
+	pipeline.AddPipe([](Consumer in, Producer out, std::shared_ptr<StormByte::Logger::Log>) {
+		while (!in.EoF()) {
+			DataType data;
+			if (in.Extract(0, data) || in.Extract(1, data)) {
+				for (auto& b: data)
+					b = static_cast<std::byte>(std::toupper(std::to_integer<unsigned char>(b)));
+				(void)out.Write(std::move(data));
+			}
+		}
+		out.Close();
+	});
+	Consumer result = pipeline.Process(producer.Consumer(), ExecutionMode::Async, logging);
+
+	constexpr int producers = 4;
+	constexpr int writes = 1000;
+	std::vector<std::thread> writers;
+	for (int p = 0; p < producers; ++p) {
+		writers.emplace_back([producer]() mutable {
+			for (int i = 0; i < writes; ++i)
+				(void)producer.Write(std::string("abcd"));
+		});
+	}
+	for (auto& t: writers)
+		t.join();
+	producer.Close();
+
+	DataType out;
+	result.ExtractUntilEoF(out);
+	ASSERT_EQUAL("all bytes through the stage", out.size(), static_cast<std::size_t>(producers * writes * 4));
+	ASSERT_EQUAL("transformed", toString(DataType(out.begin(), out.begin() + 8)), std::string("ABCDABCD"));
+	RETURN_TEST("test_sharded_fifo_as_pipeline_input", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_sharded_fifo_basic_read_peek_extract();
+	result += test_sharded_fifo_round_robin_order();
+	result += test_sharded_fifo_shards_assigned_per_instance();
+	result += test_sharded_fifo_timestamp_order();
+	result += test_sharded_fifo_writes_stay_whole();
+	result += test_sharded_fifo_close_and_error();
+	result += test_sharded_fifo_as_pipeline_input();
+
+	if (result == 0) {
+		std::cout << "ShardedFIFO tests passed!" << std::endl;
+	} else {
+		std::cout << result << " ShardedFIFO tests failed." << std::endl;
+	}
+	return result;
+}
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include <atomic>
 #include <chrono>
 #include <iostream>
+#include <mutex>
 
 using StormByte::Buffer::SharedFIFO;
 using StormByte::Buffer::Position;
@@ -517,6 +518,60 @@ int test_shared_fifo_available_bytes_concurrent() {
 	RETURN_TEST("test_shared_fifo_available_bytes_concurrent", 0);
 }
 
+int test_shared_fifo_status_queries_while_writing() {
+	SharedFIFO fifo;
+	constexpr std::size_t writes = 5000;
+	std::atomic<bool> stop{false};
+	std::atomic<std::size_t> polls{0};
+	std::atomic<bool> inconsistent{false};
+
+	// Pollers hammer the lock-free status queries while data flows
+	std::vector<std::thread> pollers;
+	for (int p = 0; p < 4; ++p) {
+		pollers.emplace_back([&]() -> void {
+			while (!stop.load()) {
+				// Closed never reverts, so once EoF is seen the FIFO must be unwritable
+				const bool eof = fifo.EoF();
+				const bool writable = fifo.IsWritable();
+				const std::size_t available = fifo.AvailableBytes();
+				if (eof && writable)
+					inconsistent.store(true);
+				if (available > writes * 4)
+					inconsistent.store(true);
+				(void)fifo.Size();
+				(void)fifo.Empty();
+				polls.fetch_add(1);
+			}
+		});
+	}
+
+	std::thread writer([&]() -> void {
+		for (std::size_t i = 0; i < writes; ++i)
+			(void)fifo.Write("DATA");
+		fifo.Close();
+	});
+
+	std::size_t total = 0;
+	while (!fifo.EoF()) {
+		std::vector<std::byte> data;
+		if (fifo.Read(4, data))
+			total += data.size();
+		if (total % 400 == 0)
+			fifo.Clean();
+	}
+
+	writer.join();
+	stop.store(true);
+	for (auto& t : pollers) t.join();
+
+	ASSERT_EQUAL("all bytes read", total, writes * 4);
+	ASSERT_TRUE("pollers ran", polls.load() > 0);
+	ASSERT_FALSE("status queries consistent", inconsistent.load());
+	ASSERT_TRUE("eof at end", fifo.EoF());
+	ASSERT_FALSE("not writable at end", fifo.IsWritable());
+	RETURN_TEST("test_shared_fifo_status_queries_while_writing", 0);
+}
+
 int test_shared_fifo_read_closed_no_data_nonblocking() {
 	SharedFIFO fifo;
 	fifo.Close();
@@ -766,6 +821,214 @@ int test_hexdump3() {
 	RETURN_TEST(fn_name.c_str(), 0);
 }
 
+int test_shared_fifo_on_readable_one_shot() {
+	SharedFIFO fifo;
+	int fired = 0;
+	const std::size_t id = fifo.OnReadable(4, [&fired]() { ++fired; });
+	(void)fifo.Write(std::string("ab"));
+	ASSERT_EQUAL("not enough bytes", fired, 0);
+	(void)fifo.Write(std::string("cd"));
+	ASSERT_EQUAL("fired by the write", fired, 1);
+	(void)fifo.Write(std::string("ef"));
+	ASSERT_EQUAL("one-shot", fired, 1);
+	ASSERT_FALSE("already gone", fifo.RemoveCallback(id));
+
+	(void)fifo.OnReadable(1, [&fired]() { ++fired; });
+	ASSERT_EQUAL("already readable fires at once", fired, 2);
+	RETURN_TEST("test_shared_fifo_on_readable_one_shot", 0);
+}
+
+int test_shared_fifo_on_readable_persistent() {
+	SharedFIFO fifo;
+	int fired = 0;
+	std::string received;
+	// The buffer lock is not held: the callback can read from it
+	const std::size_t id = fifo.OnReadable(1, [&]() {
+		++fired;
+		std::vector<std::byte> out;
+		if (fifo.Extract(0, out))
+			received += toString(out);
+	}, true);
+	(void)fifo.Write(std::string("one "));
+	(void)fifo.Write(std::string("two "));
+	(void)fifo.Write(std::string("three"));
+	ASSERT_EQUAL("fired on every write", fired, 3);
+	ASSERT_EQUAL("drained from the callback", received, std::string("one two three"));
+	ASSERT_TRUE("removed", fifo.RemoveCallback(id));
+	(void)fifo.Write(std::string("four"));
+	ASSERT_EQUAL("not fired once removed", fired, 3);
+	RETURN_TEST("test_shared_fifo_on_readable_persistent", 0);
+}
+
+int test_shared_fifo_on_writable_bounded() {
+	SharedFIFO fifo(4);
+	int fired = 0;
+	(void)fifo.Write(std::string("1234"));
+	(void)fifo.OnWritable(2, [&fired]() { ++fired; });
+	ASSERT_EQUAL("full", fired, 0);
+	std::vector<std::byte> out;
+	ASSERT_TRUE("extract one", fifo.Extract(1, out));
+	ASSERT_EQUAL("still no room for two", fired, 0);
+	ASSERT_TRUE("extract another", fifo.Extract(1, out));
+	ASSERT_EQUAL("room freed", fired, 1);
+
+	SharedFIFO unbounded;
+	(void)unbounded.Write(std::string("data"));
+	(void)unbounded.OnWritable(1024, [&fired]() { ++fired; });
+	ASSERT_EQUAL("unbounded is always writable", fired, 2);
+	RETURN_TEST("test_shared_fifo_on_writable_bounded", 0);
+}
+
+int test_shared_fifo_on_closed_and_error() {
+	SharedFIFO fifo;
+	bool closed = false, readable = false, errored = false;
+	(void)fifo.OnClosed([&closed]() { closed = true; });
+	(void)fifo.OnReadable(10, [&readable]() { readable = true; });
+	(void)fifo.OnError([&errored]() { errored = true; });
+	fifo.Close();
+	ASSERT_TRUE("closed fired", closed);
+	ASSERT_TRUE("end of stream is readable", readable);
+	ASSERT_FALSE("no error yet", errored);
+	fifo.SetError();
+	ASSERT_TRUE("error fired", errored);
+
+	bool late = false;
+	(void)fifo.OnClosed([&late]() { late = true; });
+	ASSERT_TRUE("registered after close fires at once", late);
+	RETURN_TEST("test_shared_fifo_on_closed_and_error", 0);
+}
+
+int test_shared_fifo_callbacks_from_writer_threads() {
+	SharedFIFO fifo;
+	std::mutex mutex;
+	std::size_t received = 0;
+	std::atomic<bool> closed {false};
+	(void)fifo.OnReadable(1, [&]() {
+		std::scoped_lock<std::mutex> lock(mutex);
+		std::vector<std::byte> out;
+		if (fifo.Extract(0, out))
+			received += out.size();
+	}, true);
+	(void)fifo.OnClosed([&closed]() { closed = true; });
+
+	constexpr int writers = 4;
+	constexpr int writes = 1000;
+	std::vector<std::thread> threads;
+	for (int w = 0; w < writers; ++w) {
+		threads.emplace_back([&fifo]() {
+			for (int i = 0; i < writes; ++i)
+				(void)fifo.Write(std::string("abcd"));
+		});
+	}
+	for (auto& t: threads)
+		t.join();
+	fifo.Close();
+
+	std::scoped_lock<std::mutex> lock(mutex);
+	ASSERT_EQUAL("every byte delivered by callbacks", received, static_cast<std::size_t>(writers * writes * 4));
+	ASSERT_TRUE("closed", closed.load());
+	RETURN_TEST("test_shared_fifo_callbacks_from_writer_threads", 0);
+}
+
+int test_shared_fifo_statistics() {
+	SharedFIFO fifo;
+	(void)fifo.Write(std::string("not counted"));
+	ASSERT_EQUAL("disabled", fifo.Statistics().bytes_written, static_cast<std::size_t>(0));
+	fifo.EnableStatistics();
+	std::vector<std::byte> out;
+	ASSERT_TRUE("drain", fifo.Extract(0, out));
+	(void)fifo.Write(std::string("abcdef"));
+	(void)fifo.Write(std::string("gh"));
+	ASSERT_TRUE("extract", fifo.Extract(3, out));
+	ASSERT_TRUE("drop", fifo.Drop(2));
+
+	// A reader blocked until a writer provides the bytes
+	std::thread writer([&fifo]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		(void)fifo.Write(std::string("ij"));
+	});
+	ASSERT_TRUE("blocking extract", fifo.Extract(5, out));
+	writer.join();
+
+	const SharedFIFO::Counters counters = fifo.Statistics();
+	ASSERT_EQUAL("bytes written", counters.bytes_written, static_cast<std::size_t>(10));
+	ASSERT_EQUAL("bytes read", counters.bytes_read, static_cast<std::size_t>(11 + 3 + 2 + 5));
+	ASSERT_EQUAL("peak", counters.peak_bytes, static_cast<std::size_t>(11));
+	ASSERT_TRUE("reader wait", counters.read_wait >= std::chrono::milliseconds(10));
+	ASSERT_EQUAL("no writer wait", counters.write_wait.count(), static_cast<std::chrono::nanoseconds::rep>(0));
+	RETURN_TEST("test_shared_fifo_statistics", 0);
+}
+
+int test_shared_fifo_statistics_bounded_write_wait() {
+	SharedFIFO fifo(4);
+	fifo.EnableStatistics();
+	(void)fifo.Write(std::string("1234"));
+	std::thread reader([&fifo]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		std::vector<std::byte> out;
+		(void)fifo.Extract(4, out);
+	});
+	ASSERT_TRUE("write waits for room", fifo.Write(std::string("5678")));
+	reader.join();
+
+	const SharedFIFO::Counters counters = fifo.Statistics();
+	ASSERT_EQUAL("bytes written", counters.bytes_written, static_cast<std::size_t>(8));
+	ASSERT_EQUAL("peak bounded", counters.peak_bytes, static_cast<std::size_t>(4));
+	ASSERT_TRUE("writer wait", counters.write_wait >= std::chrono::milliseconds(10));
+	RETURN_TEST("test_shared_fifo_statistics_bounded_write_wait", 0);
+}
+
+int test_shared_fifo_bounded_read_frees_room() {
+	SharedFIFO fifo(4);
+	(void)fifo.Write(std::string("1234"));
+	std::thread reader([&fifo]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		std::vector<std::byte> out;
+		(void)fifo.Read(4, out);
+	});
+	ASSERT_TRUE("write wakes on read", fifo.Write(std::string("5678")));
+	reader.join();
+	ASSERT_EQUAL("read bytes still retained", fifo.Size(), static_cast<std::size_t>(8));
+	ASSERT_EQUAL("only the second write unread", fifo.AvailableBytes(), static_cast<std::size_t>(4));
+	std::vector<std::byte> out;
+	ASSERT_TRUE("read the second write", fifo.Read(4, out));
+	ASSERT_EQUAL("second write intact", toString(out), std::string("5678"));
+	fifo.Seek(0, Position::Absolute);
+	std::vector<std::byte> again;
+	ASSERT_TRUE("seek back to read bytes", fifo.Read(4, again));
+	ASSERT_EQUAL("read bytes intact", toString(again), std::string("1234"));
+	RETURN_TEST("test_shared_fifo_bounded_read_frees_room", 0);
+}
+
+int test_shared_fifo_bounded_read_more_than_unread() {
+	// The second write does not fit while the reader waits for more than the first
+	SharedFIFO fifo(10);
+	std::thread writer([&fifo]() {
+		(void)fifo.Write(std::string("abcdef"));
+		(void)fifo.Write(std::string("ghijkl"));
+	});
+	std::vector<std::byte> out;
+	ASSERT_TRUE("read past the first write", fifo.Read(8, out));
+	writer.join();
+	ASSERT_EQUAL("read bytes", toString(out), std::string("abcdefgh"));
+	out.clear();
+	ASSERT_TRUE("read the rest", fifo.Read(4, out));
+	ASSERT_EQUAL("rest", toString(out), std::string("ijkl"));
+
+	// A read larger than the limit
+	SharedFIFO bounded(10);
+	std::thread chunks([&bounded]() {
+		for (int i = 0; i < 5; ++i)
+			(void)bounded.Write(std::string("012345"));
+	});
+	out.clear();
+	ASSERT_TRUE("extract more than the limit", bounded.Extract(25, out));
+	ASSERT_EQUAL("extracted", out.size(), static_cast<std::size_t>(25));
+	chunks.join();
+	ASSERT_EQUAL("last bytes unread", bounded.AvailableBytes(), static_cast<std::size_t>(5));
+	RETURN_TEST("test_shared_fifo_bounded_read_more_than_unread", 0);
+}
+
 int main() {
 	int result = 0;
 	result += test_shared_fifo_producer_consumer_blocking();
@@ -784,6 +1047,7 @@ int main() {
 	result += test_shared_fifo_blocking_read_insufficient_not_closed();
 	result += test_shared_fifo_available_bytes_basic();
 	result += test_shared_fifo_available_bytes_concurrent();
+	result += test_shared_fifo_status_queries_while_writing();
 	result += test_shared_fifo_read_closed_no_data_nonblocking();
 	result += test_shared_fifo_extract_closed_no_data_nonblocking();
 	result += test_sharedfifo_equality();
@@ -796,6 +1060,15 @@ int main() {
 	result += test_hexdump1();
 	result += test_hexdump2();
 	result += test_hexdump3();
+	result += test_shared_fifo_on_readable_one_shot();
+	result += test_shared_fifo_on_readable_persistent();
+	result += test_shared_fifo_on_writable_bounded();
+	result += test_shared_fifo_on_closed_and_error();
+	result += test_shared_fifo_callbacks_from_writer_threads();
+	result += test_shared_fifo_statistics();
+	result += test_shared_fifo_statistics_bounded_write_wait();
+	result += test_shared_fifo_bounded_read_frees_room();
+	result += test_shared_fifo_bounded_read_more_than_unread();
 
 	if (result == 0) {
 		std::cout << "SharedFIFO tests passed!" << std::endl;
@@ -0,0 +1,107 @@
+#include <StormByte/buffer/thread_pool.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+using StormByte::Buffer::ThreadPool;
+
+int test_thread_pool_runs_every_task() {
+	std::atomic<int> counter {0};
+	{
+		ThreadPool pool(4);
+		ASSERT_EQUAL("workers", pool.Threads(), static_cast<std::size_t>(4));
+		ASSERT_EQUAL("fixed capacity", pool.Capacity(), static_cast<std::size_t>(4));
+		for (int i = 0; i < 1000; ++i)
+			pool.Post([&counter]() { ++counter; });
+	}
+	ASSERT_EQUAL("destructor drains the queue", counter.load(), 1000);
+	RETURN_TEST("test_thread_pool_runs_every_task", 0);
+}
+
+int test_thread_pool_single_worker_order() {
+	std::vector<int> order;
+	{
+		ThreadPool pool(1);
+		for (int i = 0; i < 100; ++i)
+			pool.Post([&order, i]() { order.push_back(i); });
+	}
+	bool ordered = order.size() == 100;
+	for (int i = 0; ordered && i < 100; ++i)
+		ordered = order[i] == i;
+	ASSERT_TRUE("posting order kept", ordered);
+	RETURN_TEST("test_thread_pool_single_worker_order", 0);
+}
+
+int test_thread_pool_grows_for_blocking_tasks() {
+	constexpr int tasks = 8;
+	std::mutex mutex;
+	std::condition_variable cv;
+	int arrived = 0;
+	{
+		ThreadPool pool(1, true);
+		ASSERT_EQUAL("no capacity limit", pool.Capacity(), static_cast<std::size_t>(0));
+		// Every task waits for all the others: only a growing pool can finish
+		for (int i = 0; i < tasks; ++i) {
+			pool.Post([&]() {
+				std::unique_lock<std::mutex> lock(mutex);
+				++arrived;
+				cv.notify_all();
+				cv.wait(lock, [&]() { return arrived == tasks; });
+			});
+		}
+		ASSERT_TRUE("spares started", pool.Threads() >= static_cast<std::size_t>(tasks));
+	}
+	ASSERT_EQUAL("all tasks met", arrived, tasks);
+	RETURN_TEST("test_thread_pool_grows_for_blocking_tasks", 0);
+}
+
+int test_thread_pool_post_from_task() {
+	std::atomic<int> counter {0};
+	{
+		ThreadPool pool(2);
+		pool.Post([&pool, &counter]() {
+			++counter;
+			pool.Post([&counter]() { ++counter; });
+		});
+	}
+	ASSERT_EQUAL("nested task ran", counter.load(), 2);
+	RETURN_TEST("test_thread_pool_post_from_task", 0);
+}
+
+int test_thread_pool_shared() {
+	auto first = ThreadPool::Shared();
+	auto second = ThreadPool::Shared();
+	ASSERT_TRUE("same pool", first == second);
+	std::atomic<bool> ran {false};
+	std::mutex mutex;
+	std::condition_variable cv;
+	first->Post([&]() {
+		std::scoped_lock<std::mutex> lock(mutex);
+		ran = true;
+		cv.notify_all();
+	});
+	std::unique_lock<std::mutex> lock(mutex);
+	ASSERT_TRUE("task ran", cv.wait_for(lock, std::chrono::seconds(5), [&]() { return ran.load(); }));
+	RETURN_TEST("test_thread_pool_shared", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_thread_pool_runs_every_task();
+	result += test_thread_pool_single_worker_order();
+	result += test_thread_pool_grows_for_blocking_tasks();
+	result += test_thread_pool_post_from_task();
+	result += test_thread_pool_shared();
+
+	if (result == 0) {
+		std::cout << "ThreadPool tests passed!" << std::endl;
+	} else {
+		std::cout << result << " ThreadPool tests failed." << std::endl;
+	}
+	return result;
+}
@@ -0,0 +1,118 @@
+#include <StormByte/buffer/shared_fifo.hxx>
+#include <StormByte/buffer/tracer.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using StormByte::Buffer::SharedFIFO;
+using StormByte::Buffer::Tracer;
+
+static std::size_t count(const std::string& text, const std::string& pattern) {
+	std::size_t found = 0;
+	for (std::size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1))
+		++found;
+	return found;
+}
+
+int test_tracer_empty() {
+	Tracer tracer;
+	ASSERT_EQUAL("no events", tracer.Events(), static_cast<std::size_t>(0));
+	const std::string json = tracer.Json();
+	ASSERT_TRUE("trace array", json.find("\"traceEvents\":[") != std::string::npos);
+	ASSERT_EQUAL("no entries", count(json, "\"ph\""), static_cast<std::size_t>(0));
+	RETURN_TEST("test_tracer_empty", 0);
+}
+
+int test_tracer_threads() {
+	constexpr int threads = 4;
+	constexpr int events = 3000;
+	Tracer tracer;
+	std::vector<std::thread> workers;
+	for (int t = 0; t < threads; ++t) {
+		workers.emplace_back([&tracer, t]() {
+			for (int i = 0; i < events; ++i)
+				tracer.Record(Tracer::Kind::Write, static_cast<std::uint32_t>(t), 16);
+		});
+	}
+	// Rendering while threads record sees a prefix of every lane
+	(void)tracer.Json();
+	for (auto& worker: workers)
+		worker.join();
+
+	ASSERT_EQUAL("every event kept", tracer.Events(), static_cast<std::size_t>(threads * events));
+	ASSERT_EQUAL("none dropped", tracer.Dropped(), static_cast<std::size_t>(0));
+	const std::string json = tracer.Json();
+	ASSERT_EQUAL("every event rendered", count(json, "\"name\":\"write\""), static_cast<std::size_t>(threads * events));
+	for (int t = 1; t <= threads; ++t)
+		ASSERT_TRUE("one lane per thread", json.find("\"tid\":" + std::to_string(t) + "}") != std::string::npos);
+	RETURN_TEST("test_tracer_threads", 0);
+}
+
+int test_tracer_shared_fifo_events() {
+	auto tracer = std::make_shared<Tracer>();
+	SharedFIFO fifo;
+	ASSERT_TRUE("enabled", fifo.EnableTracing(tracer, 7));
+	ASSERT_FALSE("set once", fifo.EnableTracing(std::make_shared<Tracer>(), 8));
+	ASSERT_FALSE("null tracer", SharedFIFO().EnableTracing(nullptr, 1));
+
+	std::thread writer([&fifo]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		(void)fifo.Write(std::string("abcd"));
+		fifo.Close();
+	});
+	std::vector<std::byte> out;
+	ASSERT_TRUE("blocking read", fifo.Extract(4, out));
+	writer.join();
+	fifo.SetError();
+
+	const std::string json = tracer->Json();
+	ASSERT_EQUAL("write", count(json, "{\"name\":\"write\",\"cat\":\"buffer\",\"ph\":\"i\",\"s\":\"t\",\"args\":{\"buffer\":7,\"bytes\":4}"), static_cast<std::size_t>(1));
+	ASSERT_EQUAL("read", count(json, "{\"name\":\"read\",\"cat\":\"buffer\",\"ph\":\"i\",\"s\":\"t\",\"args\":{\"buffer\":7,\"bytes\":4}"), static_cast<std::size_t>(1));
+	ASSERT_EQUAL("wait", count(json, "\"name\":\"wait read\""), static_cast<std::size_t>(1));
+	ASSERT_EQUAL("close", count(json, "\"name\":\"close\""), static_cast<std::size_t>(1));
+	ASSERT_EQUAL("error", count(json, "\"name\":\"error\""), static_cast<std::size_t>(1));
+	ASSERT_EQUAL("nothing else", tracer->Events(), static_cast<std::size_t>(5));
+	RETURN_TEST("test_tracer_shared_fifo_events", 0);
+}
+
+int test_tracer_save() {
+	Tracer tracer;
+	tracer.Record(Tracer::Kind::StageBegin, 0);
+	tracer.RecordSpan(Tracer::Kind::WriteWait, 1, std::chrono::steady_clock::now() - std::chrono::microseconds(1500));
+	tracer.Record(Tracer::Kind::StageEnd, 0);
+
+	const std::string path = "tracer_test_trace.json";
+	ASSERT_TRUE("saved", tracer.Save(path));
+	std::ifstream file(path);
+	const std::string saved((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	file.close();
+	std::remove(path.c_str());
+	ASSERT_EQUAL("file holds the JSON", saved, tracer.Json());
+	ASSERT_EQUAL("stage span", count(saved, "\"name\":\"stage 0\""), static_cast<std::size_t>(2));
+	ASSERT_TRUE("wait duration in microseconds", saved.find("\"dur\":15") != std::string::npos || saved.find("\"dur\":16") != std::string::npos);
+	ASSERT_FALSE("unwritable path", tracer.Save("/nonexistent-directory/trace.json"));
+	RETURN_TEST("test_tracer_save", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_tracer_empty();
+	result += test_tracer_threads();
+	result += test_tracer_shared_fifo_events();
+	result += test_tracer_save();
+
+	if (result == 0) {
+		std::cout << "Tracer tests passed!" << std::endl;
+	} else {
+		std::cout << result << " Tracer tests failed." << std::endl;
+	}
+	return result;
+}
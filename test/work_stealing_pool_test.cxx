@@ -0,0 +1,110 @@
+#include <StormByte/buffer/work_stealing_pool.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using StormByte::Buffer::WorkStealingPool;
+
+int test_work_stealing_pool_runs_every_task() {
+	std::atomic<int> counter {0};
+	{
+		WorkStealingPool pool(4);
+		ASSERT_EQUAL("workers", pool.Threads(), static_cast<std::size_t>(4));
+		ASSERT_EQUAL("fixed capacity", pool.Capacity(), static_cast<std::size_t>(4));
+		for (int i = 0; i < 1000; ++i)
+			pool.Post([&counter]() { ++counter; });
+	}
+	ASSERT_EQUAL("destructor drains the queues", counter.load(), 1000);
+	RETURN_TEST("test_work_stealing_pool_runs_every_task", 0);
+}
+
+int test_work_stealing_pool_steals() {
+	std::atomic<int> counter {0};
+	std::mutex mutex;
+	std::set<std::thread::id> threads;
+	WorkStealingPool pool(2);
+	// Tasks posted from a worker land on its own deque: the idle worker has to steal them
+	pool.Post([&]() {
+		for (int i = 0; i < 200; ++i) {
+			pool.Post([&]() {
+				{
+					std::scoped_lock<std::mutex> lock(mutex);
+					threads.insert(std::this_thread::get_id());
+				}
+				std::this_thread::sleep_for(std::chrono::microseconds(200));
+				++counter;
+			});
+		}
+	});
+	for (int i = 0; i < 5000 && counter.load() < 200; ++i)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	ASSERT_EQUAL("every nested task ran", counter.load(), 200);
+	ASSERT_TRUE("tasks were stolen", pool.Steals() > 0);
+	ASSERT_EQUAL("both workers ran them", threads.size(), static_cast<std::size_t>(2));
+	RETURN_TEST("test_work_stealing_pool_steals", 0);
+}
+
+int test_work_stealing_pool_single_worker_order() {
+	std::vector<int> order;
+	{
+		WorkStealingPool pool(1);
+		for (int i = 0; i < 100; ++i)
+			pool.Post([&order, i]() { order.push_back(i); });
+	}
+	bool ordered = order.size() == 100;
+	for (int i = 0; ordered && i < 100; ++i)
+		ordered = order[i] == i;
+	ASSERT_TRUE("posting order kept", ordered);
+	RETURN_TEST("test_work_stealing_pool_single_worker_order", 0);
+}
+
+int test_work_stealing_pool_wakes_sleepers() {
+	WorkStealingPool pool(2);
+	for (int round = 0; round < 100; ++round) {
+		std::mutex mutex;
+		std::condition_variable cv;
+		bool ran = false;
+		// Let the workers fall asleep between rounds
+		if (round % 10 == 0)
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		pool.Post([&]() {
+			std::scoped_lock<std::mutex> lock(mutex);
+			ran = true;
+			cv.notify_all();
+		});
+		std::unique_lock<std::mutex> lock(mutex);
+		ASSERT_TRUE("task ran", cv.wait_for(lock, std::chrono::seconds(5), [&]() { return ran; }));
+	}
+	RETURN_TEST("test_work_stealing_pool_wakes_sleepers", 0);
+}
+
+int test_work_stealing_pool_shared() {
+	auto first = WorkStealingPool::Shared();
+	auto second = WorkStealingPool::Shared();
+	ASSERT_TRUE("same pool", first == second);
+	ASSERT_TRUE("one worker per core", first->Threads() >= 1);
+	RETURN_TEST("test_work_stealing_pool_shared", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_work_stealing_pool_runs_every_task();
+	result += test_work_stealing_pool_steals();
+	result += test_work_stealing_pool_single_worker_order();
+	result += test_work_stealing_pool_wakes_sleepers();
+	result += test_work_stealing_pool_shared();
+
+	if (result == 0) {
+		std::cout << "WorkStealingPool tests passed!" << std::endl;
+	} else {
+		std::cout << result << " WorkStealingPool tests failed." << std::endl;
+	}
+	return result;
+}